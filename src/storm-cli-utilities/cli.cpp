@@ -8,6 +8,7 @@
 #include "storm/utility/initialize.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/parallel.h"
 
 #include <type_traits>
 #include <ctime>
@@ -210,6 +211,8 @@ namespace storm {
 
             // register signal handler to handle aborts
             storm::utility::resources::installSignalHandler();
+            
+            storm::utility::parallel::setNumberOfMatrixThreads(resources.getNumberOfMatrixThreads());
         }
         
         void setLogLevel() {
@@ -22,6 +22,7 @@
 #include "storm/storage/jani/Property.h"
 
 #include "storm/builder/BuilderType.h"
+#include "storm/builder/DdVariableOrder.h"
 
 #include "storm/models/ModelBase.h"
 
@@ -30,6 +31,7 @@
 #include "storm/exceptions/OptionParserException.h"
 
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
+#include "storm/modelchecker/prctl/helper/QualitativeStateSetsCache.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
@@ -418,10 +420,56 @@ namespace storm {
             return result;
         }
         
+        boost::optional<std::vector<std::string>> getDdVariableOrder(storm::storage::SymbolicModelDescription const& model, storm::settings::modules::BuildSettings const& buildSettings) {
+            if (!buildSettings.isDdVariableOrderFileSet() || !(model.isPrismProgram() || model.isJaniModel())) {
+                return boost::none;
+            }
+            
+            // Read the variable order from the file (if there is one).
+            std::string const& filename = buildSettings.getDdVariableOrderFilename();
+            boost::optional<std::vector<std::string>> fileOrder;
+            if (storm::utility::fileExistsAndIsReadable(filename)) {
+                fileOrder = std::vector<std::string>();
+                std::ifstream stream;
+                storm::utility::openFile(filename, stream);
+                std::string line;
+                while (storm::utility::getline(stream, line)) {
+                    if (!line.empty()) {
+                        fileOrder->push_back(line);
+                    }
+                }
+                storm::utility::closeFile(stream);
+            }
+            
+            // Determine the order used for building the model. The order from the file is kept if it matches the model.
+            std::vector<storm::expressions::Variable> variables;
+            if (model.isPrismProgram()) {
+                variables = storm::builder::getDdVariableOrder(model.asPrismProgram(), buildSettings.getDdVariableOrderHeuristic(), fileOrder);
+            } else {
+                variables = storm::builder::getDdVariableOrder(model.asJaniModel(), buildSettings.getDdVariableOrderHeuristic(), fileOrder);
+            }
+            std::vector<std::string> result;
+            for (auto const& variable : variables) {
+                result.push_back(variable.getName());
+            }
+            
+            // Store the order for later runs.
+            if (!fileOrder || fileOrder.get() != result) {
+                std::ofstream stream;
+                storm::utility::openFile(filename, stream);
+                for (auto const& name : result) {
+                    stream << name << std::endl;
+                }
+                storm::utility::closeFile(stream);
+                STORM_LOG_INFO("Stored the variable order of the symbolic model in file " << filename << ".");
+            }
+            return result;
+        }
+        
         template <storm::dd::DdType DdType, typename ValueType>
         std::shared_ptr<storm::models::ModelBase> buildModelDd(SymbolicInput const& input) {
             auto buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
-            return storm::api::buildSymbolicModel<DdType, ValueType>(input.model.get(), createFormulasToRespect(input.properties), buildSettings.isBuildFullModelSet(), !buildSettings.isApplyNoMaximumProgressAssumptionSet());
+            return storm::api::buildSymbolicModel<DdType, ValueType>(input.model.get(), createFormulasToRespect(input.properties), buildSettings.isBuildFullModelSet(), !buildSettings.isApplyNoMaximumProgressAssumptionSet(), buildSettings.getDdVariableOrderHeuristic(), getDdVariableOrder(input.model.get(), buildSettings));
         }
         
         template <typename ValueType>
@@ -460,7 +508,28 @@ namespace storm {
                 options.setAddOverlappingGuardsLabel(true);
             }
 
-            return storm::api::buildSparseModel<ValueType>(input.model.get(), options, useJit, storm::settings::getModule<storm::settings::modules::JitBuilderSettings>().isDoctorSet());
+            boost::optional<std::string> cacheKey;
+            if (buildSettings.isModelCacheSet()) {
+                if (storm::api::isModelCacheApplicable(options)) {
+                    // Build the model independently of the properties (except for expression labels), such that it can be reused for other properties.
+                    options.clearTerminalStates();
+                    options.setBuildAllLabels(true);
+                    options.setBuildAllRewardModels(true);
+                    cacheKey = storm::api::computeModelCacheKey<ValueType>(input.model.get(), options);
+                    std::shared_ptr<storm::models::sparse::Model<ValueType>> cachedModel = storm::api::loadModelFromCache<ValueType>(buildSettings.getModelCacheDirectory(), cacheKey.get());
+                    if (cachedModel) {
+                        return cachedModel;
+                    }
+                } else {
+                    STORM_LOG_WARN("The model cache is not used, because state valuations, choice labels or choice origins are to be built.");
+                }
+            }
+
+            std::shared_ptr<storm::models::sparse::Model<ValueType>> model = storm::api::buildSparseModel<ValueType>(input.model.get(), options, useJit, storm::settings::getModule<storm::settings::modules::JitBuilderSettings>().isDoctorSet());
+            if (cacheKey && model) {
+                storm::api::storeModelInCache<ValueType>(buildSettings.getModelCacheDirectory(), cacheKey.get(), model);
+            }
+            return model;
         }
         
         template <typename ValueType>
@@ -995,12 +1064,15 @@ namespace storm {
         void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, ModelProcessingInformation const& mpi) {
             auto sparseModel = model->as<storm::models::sparse::Model<ValueType>>();
             auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
-            auto verificationCallback = [&sparseModel,&ioSettings,&mpi] (std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
+            // The results of qualitative analyses are shared among all properties.
+            auto qualitativeStateSetsCache = std::make_shared<storm::modelchecker::helper::QualitativeStateSetsCache>(sparseModel);
+            auto verificationCallback = [&sparseModel,&ioSettings,&mpi,&qualitativeStateSetsCache] (std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
                                             bool filterForInitialStates = states->isInitialFormula();
                                             auto task = storm::api::createTask<ValueType>(formula, filterForInitialStates);
                                             if (ioSettings.isExportSchedulerSet()) {
                                                 task.setProduceSchedulers(true);
                                             }
+                                            task.setQualitativeStateSetsCache(qualitativeStateSetsCache);
                                             std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<ValueType>(mpi.env, sparseModel, task);
                                             
                                             std::unique_ptr<storm::modelchecker::CheckResult> filter;
@@ -1043,6 +1115,7 @@ namespace storm {
                                             ++exportCount;
                                         };
             verifyProperties<ValueType>(input,verificationCallback, postprocessingCallback);
+            STORM_LOG_INFO("Reused the results of " << qualitativeStateSetsCache->getNumberOfHits() << " qualitative analyses among the properties.");
             if (ioSettings.isComputeSteadyStateDistributionSet()) {
                 storm::utility::Stopwatch watch(true);
                 std::unique_ptr<storm::modelchecker::CheckResult> result;
@@ -149,14 +149,15 @@ namespace storm {
          * @param eliminateChains If true, chains of non-Markovian states are eliminated from the resulting MA.
          * @param labelBehavior Behavior of labels of eliminated states
          * @param printOutput If true, model information, timings, results, etc. are printed.
+         * @param numberOfThreads Number of threads used for analysing independent modules.
          * @return Results.
          */
         template<typename ValueType>
         typename storm::modelchecker::DFTModelChecker<ValueType>::dft_results
         analyzeDFT(storm::storage::DFT<ValueType> const& dft, std::vector<std::shared_ptr<storm::logic::Formula const>> const& properties, bool symred = true, bool allowModularisation = true, storm::utility::RelevantEvents const& relevantEvents = {}, bool allowDCForRelevant = false,
                    double approximationError = 0.0, storm::builder::ApproximationHeuristic approximationHeuristic = storm::builder::ApproximationHeuristic::DEPTH, bool eliminateChains = false,
-                   storm::transformer::EliminationLabelBehavior labelBehavior = storm::transformer::EliminationLabelBehavior::KeepLabels, bool printOutput = false) {
-            storm::modelchecker::DFTModelChecker<ValueType> modelChecker(printOutput);
+                   storm::transformer::EliminationLabelBehavior labelBehavior = storm::transformer::EliminationLabelBehavior::KeepLabels, bool printOutput = false, uint64_t numberOfThreads = 1) {
+            storm::modelchecker::DFTModelChecker<ValueType> modelChecker(printOutput, numberOfThreads);
             typename storm::modelchecker::DFTModelChecker<ValueType>::dft_results results = modelChecker.check(dft, properties, symred, allowModularisation, relevantEvents, allowDCForRelevant, approximationError, approximationHeuristic, eliminateChains, labelBehavior);
             if (printOutput) {
                 modelChecker.printTimings();
@@ -39,7 +39,8 @@ namespace storm {
                 generator(dft, *stateGenerationInfo),
                 matrixBuilder(!generator.isDeterministicModel()),
                 stateStorage(dft.stateBitVectorSize()),
-                explorationQueue(1, 0, 0.9, false)
+                explorationQueue(1, 0, 0.9, false),
+                pendingStates(dft.stateBitVectorSize())
         {
             // Set relevant events
             STORM_LOG_DEBUG("Relevant events: " << this->dft.getRelevantEventsString());
@@ -118,17 +119,18 @@ namespace storm {
                 this->uniqueFailedState = true;
             }
 
+            std::vector<StateType> previousStateIds;
             if (iteration < 1) {
                 // Initialize
                 switch (usedHeuristic) {
                     case storm::builder::ApproximationHeuristic::DEPTH:
-                        explorationQueue = storm::storage::BucketPriorityQueue<ExplorationHeuristic>(dft.nrElements()+1, 0, 0.9, false);
+                        explorationQueue = storm::storage::BucketPriorityQueue<StateType>(dft.nrElements()+1, 0, 0.9, false);
                         break;
                     case storm::builder::ApproximationHeuristic::PROBABILITY:
-                        explorationQueue = storm::storage::BucketPriorityQueue<ExplorationHeuristic>(200, 0, 0.9, true);
+                        explorationQueue = storm::storage::BucketPriorityQueue<StateType>(200, 0, 0.9, true);
                         break;
                     case storm::builder::ApproximationHeuristic::BOUNDDIFFERENCE:
-                        explorationQueue = storm::storage::BucketPriorityQueue<ExplorationHeuristic>(200, 0, 0.9, true);
+                        explorationQueue = storm::storage::BucketPriorityQueue<StateType>(200, 0, 0.9, true);
                         break;
                     default:
                         STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Heuristic not known.");
@@ -186,7 +188,7 @@ namespace storm {
                 }
 
                 // Initialize heuristic values for inital state
-                STORM_LOG_ASSERT(!statesNotExplored.at(initialStateIndex).second, "Heuristic for initial state is already initialized");
+                STORM_LOG_ASSERT(!statesNotExplored.at(initialStateIndex).heuristic, "Heuristic for initial state is already initialized");
                 ExplorationHeuristicPointer heuristic;
                 switch (usedHeuristic) {
                     case storm::builder::ApproximationHeuristic::DEPTH:
@@ -202,9 +204,14 @@ namespace storm {
                         STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Heuristic not known.");
                 }
                 heuristic->markExpand();
-                statesNotExplored[initialStateIndex].second = heuristic;
-                explorationQueue.push(heuristic);
+                statesNotExplored.at(initialStateIndex).heuristic = heuristic;
+                explorationQueue.pushImmediate(initialStateIndex);
             } else {
+                // Remember the ids of the states in the previous model to relate them to the refined model
+                previousStateIds.resize(matrixBuilder.stateRemapping.size());
+                for (StateType id = 0; id < matrixBuilder.stateRemapping.size(); ++id) {
+                    previousStateIds[matrixBuilder.getRemapping(id)] = id;
+                }
                 initializeNextIteration();
             }
 
@@ -240,6 +247,15 @@ namespace storm {
             STORM_LOG_TRACE("Remap matrix: " << matrixBuilder.stateRemapping << ", offset: " << matrixBuilder.mappingOffset);
             matrixBuilder.remap();
 
+            // Relate the states of the previous model to their new indices
+            previousStateMapping.clear();
+            if (iteration > 0) {
+                previousStateMapping.reserve(previousStateIds.size());
+                for (StateType id : previousStateIds) {
+                    previousStateMapping.push_back(matrixBuilder.getRemapping(id));
+                }
+            }
+
             STORM_LOG_TRACE("State remapping: " << matrixBuilder.stateRemapping);
             STORM_LOG_TRACE("Markovian states: " << modelComponents.markovianStates);
             STORM_LOG_DEBUG("Model has " << stateSize << " states");
@@ -264,8 +280,14 @@ namespace storm {
             // Push skipped states to explore queue
             // TODO: remove
             for (auto const& skippedState : skippedStates) {
-                statesNotExplored[skippedState.second.first->getId()] = skippedState.second;
-                explorationQueue.push(skippedState.second.second);
+                ExplorationHeuristicPointer const& heuristic = skippedState.second.heuristic;
+                StateType id = heuristic->getId();
+                statesNotExplored[id] = skippedState.second;
+                if (heuristic->isExpand()) {
+                    explorationQueue.pushImmediate(id);
+                } else {
+                    explorationQueue.push(id, heuristic->getPriority());
+                }
             }
 
             // Initialize matrix builder again
@@ -294,7 +316,7 @@ namespace storm {
             matrixBuilder.mappingOffset = nrStates;
             STORM_LOG_TRACE("# expanded states: " << nrExpandedStates);
             StateType skippedIndex = nrExpandedStates;
-            std::map<StateType, std::pair<DFTStatePointer, ExplorationHeuristicPointer>> skippedStatesNew;
+            std::map<StateType, PendingState> skippedStatesNew;
             for (size_t id = 0; id < matrixBuilder.stateRemapping.size(); ++id) {
                 StateType index = matrixBuilder.getRemapping(id);
                 auto itFind = skippedStates.find(index);
@@ -341,7 +363,7 @@ namespace storm {
                             auto itFind = skippedStates.find(itEntry->getColumn());
                             if (itFind != skippedStates.end()) {
                                 // Set id for skipped states as we remap it later
-                                matrixBuilder.addTransition(matrixBuilder.mappingOffset + itFind->second.first->getId(), itEntry->getValue());
+                                matrixBuilder.addTransition(matrixBuilder.mappingOffset + itFind->second.heuristic->getId(), itEntry->getValue());
                             } else {
                                 // Set newly remapped index for expanded states
                                 matrixBuilder.addTransition(indexRemapping[itEntry->getColumn()], itEntry->getValue());
@@ -367,23 +389,28 @@ namespace storm {
             // TODO: do not empty queue every time but break before
             while (!explorationQueue.empty()) {
                 // Get the first state in the queue
-                ExplorationHeuristicPointer currentExplorationHeuristic = explorationQueue.pop();
-                StateType currentId = currentExplorationHeuristic->getId();
+                auto queueEntry = explorationQueue.pop();
+                StateType currentId = queueEntry.item;
                 auto itFind = statesNotExplored.find(currentId);
-                STORM_LOG_ASSERT(itFind != statesNotExplored.end(), "Id " << currentId << " not found");
-                DFTStatePointer currentState = itFind->second.first;
-                STORM_LOG_ASSERT(currentExplorationHeuristic == itFind->second.second, "Exploration heuristics do not match");
-                STORM_LOG_ASSERT(currentState->getId() == currentId, "Ids do not match");
+                if (itFind == statesNotExplored.end()) {
+                    // State was already explored via a more recent entry
+                    continue;
+                }
+                ExplorationHeuristicPointer currentExplorationHeuristic = itFind->second.heuristic;
+                STORM_LOG_ASSERT(currentExplorationHeuristic, "Heuristic for state " << currentId << " is not initialized");
+                if (!currentExplorationHeuristic->isExpand() && currentExplorationHeuristic->getPriority() != queueEntry.priority) {
+                    // Entry is outdated as the priority of the state changed
+                    continue;
+                }
+                PendingState pendingState = itFind->second;
                 // Remove it from the list of not explored states
                 statesNotExplored.erase(itFind);
+
+                // Create concrete state from the stored status
+                DFTStatePointer currentState = createPendingState(currentId, pendingState);
+                STORM_LOG_ASSERT(currentState->getId() == currentId, "Ids do not match");
                 STORM_LOG_ASSERT(stateStorage.stateToId.contains(currentState->status()), "State is not contained in state storage.");
                 STORM_LOG_ASSERT(stateStorage.stateToId.getValue(currentState->status()) == currentId, "Ids of states do not coincide.");
-
-                // Get concrete state if necessary
-                if (currentState->isPseudoState()) {
-                    // Create concrete state from pseudo state
-                    currentState->construct();
-                }
                 STORM_LOG_ASSERT(!currentState->isPseudoState(), "State is pseudo state.");
 
                 // Remember that the current row group was actually filled with the transitions of a different state
@@ -405,10 +432,12 @@ namespace storm {
                     //STORM_LOG_ASSERT(this->uniqueFailedState, "Approximation only works with unique failed state");
                     matrixBuilder.addTransition(0, storm::utility::zero<ValueType>());
                     // Remember skipped state
-                    skippedStates[matrixBuilder.getCurrentRowGroup() - 1] = std::make_pair(currentState, currentExplorationHeuristic);
+                    skippedStates[matrixBuilder.getCurrentRowGroup() - 1] = pendingState;
                     matrixBuilder.finishRow();
                 } else {
                     // Explore the current state
+                    // The status is not needed anymore as the state is expanded now
+                    pendingStates.remove(pendingState.slot);
                     ++nrExpandedStates;
                     storm::generator::StateBehavior<ValueType, StateType> behavior = generator.expand(std::bind(&ExplicitDFTModelBuilder::getOrAddStateIndex, this, std::placeholders::_1));
                     STORM_LOG_ASSERT(!behavior.empty(), "Behavior is empty.");
@@ -425,8 +454,8 @@ namespace storm {
                             auto iter = statesNotExplored.find(stateProbabilityPair.first);
                             if (iter != statesNotExplored.end()) {
                                 // Update heuristic values
-                                DFTStatePointer state = iter->second.first;
-                                if (!iter->second.second) {
+                                PendingState& reachedState = iter->second;
+                                if (!reachedState.heuristic) {
                                     // Initialize heuristic values
                                     ExplorationHeuristicPointer heuristic;
                                     switch (usedHeuristic) {
@@ -443,19 +472,14 @@ namespace storm {
                                             STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Heuristic not known.");
                                     }
 
-                                    iter->second.second = heuristic;
-                                    //if (state->hasFailed(dft.getTopLevelIndex()) || state->isFailsafe(dft.getTopLevelIndex()) || state->getFailableElements().hasDependencies() || (!state->getFailableElements().hasDependencies() && !state->getFailableElements().hasBEs())) {
-                                    if (state->getFailableElements().hasDependencies() || (!state->getFailableElements().hasDependencies() && !state->getFailableElements().hasBEs())) {
-                                            // Do not skip absorbing state or if reached by dependencies
-                                        iter->second.second->markExpand();
+                                    reachedState.heuristic = heuristic;
+                                    if (reachedState.mustExpand) {
+                                        // Do not skip absorbing state or if reached by dependencies
+                                        heuristic->markExpand();
                                     }
                                     if (usedHeuristic == storm::builder::ApproximationHeuristic::BOUNDDIFFERENCE) {
                                         // Compute bounds for heuristic now
-                                        if (state->isPseudoState()) {
-                                            // Create concrete state from pseudo state
-                                            state->construct();
-                                        }
-                                        STORM_LOG_ASSERT(!currentState->isPseudoState(), "State is pseudo state.");
+                                        DFTStatePointer state = createPendingState(stateProbabilityPair.first, reachedState);
 
                                         // Initialize bounds
                                         // TODO: avoid hack
@@ -464,12 +488,15 @@ namespace storm {
                                         heuristic->setBounds(lowerBound, upperBound);
                                     }
 
-                                    explorationQueue.push(heuristic);
-                                } else if (!iter->second.second->isExpand()) {
-                                    double oldPriority = iter->second.second->getPriority();
-                                    if (iter->second.second->updateHeuristicValues(*currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass())) {
+                                    if (heuristic->isExpand()) {
+                                        explorationQueue.pushImmediate(stateProbabilityPair.first);
+                                    } else {
+                                        explorationQueue.push(stateProbabilityPair.first, heuristic->getPriority());
+                                    }
+                                } else if (!reachedState.heuristic->isExpand()) {
+                                    if (reachedState.heuristic->updateHeuristicValues(*currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass())) {
                                         // Update priority queue
-                                        explorationQueue.update(iter->second.second, oldPriority);
+                                        explorationQueue.update(stateProbabilityPair.first, reachedState.heuristic->getPriority());
                                     }
                                 }
                             }
@@ -604,7 +631,6 @@ namespace storm {
                     for (auto it = skippedStates.begin(); it != skippedStates.end(); ++it) {
                         auto matrixEntry = matrix.getRow(it->first, 0).begin();
                         STORM_LOG_ASSERT(matrixEntry->getColumn() == 0, "Transition has wrong target state.");
-                        STORM_LOG_ASSERT(!it->second.first->isPseudoState(), "State is still pseudo state.");
                         matrixEntry->setValue(storm::utility::one<ValueType>());
                         matrixEntry->setColumn(it->first);
                     }
@@ -659,6 +685,11 @@ namespace storm {
             }
         }
 
+        template<typename ValueType, typename StateType>
+        std::vector<StateType> const& ExplicitDFTModelBuilder<ValueType, StateType>::getPreviousStateMapping() const {
+            return previousStateMapping;
+        }
+
         template<typename ValueType, typename StateType>
         std::shared_ptr<storm::models::sparse::Model<ValueType>> ExplicitDFTModelBuilder<ValueType, StateType>::createModel(bool copy) {
             std::shared_ptr<storm::models::sparse::Model<ValueType>> model;
@@ -720,21 +751,21 @@ namespace storm {
             for (auto it = skippedStates.begin(); it != skippedStates.end(); ++it) {
                 auto matrixEntry = matrix.getRow(it->first, 0).begin();
                 STORM_LOG_ASSERT(matrixEntry->getColumn() == 0, "Transition has wrong target state.");
-                STORM_LOG_ASSERT(!it->second.first->isPseudoState(), "State is still pseudo state.");
 
-                ExplorationHeuristicPointer heuristic = it->second.second;
+                ExplorationHeuristicPointer heuristic = it->second.heuristic;
                 if (storm::utility::isInfinity(heuristic->getUpperBound())) {
                     // Initialize bounds
-                    ValueType lowerBound = getLowerBound(it->second.first);
-                    ValueType upperBound = getUpperBound(it->second.first);
+                    DFTStatePointer state = createPendingState(heuristic->getId(), it->second);
+                    ValueType lowerBound = getLowerBound(state);
+                    ValueType upperBound = getUpperBound(state);
                     heuristic->setBounds(lowerBound, upperBound);
                 }
 
                 // Change bound
                 if (lowerBound) {
-                    matrixEntry->setValue(it->second.second->getLowerBound());
+                    matrixEntry->setValue(heuristic->getLowerBound());
                 } else {
-                    matrixEntry->setValue(it->second.second->getUpperBound());
+                    matrixEntry->setValue(heuristic->getUpperBound());
                 }
             }
         }
@@ -902,14 +933,13 @@ namespace storm {
                     // Check if state is pseudo state
                     // If state is explored already the possible pseudo state was already constructed
                     auto iter = statesNotExplored.find(stateId);
-                    if (iter != statesNotExplored.end() && iter->second.first->isPseudoState()) {
+                    if (iter != statesNotExplored.end() && iter->second.pseudo) {
                         // Create pseudo state now
-                        STORM_LOG_ASSERT(iter->second.first->getId() == stateId, "Ids do not match.");
-                        STORM_LOG_ASSERT(iter->second.first->status() == state->status(), "Pseudo states do not coincide.");
+                        STORM_LOG_ASSERT(pendingStates.get(iter->second.slot) == state->status(), "Pseudo states do not coincide.");
                         state->setId(stateId);
-                        // Update mapping to map to concrete state now
-                        // TODO: just change pointer?
-                        statesNotExplored[stateId] = std::make_pair(state, iter->second.second);
+                        // Update information to reflect the concrete state now
+                        iter->second.pseudo = false;
+                        iter->second.mustExpand = state->getFailableElements().hasDependencies() || !state->getFailableElements().hasBEs();
                         // We do not push the new state on the exploration queue as the pseudo state was already pushed
                         STORM_LOG_TRACE("Created pseudo state " << dft.getStateString(state));
                     }
@@ -922,8 +952,13 @@ namespace storm {
                 stateId = stateStorage.stateToId.findOrAdd(state->status(), state->getId());
                 STORM_LOG_ASSERT(stateId == state->getId(), "Ids do not match.");
                 // Insert state as not yet explored
-                ExplorationHeuristicPointer nullHeuristic;
-                statesNotExplored[stateId] = std::make_pair(state, nullHeuristic);
+                // Only the status is stored, the state object itself is discarded
+                PendingState pendingState;
+                pendingState.slot = pendingStates.add(state->status());
+                pendingState.pseudo = state->isPseudoState();
+                // The failable elements of pseudo states are not yet computed. Such states are always expanded.
+                pendingState.mustExpand = state->isPseudoState() || state->getFailableElements().hasDependencies() || !state->getFailableElements().hasBEs();
+                statesNotExplored[stateId] = std::move(pendingState);
                 // Reserve one slot for the new state in the remapping
                 matrixBuilder.stateRemapping.push_back(0);
                 STORM_LOG_TRACE("New " << (state->isPseudoState() ? "pseudo" : "concrete") << " state: " << dft.getStateString(state));
@@ -931,6 +966,13 @@ namespace storm {
             return stateId;
         }
 
+        template<typename ValueType, typename StateType>
+        typename ExplicitDFTModelBuilder<ValueType, StateType>::DFTStatePointer ExplicitDFTModelBuilder<ValueType, StateType>::createPendingState(StateType id, PendingState const& pendingState) const {
+            DFTStatePointer state = std::make_shared<storm::storage::DFTState<ValueType>>(pendingStates.get(pendingState.slot), dft, *stateGenerationInfo, id);
+            state->construct();
+            return state;
+        }
+
         template<typename ValueType, typename StateType>
         void ExplicitDFTModelBuilder<ValueType, StateType>::setMarkovian(bool markovian) {
             if (matrixBuilder.getCurrentRowGroup() > modelComponents.markovianStates.size()) {
@@ -943,8 +985,8 @@ namespace storm {
         template<typename ValueType, typename StateType>
         void ExplicitDFTModelBuilder<ValueType, StateType>::printNotExplored() const {
             std::cout << "states not explored:" << std::endl;
-            for (auto it : statesNotExplored) {
-                std::cout << it.first << " -> " << dft.getStateString(it.second.first) << std::endl;
+            for (auto const& it : statesNotExplored) {
+                std::cout << it.first << " -> " << dft.getStateString(pendingStates.get(it.second.slot), *stateGenerationInfo, it.first) << std::endl;
             }
         }
 
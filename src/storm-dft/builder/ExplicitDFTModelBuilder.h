@@ -2,6 +2,7 @@
 
 #include <boost/optional/optional.hpp>
 #include <stack>
+#include <unordered_map>
 #include <unordered_set>
 #include <limits>
 
@@ -17,6 +18,7 @@
 #include "storm-dft/storage/dft/DFT.h"
 #include "storm-dft/storage/dft/SymmetricUnits.h"
 #include "storm-dft/storage/BucketPriorityQueue.h"
+#include "storm-dft/storage/PackedStateStorage.h"
 
 namespace storm {
     namespace builder {
@@ -56,6 +58,20 @@ namespace storm {
                 bool deterministicModel;
             };
 
+            // A structure holding the information about a state which is not yet explored (or was skipped).
+            // Only the status of the state is kept (in the packed state storage). The remaining information of the
+            // DFT state, such as the currently failable elements, is derived from the status when the state is explored.
+            struct PendingState {
+                // Slot of the state status in the packed state storage.
+                uint64_t slot;
+                // Flag indicating whether the state was only reached as pseudo state so far.
+                bool pseudo;
+                // Flag indicating whether the state must not be skipped during approximation.
+                bool mustExpand;
+                // Heuristic values of the state (if already initialized).
+                ExplorationHeuristicPointer heuristic;
+            };
+
             // A class holding the information for building the transition matrix.
             class MatrixBuilder {
             public:
@@ -184,6 +200,15 @@ namespace storm {
              */
             std::shared_ptr<storm::models::sparse::Model<ValueType>> getModelApproximation(bool lowerBound, bool expectedTime);
 
+            /*!
+             * Get the mapping from the states of the model built in the previous iteration to the states of the current model.
+             * States of the previous model keep their meaning during refinement, only their index changes.
+             * Can be used to warm-start the analysis of the refined model with the results of the previous iteration.
+             *
+             * @return Mapping from previous state indices to current state indices. Empty in the first iteration.
+             */
+            std::vector<StateType> const& getPreviousStateMapping() const;
+
         private:
 
             /*!
@@ -212,6 +237,16 @@ namespace storm {
              */
             StateType getOrAddStateIndex(DFTStatePointer const& state);
 
+            /*!
+             * Create the DFT state for a state which is not yet explored (or was skipped).
+             *
+             * @param id           Id of the state.
+             * @param pendingState Information about the state.
+             *
+             * @return Concrete DFT state.
+             */
+            DFTStatePointer createPendingState(StateType id, PendingState const& pendingState) const;
+
             /*!
              * Set markovian flag for the current state.
              *
@@ -314,17 +349,24 @@ namespace storm {
             // Internal information about the states that were explored.
             storm::storage::sparse::StateStorage<StateType> stateStorage;
 
-            // A priority queue of states that still need to be explored.
-            storm::storage::BucketPriorityQueue<ExplorationHeuristic> explorationQueue;
+            // A priority queue of the ids of states that still need to be explored.
+            // Entries whose priority does not coincide with the current priority of the state are outdated.
+            storm::storage::BucketPriorityQueue<StateType> explorationQueue;
+
+            // Status of all states which are not yet explored or were skipped.
+            storm::storage::PackedStateStorage pendingStates;
 
-            // A mapping of not yet explored states from the id to the tuple (state object, heuristic values).
-            std::map<StateType, std::pair<DFTStatePointer, ExplorationHeuristicPointer>> statesNotExplored;
+            // A mapping of not yet explored states from the id to the information about the state.
+            std::unordered_map<StateType, PendingState> statesNotExplored;
 
             // Holds all skipped states which were not yet expanded. More concretely it is a mapping from matrix indices
             // to the corresponding skipped states.
             // Notice that we need an ordered map here to easily iterate in increasing order over state ids.
             // TODO remove again
-            std::map<StateType, std::pair<DFTStatePointer, ExplorationHeuristicPointer>> skippedStates;
+            std::map<StateType, PendingState> skippedStates;
+
+            // A mapping from the state indices of the model in the previous iteration to the state indices of the current model.
+            std::vector<StateType> previousStateMapping;
 
             // List of independent subtrees and the BEs contained in them.
             std::vector<std::vector<size_t>> subtreeBEs;
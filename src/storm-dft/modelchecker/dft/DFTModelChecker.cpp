@@ -1,14 +1,33 @@
 #include "DFTModelChecker.h"
 
+#include <algorithm>
+#include <functional>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <set>
+
+#include <boost/functional/hash.hpp>
+
 #include "storm/settings/modules/IOSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/builder/ParallelCompositionBuilder.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
+#include "storm/storage/BitVector.h"
 #include "storm/utility/bitoperations.h"
+#include "storm/utility/parallel.h"
 #include "storm/io/DirectEncodingExporter.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/modelchecker/csl/SparseCtmcCslModelChecker.h"
+#include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
 #include "storm/models/ModelType.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/utility/NumberTraits.h"
 
 #include "storm-dft/api/storm-dft.h"
 #include "storm-dft/builder/ExplicitDFTModelBuilder.h"
@@ -27,6 +46,11 @@ namespace storm {
                                                                                            bool eliminateChains, storm::transformer::EliminationLabelBehavior labelBehavior) {
             totalTimer.start();
             dft_results results;
+            {
+                // Module results are only valid for the current analysis settings
+                std::lock_guard<std::mutex> lock(moduleCache->mutex);
+                moduleCache->results.clear();
+            }
 
             // Check well-formedness of DFT
             auto wellFormedResult = storm::api::isWellFormed(origDft, true);
@@ -104,19 +128,60 @@ namespace storm {
             // Perform modularisation
             if (dfts.size() > 1) {
                 STORM_LOG_DEBUG("Modularisation of " << dft.getTopLevelGate()->name() << " into " << dfts.size() << " submodules.");
-                // TODO: compute simultaneously
+                // Modules with the same signature are isomorphic and only have to be checked once
+                std::vector<std::string> signatures;
+                signatures.reserve(dfts.size());
+                for (auto const& ft : dfts) {
+                    signatures.push_back(computeModuleSignature(ft, relevantEvents));
+                }
+
                 dft_results results;
                 for (auto property : properties) {
                     if (!property->isProbabilityOperatorFormula()) {
                         STORM_LOG_WARN("Could not check property: " << *property);
                     } else {
+                        std::stringstream propertyStream;
+                        propertyStream << *property;
+                        std::vector<std::string> keys;
+                        keys.reserve(dfts.size());
+                        for (auto const& signature : signatures) {
+                            keys.push_back(signature + "|" + propertyStream.str());
+                        }
+
+                        // Look up results of already analysed modules
+                        std::map<std::string, ValueType> moduleResults;
+                        std::set<std::string> keysToCheck;
+                        std::vector<uint64_t> modulesToCheck;
+                        {
+                            std::lock_guard<std::mutex> lock(moduleCache->mutex);
+                            for (uint64_t i = 0; i < dfts.size(); ++i) {
+                                if (moduleResults.count(keys[i]) > 0 || keysToCheck.count(keys[i]) > 0) {
+                                    continue;
+                                }
+                                auto cacheIt = moduleCache->results.find(keys[i]);
+                                if (cacheIt != moduleCache->results.end()) {
+                                    moduleResults.emplace(keys[i], cacheIt->second);
+                                } else {
+                                    keysToCheck.insert(keys[i]);
+                                    modulesToCheck.push_back(i);
+                                }
+                            }
+                        }
+                        STORM_LOG_DEBUG("Checking " << modulesToCheck.size() << " of " << dfts.size() << " submodules.");
+
                         // Recursively call model checking
+                        // TODO: allow approximation in modularisation
+                        std::vector<ValueType> checkedResults = checkModules(dfts, modulesToCheck, property, symred, relevantEvents, allowDCForRelevant);
+                        {
+                            std::lock_guard<std::mutex> lock(moduleCache->mutex);
+                            for (uint64_t i = 0; i < modulesToCheck.size(); ++i) {
+                                moduleCache->results.emplace(keys[modulesToCheck[i]], checkedResults[i]);
+                                moduleResults.emplace(keys[modulesToCheck[i]], checkedResults[i]);
+                            }
+                        }
                         std::vector<ValueType> res;
-                        for (auto const ft : dfts) {
-                            // TODO: allow approximation in modularisation
-                            dft_results ftResults = checkHelper(ft, {property}, symred, true, relevantEvents, allowDCForRelevant, 0.0);
-                            STORM_LOG_ASSERT(ftResults.size() == 1, "Wrong number of results");
-                            res.push_back(boost::get<ValueType>(ftResults[0]));
+                        for (auto const& key : keys) {
+                            res.push_back(moduleResults.at(key));
                         }
 
                         // Combine modularisation results
@@ -156,6 +221,198 @@ namespace storm {
             }
         }
 
+        template<typename ValueType>
+        std::vector<ValueType> DFTModelChecker<ValueType>::checkModules(std::vector<storm::storage::DFT<ValueType>> const& modules, std::vector<uint64_t> const& moduleIndices,
+                                                                        std::shared_ptr<storm::logic::Formula const> const& property, bool symred,
+                                                                        storm::utility::RelevantEvents const& relevantEvents, bool allowDCForRelevant) {
+            std::vector<ValueType> results(moduleIndices.size(), storm::utility::zero<ValueType>());
+
+            // Only floating point computations are thread-safe. Exporting models would write to the same files concurrently.
+            auto ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
+            uint64_t threads = std::max<uint64_t>(1, std::min<uint64_t>(numberOfThreads, moduleIndices.size()));
+            if (!std::is_same<ValueType, double>::value || ioSettings.isExportExplicitSet() || ioSettings.isExportDotSet()) {
+                threads = 1;
+            }
+
+            if (threads == 1) {
+                for (uint64_t i = 0; i < moduleIndices.size(); ++i) {
+                    dft_results ftResults = checkHelper(modules[moduleIndices[i]], {property}, symred, true, relevantEvents, allowDCForRelevant, 0.0);
+                    STORM_LOG_ASSERT(ftResults.size() == 1, "Wrong number of results");
+                    results[i] = boost::get<ValueType>(ftResults[0]);
+                }
+                return results;
+            }
+
+            STORM_LOG_DEBUG("Checking " << moduleIndices.size() << " submodules with " << threads << " threads.");
+            // Each thread uses its own model checker such that timers are not shared. Module results are shared via the cache.
+            std::vector<std::unique_ptr<DFTModelChecker<ValueType>>> checkers;
+            for (uint64_t thread = 0; thread < threads; ++thread) {
+                checkers.push_back(std::make_unique<DFTModelChecker<ValueType>>(false));
+                checkers.back()->moduleCache = moduleCache;
+            }
+            // Each thread handles every threads-th module with its own checker.
+            storm::utility::parallel::parallelFor(threads, threads, [&](uint64_t thread) {
+                for (uint64_t i = thread; i < moduleIndices.size(); i += threads) {
+                    dft_results ftResults = checkers[thread]->checkHelper(modules[moduleIndices[i]], {property}, symred, true, relevantEvents, allowDCForRelevant, 0.0);
+                    STORM_LOG_ASSERT(ftResults.size() == 1, "Wrong number of results");
+                    results[i] = boost::get<ValueType>(ftResults[0]);
+                }
+            });
+
+            // Accumulate the timings of all threads
+            for (auto const& checker : checkers) {
+                buildingTimer.add(checker->buildingTimer);
+                explorationTimer.add(checker->explorationTimer);
+                bisimulationTimer.add(checker->bisimulationTimer);
+                modelCheckingTimer.add(checker->modelCheckingTimer);
+            }
+            return results;
+        }
+
+        template<typename ValueType>
+        std::string DFTModelChecker<ValueType>::computeModuleSignature(storm::storage::DFT<ValueType> const& dft, storm::utility::RelevantEvents const& relevantEvents) {
+            // Describe each element by its type and parameters (but not by its name)
+            std::vector<std::string> descriptions;
+            std::vector<std::vector<size_t>> successors;
+            descriptions.reserve(dft.nrElements());
+            successors.reserve(dft.nrElements());
+            for (size_t i = 0; i < dft.nrElements(); ++i) {
+                auto element = dft.getElement(i);
+                STORM_LOG_ASSERT(element->id() == i, "Element id does not match index.");
+                std::stringstream stream;
+                stream << std::setprecision(std::numeric_limits<double>::max_digits10);
+                stream << storm::storage::toString(element->type());
+                std::vector<size_t> elementSuccessors;
+                if (element->isBasicElement()) {
+                    auto be = dft.getBasicElement(i);
+                    stream << " " << storm::storage::toString(be->beType());
+                    switch (be->beType()) {
+                        case storm::storage::BEType::CONSTANT:
+                            stream << " " << std::static_pointer_cast<storm::storage::BEConst<ValueType> const>(be)->failed();
+                            break;
+                        case storm::storage::BEType::EXPONENTIAL: {
+                            auto beExp = std::static_pointer_cast<storm::storage::BEExponential<ValueType> const>(be);
+                            stream << " " << beExp->activeFailureRate() << " " << beExp->passiveFailureRate() << " " << beExp->isTransient();
+                            break;
+                        }
+                        case storm::storage::BEType::SAMPLES:
+                            for (auto const& sample : std::static_pointer_cast<storm::storage::BESamples<ValueType> const>(be)->activeSamples()) {
+                                stream << " " << sample.first << ":" << sample.second;
+                            }
+                            break;
+                        default:
+                            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "BE type '" << be->beType() << "' is not known.");
+                    }
+                } else if (element->isGate()) {
+                    auto gate = dft.getGate(i);
+                    switch (gate->type()) {
+                        case storm::storage::DFTElementType::VOT:
+                            stream << " " << std::static_pointer_cast<storm::storage::DFTVot<ValueType> const>(gate)->threshold();
+                            break;
+                        case storm::storage::DFTElementType::PAND:
+                            stream << " " << std::static_pointer_cast<storm::storage::DFTPand<ValueType> const>(gate)->isInclusive();
+                            break;
+                        case storm::storage::DFTElementType::POR:
+                            stream << " " << std::static_pointer_cast<storm::storage::DFTPor<ValueType> const>(gate)->isInclusive();
+                            break;
+                        default:
+                            break;
+                    }
+                    for (auto const& child : gate->children()) {
+                        elementSuccessors.push_back(child->id());
+                    }
+                } else if (element->isDependency()) {
+                    auto dependency = dft.getDependency(i);
+                    stream << " " << dependency->probability();
+                    elementSuccessors.push_back(dependency->triggerEvent()->id());
+                    for (auto const& dependentEvent : dependency->dependentEvents()) {
+                        elementSuccessors.push_back(dependentEvent->id());
+                    }
+                } else if (element->isRestriction()) {
+                    for (auto const& child : dft.getRestriction(i)->children()) {
+                        elementSuccessors.push_back(child->id());
+                    }
+                }
+                if (relevantEvents.isRelevant(element->name())) {
+                    stream << " '" << element->name() << "'";
+                }
+                descriptions.push_back(stream.str());
+                successors.push_back(std::move(elementSuccessors));
+            }
+
+            // Compute structural hashes bottom-up. The order of children of static gates is irrelevant for the hash.
+            std::vector<size_t> hashes(dft.nrElements(), 0);
+            storm::storage::BitVector hashed(dft.nrElements(), false);
+            std::function<size_t(size_t)> computeHash = [&](size_t index) -> size_t {
+                if (!hashed.get(index)) {
+                    std::vector<size_t> successorHashes;
+                    for (auto const& successor : successors[index]) {
+                        successorHashes.push_back(computeHash(successor));
+                    }
+                    if (storm::storage::isStaticGateType(dft.getElement(index)->type())) {
+                        std::sort(successorHashes.begin(), successorHashes.end());
+                    }
+                    size_t hash = std::hash<std::string>()(descriptions[index]);
+                    boost::hash_combine(hash, boost::hash_range(successorHashes.begin(), successorHashes.end()));
+                    hashes[index] = hash;
+                    hashed.set(index);
+                }
+                return hashes[index];
+            };
+            for (size_t i = 0; i < dft.nrElements(); ++i) {
+                computeHash(i);
+            }
+            // Children of static gates are ordered by their hash
+            for (size_t i = 0; i < dft.nrElements(); ++i) {
+                if (storm::storage::isStaticGateType(dft.getElement(i)->type())) {
+                    std::stable_sort(successors[i].begin(), successors[i].end(), [&hashes](size_t lhs, size_t rhs) { return hashes[lhs] < hashes[rhs]; });
+                }
+            }
+
+            // Number the elements in depth-first order starting from the top level element.
+            // Dependencies and restrictions are not reachable from the top level element and are numbered afterwards in the order of their hashes.
+            std::vector<size_t> numbering(dft.nrElements(), dft.nrElements());
+            std::vector<size_t> order;
+            order.reserve(dft.nrElements());
+            std::function<void(size_t)> visit = [&](size_t index) {
+                if (numbering[index] < dft.nrElements()) {
+                    return;
+                }
+                numbering[index] = order.size();
+                order.push_back(index);
+                for (auto const& successor : successors[index]) {
+                    visit(successor);
+                }
+            };
+            visit(dft.getTopLevelIndex());
+            std::vector<size_t> remaining;
+            for (size_t i = 0; i < dft.nrElements(); ++i) {
+                if (numbering[i] == dft.nrElements()) {
+                    remaining.push_back(i);
+                }
+            }
+            std::stable_sort(remaining.begin(), remaining.end(), [&hashes](size_t lhs, size_t rhs) { return hashes[lhs] < hashes[rhs]; });
+            for (auto const& index : remaining) {
+                visit(index);
+            }
+
+            // The signature lists all elements with the numbers of their successors
+            std::stringstream signature;
+            for (auto const& index : order) {
+                signature << descriptions[index] << "(";
+                bool first = true;
+                for (auto const& successor : successors[index]) {
+                    if (!first) {
+                        signature << ",";
+                    }
+                    first = false;
+                    signature << numbering[successor];
+                }
+                signature << ");";
+            }
+            return signature.str();
+        }
+
         template<typename ValueType>
         std::shared_ptr<storm::models::sparse::Ctmc<ValueType>>
         DFTModelChecker<ValueType>::buildModelViaComposition(storm::storage::DFT<ValueType> const &dft, property_vector const &properties, bool symred, bool allowModularisation, storm::utility::RelevantEvents const& relevantEvents, bool allowDCForRelevant) {
@@ -314,7 +571,10 @@ namespace storm {
                 approximation_result approxResult = std::make_pair(storm::utility::zero<ValueType>(),
                                                                    storm::utility::zero<ValueType>());
                 std::shared_ptr<storm::models::sparse::Model<ValueType>> model;
-                std::vector<ValueType> newResult;
+                ValueType newResult;
+                // Values of all states for lower and upper bound from the previous iteration
+                std::vector<ValueType> lowerValues;
+                std::vector<ValueType> upperValues;
                 storm::builder::ExplicitDFTModelBuilder<ValueType> builder(dft, symmetries);
 
                 // TODO: compute approximation for all properties simultaneously?
@@ -334,7 +594,6 @@ namespace storm {
                         explorationTimer.start();
                     }
                     STORM_LOG_DEBUG("Building model...");
-                    // TODO refine model using existing model and MC results
                     builder.buildModel(iteration, approximationError, approximationHeuristic);
                     explorationTimer.stop();
                     buildingTimer.start();
@@ -344,6 +603,21 @@ namespace storm {
                     // Build model for lower bound
                     STORM_LOG_DEBUG("Getting model for lower bound...");
                     model = builder.getModelApproximation(true, !probabilityFormula);
+
+                    // Move the results of the previous iteration to the refined state space to warm-start the model checking.
+                    // States which are new in the refined model start with value zero.
+                    auto const& previousStateMapping = builder.getPreviousStateMapping();
+                    for (std::vector<ValueType>* values : {&lowerValues, &upperValues}) {
+                        if (values->empty() || values->size() != previousStateMapping.size()) {
+                            values->clear();
+                            continue;
+                        }
+                        std::vector<ValueType> refinedValues(model->getNumberOfStates(), storm::utility::zero<ValueType>());
+                        for (size_t state = 0; state < previousStateMapping.size(); ++state) {
+                            refinedValues[previousStateMapping[state]] = (*values)[state];
+                        }
+                        *values = std::move(refinedValues);
+                    }
                     // We only output the info from the lower bound as the info for the upper bound is the same
                     if (printInfo && dftIOSettings.isShowDftStatisticsSet()) {
                         std::cout << "Model in iteration " << (iteration + 1) << ":" << std::endl;
@@ -358,12 +632,11 @@ namespace storm {
                     }
 
                     // Check lower bounds
-                    newResult = checkModel(model, {property});
-                    STORM_LOG_ASSERT(newResult.size() == 1, "Wrong size for result vector.");
-                    STORM_LOG_ASSERT(iteration == 0 || !comparator.isLess(newResult[0], approxResult.first),
-                                     "New under-approximation " << newResult[0] << " is smaller than old result "
+                    newResult = checkApproximationModel(model, property, lowerValues);
+                    STORM_LOG_ASSERT(iteration == 0 || !comparator.isLess(newResult, approxResult.first),
+                                     "New under-approximation " << newResult << " is smaller than old result "
                                                                 << approxResult.first);
-                    approxResult.first = newResult[0];
+                    approxResult.first = newResult;
 
                     // Build model for upper bound
                     STORM_LOG_DEBUG("Getting model for upper bound...");
@@ -371,12 +644,11 @@ namespace storm {
                     model = builder.getModelApproximation(false, !probabilityFormula);
                     buildingTimer.stop();
                     // Check upper bound
-                    newResult = checkModel(model, {property});
-                    STORM_LOG_ASSERT(newResult.size() == 1, "Wrong size for result vector.");
-                    STORM_LOG_ASSERT(iteration == 0 || !comparator.isLess(approxResult.second, newResult[0]),
-                                     "New over-approximation " << newResult[0] << " is greater than old result "
+                    newResult = checkApproximationModel(model, property, upperValues);
+                    STORM_LOG_ASSERT(iteration == 0 || !comparator.isLess(approxResult.second, newResult),
+                                     "New over-approximation " << newResult << " is greater than old result "
                                                                << approxResult.second);
-                    approxResult.second = newResult[0];
+                    approxResult.second = newResult;
 
                     STORM_LOG_ASSERT(comparator.isLess(approxResult.first, approxResult.second) ||
                                      comparator.isEqual(approxResult.first, approxResult.second),
@@ -469,9 +741,17 @@ namespace storm {
             modelCheckingTimer.start();
             std::vector<ValueType> results;
 
-            // Check each property
+            // Time-bounded reachability properties that only differ in their time bound are checked together
+            std::vector<boost::optional<ValueType>> timeBoundedResults = checkTimeBoundedProperties(model, properties);
+
+            // Check each remaining property
             storm::utility::Stopwatch singleModelCheckingTimer;
-            for (auto property : properties) {
+            for (size_t i = 0; i < properties.size(); ++i) {
+                if (timeBoundedResults[i]) {
+                    results.push_back(timeBoundedResults[i].get());
+                    continue;
+                }
+                auto const& property = properties[i];
                 singleModelCheckingTimer.reset();
                 singleModelCheckingTimer.start();
                 //STORM_PRINT_AND_LOG("Model checking property " << *property << " ..." << std::endl);
@@ -495,6 +775,86 @@ namespace storm {
             return results;
         }
 
+        template<typename ValueType>
+        std::vector<boost::optional<ValueType>> DFTModelChecker<ValueType>::checkTimeBoundedProperties(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, property_vector const& properties) {
+            std::vector<boost::optional<ValueType>> results(properties.size());
+            storm::Environment env;
+            if (!storm::NumberTraits<ValueType>::SupportsExponential || !model->isOfType(storm::models::ModelType::Ctmc) || model->getInitialStates().getNumberOfSetBits() != 1) {
+                return results;
+            }
+            if (env.solver().isForceSoundness() && env.solver().timeBounded().getRelativeTerminationCriterion()) {
+                // Only the computation for a single time bound guarantees a relative precision
+                return results;
+            }
+
+            // Group the properties P=? [phi U<=t psi] by phi and psi
+            std::map<std::pair<std::string, std::string>, std::vector<size_t>> propertyGroups;
+            for (size_t i = 0; i < properties.size(); ++i) {
+                if (!properties[i]->isProbabilityOperatorFormula()) {
+                    continue;
+                }
+                storm::logic::ProbabilityOperatorFormula const& operatorFormula = properties[i]->asProbabilityOperatorFormula();
+                if (operatorFormula.hasBound() || !operatorFormula.getSubformula().isBoundedUntilFormula()) {
+                    continue;
+                }
+                storm::logic::BoundedUntilFormula const& pathFormula = operatorFormula.getSubformula().asBoundedUntilFormula();
+                if (pathFormula.isMultiDimensional() || !pathFormula.getTimeBoundReference().isTimeBound() || pathFormula.hasLowerBound() || !pathFormula.hasUpperBound()) {
+                    continue;
+                }
+                propertyGroups[std::make_pair(pathFormula.getLeftSubformula().toString(), pathFormula.getRightSubformula().toString())].push_back(i);
+            }
+
+            auto ctmc = model->template as<storm::models::sparse::Ctmc<ValueType>>();
+            storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<ValueType>> checker(*ctmc);
+            uint64_t initialState = *ctmc->getInitialStates().begin();
+            for (auto const& group : propertyGroups) {
+                if (group.second.size() < 2) {
+                    continue;
+                }
+                STORM_LOG_DEBUG("Checking " << group.second.size() << " time-bounded properties together.");
+                std::vector<double> upperBounds;
+                for (auto const& i : group.second) {
+                    upperBounds.push_back(properties[i]->asProbabilityOperatorFormula().getSubformula().asBoundedUntilFormula().template getNonStrictUpperBound<double>());
+                }
+                storm::logic::BoundedUntilFormula const& pathFormula = properties[group.second.front()]->asProbabilityOperatorFormula().getSubformula().asBoundedUntilFormula();
+                storm::storage::BitVector phiStates = checker.check(env, pathFormula.getLeftSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+                storm::storage::BitVector psiStates = checker.check(env, pathFormula.getRightSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+                std::vector<std::vector<ValueType>> values = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilities(env, ctmc->getTransitionMatrix(), ctmc->getBackwardTransitions(), phiStates, psiStates, ctmc->getExitRateVector(), upperBounds);
+                for (size_t j = 0; j < group.second.size(); ++j) {
+                    results[group.second[j]] = values[j][initialState];
+                }
+            }
+            return results;
+        }
+
+        template<typename ValueType>
+        ValueType DFTModelChecker<ValueType>::checkApproximationModel(std::shared_ptr<storm::models::sparse::Model<ValueType>>& model, std::shared_ptr<const storm::logic::Formula> const& property, std::vector<ValueType>& stateValues) {
+            if (!model->isOfType(storm::models::ModelType::Ctmc) || storm::settings::getModule<storm::settings::modules::GeneralSettings>().isBisimulationSet()) {
+                // Values of single states can only be reused if the model is a CTMC whose state space is not reduced
+                stateValues.clear();
+                std::vector<ValueType> results = checkModel(model, {property});
+                STORM_LOG_ASSERT(results.size() == 1, "Wrong size for result vector.");
+                return results[0];
+            }
+
+            STORM_LOG_DEBUG("Model checking...");
+            modelCheckingTimer.start();
+            auto task = storm::api::createTask<ValueType>(property, false);
+            if (stateValues.size() == model->getNumberOfStates()) {
+                STORM_LOG_DEBUG("Warm-starting model checking with results from previous iteration.");
+                auto hint = std::make_shared<storm::modelchecker::ExplicitModelCheckerHint<ValueType>>();
+                hint->setResultHint(std::move(stateValues));
+                task.setHint(hint);
+            }
+            std::unique_ptr<storm::modelchecker::CheckResult> result(storm::api::verifyWithSparseEngine<ValueType>(model, task));
+            STORM_LOG_THROW(result, storm::exceptions::NotSupportedException, "The property '" << *property << "' could not be checked with the current settings.");
+            stateValues = result->asExplicitQuantitativeCheckResult<ValueType>().getValueVector();
+            modelCheckingTimer.stop();
+            STORM_LOG_DEBUG("Model checking done.");
+            STORM_LOG_ASSERT(model->getInitialStates().getNumberOfSetBits() == 1, "Only one initial state assumed.");
+            return stateValues[*model->getInitialStates().begin()];
+        }
+
         template<typename ValueType>
         bool DFTModelChecker<ValueType>::isApproximationSufficient(ValueType, ValueType, double, bool) {
             STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "Approximation works only for double.");
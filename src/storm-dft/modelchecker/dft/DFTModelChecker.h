@@ -1,9 +1,13 @@
 #pragma  once
 
+#include <mutex>
+#include <unordered_map>
+
 #include "storm/logic/Formula.h"
 #include "storm/modelchecker/results/CheckResult.h"
 #include "storm/api/storm.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 
 #include "storm-dft/storage/dft/DFT.h"
 #include "storm-dft/utility/RelevantEvents.h"
@@ -36,8 +40,12 @@ namespace storm {
 
             /*!
              * Constructor.
+             *
+             * @param printOutput Flag indicating whether information should be printed.
+             * @param numberOfThreads Number of threads used to analyse independent modules concurrently.
              */
-            DFTModelChecker(bool printOutput) : printInfo(printOutput) {
+            DFTModelChecker(bool printOutput, uint64_t numberOfThreads = 1) : printInfo(printOutput), numberOfThreads(numberOfThreads), moduleCache(std::make_shared<ModuleCache>()) {
+                STORM_LOG_THROW(numberOfThreads > 0, storm::exceptions::InvalidArgumentException, "The number of threads must be positive.");
             }
 
             /*!
@@ -77,8 +85,24 @@ namespace storm {
 
         private:
 
+            /*!
+             * Results of already analysed modules.
+             * The cache is shared between the model checkers analysing modules concurrently.
+             */
+            struct ModuleCache {
+                std::mutex mutex;
+                // Maps the signature of a module together with the checked property to the result
+                std::unordered_map<std::string, ValueType> results;
+            };
+
             bool printInfo;
 
+            // Number of threads used for analysing modules
+            uint64_t numberOfThreads;
+
+            // Results of modules which were already analysed
+            std::shared_ptr<ModuleCache> moduleCache;
+
             // Timing values
             storm::utility::Stopwatch buildingTimer;
             storm::utility::Stopwatch explorationTimer;
@@ -106,6 +130,33 @@ namespace storm {
                                     double approximationError = 0.0, storm::builder::ApproximationHeuristic approximationHeuristic = storm::builder::ApproximationHeuristic::DEPTH,
                                     bool eliminateChains = false, storm::transformer::EliminationLabelBehavior labelBehavior = storm::transformer::EliminationLabelBehavior::KeepLabels);
 
+            /*!
+             * Check the given modules for the given property.
+             * The modules are analysed concurrently if multiple threads are allowed.
+             *
+             * @param modules Modules of the DFT.
+             * @param moduleIndices Indices of the modules which should be checked.
+             * @param property Property to check for.
+             * @param symred Flag indicating if symmetry reduction should be used.
+             * @param relevantEvents Relevant events which should be observed.
+             * @param allowDCForRelevant Whether to allow Don't Care propagation for relevant events
+             * @return Model checking results for the given modules (in the order of the given indices).
+             */
+            std::vector<ValueType> checkModules(std::vector<storm::storage::DFT<ValueType>> const& modules, std::vector<uint64_t> const& moduleIndices,
+                                                std::shared_ptr<storm::logic::Formula const> const& property, bool symred,
+                                                storm::utility::RelevantEvents const& relevantEvents, bool allowDCForRelevant);
+
+            /*!
+             * Compute a signature of the given DFT which is independent of the element names and element ids.
+             * Equal signatures imply that the DFTs are isomorphic and therefore yield the same results.
+             * The children of static gates are ordered by their structure such that isomorphic subtrees mostly obtain the same signature.
+             *
+             * @param dft DFT.
+             * @param relevantEvents Relevant events. Names of relevant events are part of the signature as properties can refer to them.
+             * @return Signature of the DFT.
+             */
+            static std::string computeModuleSignature(storm::storage::DFT<ValueType> const& dft, storm::utility::RelevantEvents const& relevantEvents);
+
             /*!
              * Internal helper for building a CTMC from a DFT via parallel composition.
              *
@@ -153,6 +204,30 @@ namespace storm {
              */
             std::vector<ValueType> checkModel(std::shared_ptr<storm::models::sparse::Model<ValueType>>& model, property_vector const& properties);
 
+            /*!
+             * Check all properties of the form P=? [phi U<=t psi] that only differ in the time bound t with a single transient analysis.
+             * This is only done for CTMCs and if at least two properties share phi and psi.
+             *
+             * @param model      Model to check
+             * @param properties Properties to check for
+             *
+             * @return For each property, the result if the property has been checked this way
+             */
+            std::vector<boost::optional<ValueType>> checkTimeBoundedProperties(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, property_vector const& properties);
+
+            /*!
+             * Check the given approximation model for a single property.
+             * If the values of all states are given, they are used as starting point for the computation.
+             * Afterwards, they are replaced by the computed values of all states (if available).
+             *
+             * @param model       Model to check.
+             * @param property    Property to check for.
+             * @param stateValues Values of all states used for warm-starting the computation. Contains the new values afterwards.
+             *
+             * @return Model checking result for the initial state.
+             */
+            ValueType checkApproximationModel(std::shared_ptr<storm::models::sparse::Model<ValueType>>& model, std::shared_ptr<const storm::logic::Formula> const& property, std::vector<ValueType>& stateValues);
+
             /*!
              * Checks if the computed approximation is sufficient, i.e.
              * upperBound - lowerBound <= approximationError * mean(lowerBound, upperBound).
@@ -18,6 +18,7 @@ namespace storm {
             const std::string FaultTreeSettings::noSymmetryReductionOptionName = "nosymmetryreduction";
             const std::string FaultTreeSettings::noSymmetryReductionOptionShortName = "nosymred";
             const std::string FaultTreeSettings::modularisationOptionName = "modularisation";
+            const std::string FaultTreeSettings::modularisationThreadsOptionName = "modularisation-threads";
             const std::string FaultTreeSettings::disableDCOptionName = "disabledc";
             const std::string FaultTreeSettings::allowDCRelevantOptionName = "allowdcrelevant";
             const std::string FaultTreeSettings::relevantEventsOptionName = "relevantevents";
@@ -36,6 +37,9 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, noSymmetryReductionOptionName, false, "Do not exploit symmetric structure of model.").setShortName(
                         noSymmetryReductionOptionShortName).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, modularisationOptionName, false, "Use modularisation (not applicable for expected time).").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, modularisationThreadsOptionName, false, "Sets how many threads analyse independent modules concurrently.").addArgument(
+                        storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads.").setDefaultValueUnsignedInteger(1).addValidatorUnsignedInteger(
+                                ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, disableDCOptionName, false, "Disable Don't Care propagation.").build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, firstDependencyOptionName, false,
                                                                "Avoid non-determinism by always taking the first possible dependency.").build());
@@ -72,6 +76,10 @@ namespace storm {
                 return this->getOption(modularisationOptionName).getHasOptionBeenSet();
             }
 
+            uint_fast64_t FaultTreeSettings::getModularisationThreads() const {
+                return this->getOption(modularisationThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+
             bool FaultTreeSettings::isDisableDC() const {
                 return this->getOption(disableDCOptionName).getHasOptionBeenSet();
             }
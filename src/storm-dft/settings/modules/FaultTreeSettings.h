@@ -33,6 +33,13 @@ namespace storm {
                  */
                 bool useModularisation() const;
 
+                /*!
+                 * Retrieves the number of threads used for analysing independent modules.
+                 *
+                 * @return Number of threads.
+                 */
+                uint_fast64_t getModularisationThreads() const;
+
                 /*!
                  * Retrieves whether the option to disable Dont Care propagation is set.
                  *
@@ -140,6 +147,7 @@ namespace storm {
                 static const std::string noSymmetryReductionOptionName;
                 static const std::string noSymmetryReductionOptionShortName;
                 static const std::string modularisationOptionName;
+                static const std::string modularisationThreadsOptionName;
                 static const std::string disableDCOptionName;
                 static const std::string allowDCRelevantOptionName;
                 static const std::string relevantEventsOptionName;
@@ -1,21 +1,26 @@
 #include "BucketPriorityQueue.h"
 #include "storm/utility/macros.h"
-#include "storm/adapters/RationalFunctionAdapter.h"
 
 #include <cmath>
 
 namespace storm {
     namespace storage {
 
-        template<typename PriorityType>
-        BucketPriorityQueue<PriorityType>::BucketPriorityQueue(size_t nrBuckets, double lowerValue, double ratio, bool higher) : buckets(nrBuckets), currentBucket(nrBuckets), nrUnsortedItems(0), lowerValue(lowerValue), higher(higher), logBase(std::log(ratio)), nrBuckets(nrBuckets) {
-            compare = ([](PriorityTypePointer a, PriorityTypePointer b) {
-                return *a < *b;
-            });
+        template<typename ItemType>
+        BucketPriorityQueue<ItemType>::BucketPriorityQueue(size_t nrBuckets, double lowerValue, double ratio, bool higher) : buckets(nrBuckets), currentBucket(nrBuckets), nrUnsortedItems(0), lowerValue(lowerValue), higher(higher), logBase(std::log(ratio)), nrBuckets(nrBuckets) {
+            if (higher) {
+                compare = ([](Entry const& a, Entry const& b) {
+                    return a.priority < b.priority;
+                });
+            } else {
+                compare = ([](Entry const& a, Entry const& b) {
+                    return a.priority > b.priority;
+                });
+            }
         }
 
-        template<typename PriorityType>
-        void BucketPriorityQueue<PriorityType>::fix() {
+        template<typename ItemType>
+        void BucketPriorityQueue<ItemType>::fix() {
             if (currentBucket < nrBuckets && nrUnsortedItems > buckets[currentBucket].size() / 10) {
                 // Sort current bucket
                 std::make_heap(buckets[currentBucket].begin(), buckets[currentBucket].end(), compare);
@@ -23,22 +28,22 @@ namespace storm {
             }
         }
 
-        template<typename PriorityType>
-        bool BucketPriorityQueue<PriorityType>::empty() const {
+        template<typename ItemType>
+        bool BucketPriorityQueue<ItemType>::empty() const {
             return currentBucket == nrBuckets && immediateBucket.empty();
         }
 
-        template<typename PriorityType>
-        size_t BucketPriorityQueue<PriorityType>::size() const {
+        template<typename ItemType>
+        size_t BucketPriorityQueue<ItemType>::size() const {
             size_t size = immediateBucket.size();
-            for (size_t i = currentBucket; currentBucket < nrBuckets; ++i) {
+            for (size_t i = currentBucket; i < nrBuckets; ++i) {
                 size += buckets[i].size();
             }
             return size;
         }
 
-        template<typename PriorityType>
-        typename BucketPriorityQueue<PriorityType>::PriorityTypePointer const& BucketPriorityQueue<PriorityType>::top() const {
+        template<typename ItemType>
+        typename BucketPriorityQueue<ItemType>::Entry const& BucketPriorityQueue<ItemType>::top() const {
             if (!immediateBucket.empty()) {
                 return immediateBucket.back();
             }
@@ -46,18 +51,19 @@ namespace storm {
             return buckets[currentBucket].front();
         }
 
-        template<typename PriorityType>
-        void BucketPriorityQueue<PriorityType>::push(PriorityTypePointer const& item) {
-            if (item->isExpand()) {
-                immediateBucket.push_back(item);
-                return;
-            }
-            size_t bucket = getBucket(item->getPriority());
+        template<typename ItemType>
+        void BucketPriorityQueue<ItemType>::pushImmediate(ItemType const& item) {
+            immediateBucket.push_back({0.0, item});
+        }
+
+        template<typename ItemType>
+        void BucketPriorityQueue<ItemType>::push(ItemType const& item, double priority) {
+            size_t bucket = getBucket(priority);
             if (bucket < currentBucket) {
                 currentBucket = bucket;
                 nrUnsortedItems = 0;
             }
-            buckets[bucket].push_back(item);
+            buckets[bucket].push_back({priority, item});
             if (bucket == currentBucket) {
                 // Inserted in first bucket
                 if (AUTOSORT) {
@@ -68,68 +74,23 @@ namespace storm {
             }
         }
 
-        template<typename PriorityType>
-        void BucketPriorityQueue<PriorityType>::update(PriorityTypePointer const& item, double oldPriority) {
-            STORM_LOG_ASSERT(!item->isExpand(), "Item is marked for expansion");
-            size_t newBucket = getBucket(item->getPriority());
-            size_t oldBucket = getBucket(oldPriority);
-
-            if (oldBucket == newBucket) {
-                if (currentBucket < newBucket) {
-                    // No change as the bucket is not sorted yet
-                } else {
-                    if (AUTOSORT) {
-                        // Sort first bucket
-                        fix();
-                    } else {
-                        ++nrUnsortedItems;
-                    }
-                }
-            } else {
-                // Move to new bucket
-                STORM_LOG_ASSERT(newBucket < oldBucket, "Will update item "<< item->getId() << " from " << oldBucket << " to higher bucket " << newBucket);
-                if (newBucket < currentBucket) {
-                    currentBucket = newBucket;
-                    nrUnsortedItems = 0;
-                }
-                // Remove old entry by swap-and-pop
-                if (buckets[oldBucket].size() >= 2) {
-                    // Find old index by linear search
-                    // Notice: using a map to remember index was not efficient
-                    size_t oldIndex = 0;
-                    for ( ; oldIndex < buckets[oldBucket].size(); ++oldIndex) {
-                        if (buckets[oldBucket][oldIndex]->getId() == item->getId()) {
-                            break;
-                        }
-                    }
-                    STORM_LOG_ASSERT(oldIndex < buckets[oldBucket].size(), "Id " << item->getId() << " not found");
-                    std::iter_swap(buckets[oldBucket].begin() + oldIndex, buckets[oldBucket].end() - 1);
-                }
-                buckets[oldBucket].pop_back();
-                // Insert new element
-                buckets[newBucket].push_back(item);
-                if (newBucket == currentBucket) {
-                    if (AUTOSORT) {
-                        // Sort in first bucket
-                        std::push_heap(buckets[currentBucket].begin(), buckets[currentBucket].end(), compare);
-                    } else {
-                        ++nrUnsortedItems;
-                    }
-                }
-            }
+        template<typename ItemType>
+        void BucketPriorityQueue<ItemType>::update(ItemType const& item, double priority) {
+            // Insert new entry. The old entry is outdated and skipped by the user of the queue.
+            // This avoids searching the old entry in its bucket.
+            push(item, priority);
         }
 
-
-        template<typename PriorityType>
-        typename BucketPriorityQueue<PriorityType>::PriorityTypePointer BucketPriorityQueue<PriorityType>::pop() {
+        template<typename ItemType>
+        typename BucketPriorityQueue<ItemType>::Entry BucketPriorityQueue<ItemType>::pop() {
             if (!immediateBucket.empty()) {
-                PriorityTypePointer item = immediateBucket.back();
+                Entry entry = immediateBucket.back();
                 immediateBucket.pop_back();
-                return item;
+                return entry;
             }
             STORM_LOG_ASSERT(!empty(), "BucketPriorityQueue is empty");
             std::pop_heap(buckets[currentBucket].begin(), buckets[currentBucket].end(), compare);
-            PriorityTypePointer item = buckets[currentBucket].back();
+            Entry entry = buckets[currentBucket].back();
             buckets[currentBucket].pop_back();
             if (buckets[currentBucket].empty()) {
                 // Find next bucket with elements
@@ -143,11 +104,11 @@ namespace storm {
                     }
                 }
             }
-            return item;
+            return entry;
         }
 
-        template<typename PriorityType>
-        size_t BucketPriorityQueue<PriorityType>::getBucket(double priority) const {
+        template<typename ItemType>
+        size_t BucketPriorityQueue<ItemType>::getBucket(double priority) const {
             STORM_LOG_ASSERT(priority >= lowerValue, "Priority " << priority << " is too low");
 
             // For possible values greater 1
@@ -168,27 +129,27 @@ namespace storm {
             return newBucket;
         }
 
-        template<typename PriorityType>
-        void BucketPriorityQueue<PriorityType>::print(std::ostream& out) const {
+        template<typename ItemType>
+        void BucketPriorityQueue<ItemType>::print(std::ostream& out) const {
             out << "Bucket priority queue with size " << buckets.size() << ", lower value: " << lowerValue << " and logBase: " << logBase << std::endl;
             out << "Immediate bucket: ";
-            for (auto item : immediateBucket) {
-                out << item->getId() << ", ";
+            for (auto const& entry : immediateBucket) {
+                out << entry.item << ", ";
             }
             out << std::endl;
             out << "Current bucket (" << currentBucket << ") has " << nrUnsortedItems  << " unsorted items" << std::endl;
             for (size_t bucket = 0; bucket < buckets.size(); ++bucket) {
                 if (!buckets[bucket].empty()) {
                     out << "Bucket " << bucket << ":" << std::endl;
-                    for (auto item : buckets[bucket]) {
-                        out << "\t" << item->getId() << ": " << item->getPriority() << std::endl;
+                    for (auto const& entry : buckets[bucket]) {
+                        out << "\t" << entry.item << ": " << entry.priority << std::endl;
                     }
                 }
             }
         }
 
-        template<typename PriorityType>
-        void BucketPriorityQueue<PriorityType>::printSizes(std::ostream& out) const {
+        template<typename ItemType>
+        void BucketPriorityQueue<ItemType>::printSizes(std::ostream& out) const {
             out << "Bucket sizes: " << immediateBucket.size() << " | ";
             for (size_t bucket = 0; bucket < buckets.size(); ++bucket) {
                 out << buckets[bucket].size() << " ";
@@ -197,16 +158,7 @@ namespace storm {
         }
 
         // Template instantiations
-        template class BucketPriorityQueue<storm::builder::DFTExplorationHeuristic<double>>;
-        template class BucketPriorityQueue<storm::builder::DFTExplorationHeuristicDepth<double>>;
-        template class BucketPriorityQueue<storm::builder::DFTExplorationHeuristicProbability<double>>;
-        template class BucketPriorityQueue<storm::builder::DFTExplorationHeuristicBoundDifference<double>>;
-
-#ifdef STORM_HAVE_CARL
-        template class BucketPriorityQueue<storm::builder::DFTExplorationHeuristic<storm::RationalFunction>>;
-        template class BucketPriorityQueue<storm::builder::DFTExplorationHeuristicDepth<storm::RationalFunction>>;
-        template class BucketPriorityQueue<storm::builder::DFTExplorationHeuristicProbability<storm::RationalFunction>>;
-        template class BucketPriorityQueue<storm::builder::DFTExplorationHeuristicBoundDifference<storm::RationalFunction>>;
-#endif
+        template class BucketPriorityQueue<uint32_t>;
+        template class BucketPriorityQueue<uint64_t>;
     }
 }
@@ -2,25 +2,34 @@
 
 #include <algorithm>
 #include <functional>
-#include <unordered_map>
+#include <ostream>
 #include <vector>
 
-#include "storm-dft/builder/DftExplorationHeuristic.h"
-
 namespace storm {
     namespace storage {
 
         /*!
          * Priority queue based on buckets.
          * Can be used to keep track of states during state space exploration.
-         * @tparam PriorityType Underlying priority data type
+         *
+         * The queue does not store pointers but only the items (e.g., state ids) together with their priority.
+         * Changing the priority of an item inserts a new entry; the old entry remains in the queue and is outdated.
+         * The user of the queue is responsible for skipping outdated entries, e.g., by comparing the returned priority with the current one.
+         *
+         * @tparam ItemType Type of the stored items.
          */
-        template<class PriorityType>
+        template<typename ItemType>
         class BucketPriorityQueue {
 
-            using PriorityTypePointer = std::shared_ptr<PriorityType>;
-
         public:
+            /*!
+             * Entry of the queue consisting of an item and its priority at the time of insertion.
+             */
+            struct Entry {
+                double priority;
+                ItemType item;
+            };
+
             /*!
              * Create new priority queue.
              * @param nrBuckets
@@ -32,6 +41,8 @@ namespace storm {
 
             BucketPriorityQueue(BucketPriorityQueue const& queue) = default;
 
+            BucketPriorityQueue& operator=(BucketPriorityQueue const& queue) = default;
+
             virtual ~BucketPriorityQueue() = default;
 
             void fix();
@@ -43,35 +54,43 @@ namespace storm {
             bool empty() const;
 
             /*!
-             * Return number of entries.
+             * Return number of entries (including outdated entries).
              * @return Size of queue.
              */
             std::size_t size() const;
 
             /*!
-             * Get element with highest priority.
-             * @return Top element.
+             * Get entry with highest priority.
+             * @return Top entry.
+             */
+            Entry const& top() const;
+
+            /*!
+             * Add item.
+             * @param item Item.
+             * @param priority Priority of the item.
              */
-            PriorityTypePointer const& top() const;
+            void push(ItemType const& item, double priority);
 
             /*!
-             * Add element.
-             * @param item Element.
+             * Add item which should be considered immediately, i.e., before all items with a priority.
+             * @param item Item.
              */
-            void push(PriorityTypePointer const& item);
+            void pushImmediate(ItemType const& item);
 
             /*!
-             * Update existing element.
-             * @param item Element with changes.
-             * @param oldPriority Old priority.
+             * Update priority of existing item.
+             * The previous entry of the item becomes outdated.
+             * @param item Item.
+             * @param priority New priority.
              */
-            void update(PriorityTypePointer const& item, double oldPriority);
+            void update(ItemType const& item, double priority);
 
             /*!
-             * Get element with highest priority and remove it from the queue.
-             * @return Top element.
+             * Get entry with highest priority and remove it from the queue.
+             * @return Top entry.
              */
-            PriorityTypePointer pop();
+            Entry pop();
 
             /*!
              * Print info about priority queue.
@@ -95,10 +114,10 @@ namespace storm {
             size_t getBucket(double priority) const;
 
             // List of buckets
-            std::vector<std::vector<PriorityTypePointer>> buckets;
+            std::vector<std::vector<Entry>> buckets;
 
             // Bucket containing all items which should be considered immediately
-            std::vector<PriorityTypePointer> immediateBucket;
+            std::vector<Entry> immediateBucket;
 
             // Index of first bucket which contains items
             size_t currentBucket;
@@ -107,7 +126,7 @@ namespace storm {
             size_t nrUnsortedItems;
 
             // Comparison function for priorities
-            std::function<bool(PriorityTypePointer, PriorityTypePointer)> compare;
+            std::function<bool(Entry const&, Entry const&)> compare;
 
             // Minimal value
             double lowerValue;
@@ -0,0 +1,60 @@
+#include "PackedStateStorage.h"
+
+#include <algorithm>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace storage {
+
+        PackedStateStorage::PackedStateStorage(uint64_t bitsPerState) : bitsPerState(bitsPerState), bucketsPerState((bitsPerState + 63) / 64) {
+            // Intentionally left empty
+        }
+
+        uint64_t PackedStateStorage::add(storm::storage::BitVector const& state) {
+            STORM_LOG_ASSERT(state.size() == bitsPerState, "Size of state " << state.size() << " does not match " << bitsPerState << ".");
+            uint64_t slot;
+            if (freeSlots.empty()) {
+                slot = bucketsPerState == 0 ? 0 : storage.size() / bucketsPerState;
+                storage.resize(storage.size() + bucketsPerState);
+            } else {
+                slot = freeSlots.back();
+                freeSlots.pop_back();
+            }
+            uint64_t offset = slot * bucketsPerState;
+            for (uint64_t bucket = 0; bucket < bucketsPerState; ++bucket) {
+                uint64_t startBit = bucket * 64;
+                storage[offset + bucket] = state.getAsInt(startBit, std::min<uint64_t>(64, bitsPerState - startBit));
+            }
+            return slot;
+        }
+
+        storm::storage::BitVector PackedStateStorage::get(uint64_t slot) const {
+            STORM_LOG_ASSERT((slot + 1) * bucketsPerState <= storage.size(), "Slot " << slot << " is not valid.");
+            storm::storage::BitVector state(bitsPerState);
+            uint64_t offset = slot * bucketsPerState;
+            for (uint64_t bucket = 0; bucket < bucketsPerState; ++bucket) {
+                uint64_t startBit = bucket * 64;
+                state.setFromInt(startBit, std::min<uint64_t>(64, bitsPerState - startBit), storage[offset + bucket]);
+            }
+            return state;
+        }
+
+        void PackedStateStorage::remove(uint64_t slot) {
+            STORM_LOG_ASSERT((slot + 1) * bucketsPerState <= storage.size(), "Slot " << slot << " is not valid.");
+            freeSlots.push_back(slot);
+        }
+
+        uint64_t PackedStateStorage::size() const {
+            if (bucketsPerState == 0) {
+                return 0;
+            }
+            return storage.size() / bucketsPerState - freeSlots.size();
+        }
+
+        uint64_t PackedStateStorage::getSizeInBytes() const {
+            return (storage.capacity() + freeSlots.capacity()) * sizeof(uint64_t);
+        }
+
+    }
+}
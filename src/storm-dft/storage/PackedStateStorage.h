@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * Pool storing bit vectors of a fixed size contiguously.
+         * Can be used to keep the status of states which still need to be explored without allocating memory for each state.
+         * Slots of removed bit vectors are reused for new ones.
+         */
+        class PackedStateStorage {
+
+        public:
+            /*!
+             * Create new storage.
+             * @param bitsPerState Size of each stored bit vector.
+             */
+            explicit PackedStateStorage(uint64_t bitsPerState);
+
+            /*!
+             * Add bit vector.
+             * @param state Bit vector. Its size must coincide with the size given in the constructor.
+             * @return Slot where the bit vector is stored.
+             */
+            uint64_t add(storm::storage::BitVector const& state);
+
+            /*!
+             * Get bit vector stored in the given slot.
+             * @param slot Slot.
+             * @return Bit vector.
+             */
+            storm::storage::BitVector get(uint64_t slot) const;
+
+            /*!
+             * Remove bit vector. The slot can be reused afterwards.
+             * @param slot Slot.
+             */
+            void remove(uint64_t slot);
+
+            /*!
+             * Return number of stored bit vectors.
+             * @return Number of bit vectors.
+             */
+            uint64_t size() const;
+
+            /*!
+             * Return number of bytes occupied by the storage.
+             * @return Number of bytes.
+             */
+            uint64_t getSizeInBytes() const;
+
+        private:
+            // Number of bits per stored bit vector
+            uint64_t bitsPerState;
+
+            // Number of 64-bit buckets per stored bit vector
+            uint64_t bucketsPerState;
+
+            // Contiguous storage of all bit vectors
+            std::vector<uint64_t> storage;
+
+            // Slots which are currently not used
+            std::vector<uint64_t> freeSlots;
+        };
+
+    }
+}
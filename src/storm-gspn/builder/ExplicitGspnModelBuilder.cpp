@@ -1,326 +1,389 @@
-//#include "storm/builder/ExplicitGspnModelBuilder.h"
-//
-//#include "storm/models/sparse/StandardRewardModel.h"
-//
-//#include "storm/utility/macros.h"
-//#include "storm/exceptions/NotImplementedException.h"
-//#include "storm/storage/expressions/ExpressionManager.h"
-//#include "storm-parsers/parser/FormulaParser.h"
-//#include "storm/storage/expressions/ExpressionEvaluator.h"
-//
-//namespace storm {
-//    namespace builder {
-//
-//        template<typename ValueType>
-//        storm::models::sparse::MarkovAutomaton<ValueType> ExplicitGspnModelBuilder<ValueType>::translateGspn(storm::gspn::GSPN const& gspn, std::string const& formula) {
-//            // set the given gspn and compute the limits of the net
-//            this->gspn = gspn;
-//            computeCapacities(gspn);
-//
-//            // markings maps markings to their corresponding rowgroups (indices)
-//            markings = storm::storage::BitVectorHashMap<uint_fast64_t>(numberOfTotalBits, 100);
-//            builder = storm::storage::SparseMatrixBuilder<double>(0, 0, 0, false, true);
-//
-//            // add initial marking to todo list
-//            auto bitvector = gspn.getInitialMarking(numberOfBits, numberOfTotalBits)->getBitVector();
-//            findOrAddBitvectorToMarkings(*bitvector);
-//            currentRowIndex = 0;
-//
-//            // vector marking markovian states (vector contains an 1 if the state is markovian)
-//            storm::storage::BitVector markovianStates(0);
-//
-//            // vector containing the exit rates for the markovian states
-//            std::vector<ValueType> exitRates;
-//
-//
-//            while (!todo.empty()) {
-//                // take next element from the todo list
-//                auto currentBitvector = todo.front();
-//                todo.pop_front();
-//                auto currentMarking = storm::gspn::Marking(gspn.getNumberOfPlaces(), numberOfBits, *currentBitvector);
-//
-//                // increment list of states by one
-//                markovianStates.resize(markovianStates.size() + 1, 0);
-//
-//                // create new row group for the current marking
-//                builder.newRowGroup(markings.getValue(*currentBitvector));
-//
-//                std::cout << "work on: " << *currentBitvector << std::endl;
-//
-//                auto enabledImmediateTransitions = getEnabledImmediateTransition(currentMarking);
-//                if (!enabledImmediateTransitions.empty()) {
-//                    markovianStates.set(currentRowIndex, 0);
-//                    exitRates.push_back(0);
-//
-//                    auto partitions = partitonEnabledImmediateTransitions(currentMarking, enabledImmediateTransitions);
-//                    addRowForPartitions(partitions, currentMarking);
-//                } else {
-//
-//                    auto enabledTimedTransitions = getEnabledTimedTransition(currentMarking);
-//                    if (!enabledTimedTransitions.empty()) {
-//                        markovianStates.set(currentRowIndex, 1);
-//
-//                        auto accRate = getAccumulatedRate(enabledTimedTransitions);
-//                        std::cout << "\t\tacc. rate: " << accRate << std::endl;
-//                        exitRates.push_back(accRate);
-//
-//                        addRowForTimedTransitions(enabledTimedTransitions, currentMarking, accRate);
-//                    } else {
-//                        markovianStates.set(currentRowIndex, 1);
-//                    }
-//                }
-//                ++currentRowIndex;
-//            }
-//
-//            auto matrix = builder.build();
-//
-//            // create expression manager and add variables from the gspn
-//            auto expressionManager = std::make_shared<storm::expressions::ExpressionManager>();
-//            for (auto& place : gspn.getPlaces()) {
-//                expressionManager->declareIntegerVariable(place.getName());
-//            }
-//
-//            // parse formula
-//            storm::parser::FormulaParser formulaParser(expressionManager);
-//            auto formulaPtr = formulaParser.parseSingleFormulaFromString(formula);
-//            auto atomicFormulas = formulaPtr->getAtomicExpressionFormulas();
-//
-//            // create empty state labeling
-//            storm::models::sparse::StateLabeling labeling(markings.size());
-//            storm::expressions::ExpressionEvaluator<double> expressionEvaluator(*expressionManager);
-//
-//            std::cout << std::endl;
-//            std::cout << "build labeling:" << std::endl;
-//            for (auto& atomicFormula : atomicFormulas) {
-//                std::cout << atomicFormula;
-//                auto label = atomicFormula->toString();
-//                labeling.addLabel(label);
-//
-//                for (auto statePair : markings) {
-//                    auto marking = storm::gspn::Marking(gspn.getNumberOfPlaces(), numberOfBits, statePair.first);
-//                    for (auto& place : gspn.getPlaces()) {
-//                        auto variable = expressionManager->getVariable(place.getName());
-//                        expressionEvaluator.setIntegerValue(variable, marking.getNumberOfTokensAt(place.getID()));
-//                    }
-//                    bool hold = expressionEvaluator.asBool(atomicFormula->getExpression());
-//                    if (hold) {
-//                        labeling.addLabelToState(label, statePair.second);
-//                    }
-//                }
-//
-//            }
-//
-//            //auto labeling = getStateLabeling();
-//
-//            return storm::models::sparse::MarkovAutomaton<double>(matrix, labeling, markovianStates, exitRates);
-//        }
-//
-//        template<typename ValueType>
-//        void ExplicitGspnModelBuilder<ValueType>::addRowForPartitions(std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>> const& partitions, storm::gspn::Marking const& currentMarking) {
-//            for (auto& partition : partitions) {
-//                std::cout << "\tnew partition:" << std::endl;
-//                auto accWeight = getAccumulatedWeight(partition);
-//                std::cout << "\t\tacc. weight: " << accWeight << std::endl;
-//
-//                std::map<uint_fast64_t , double, storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> weights;
-//                for (auto& trans : partition) {
-//                    std::cout << "\t\ttransname: " << trans.getName() << std::endl;
-//                    auto newMarking = trans.fire(currentMarking);
-//                    std::cout << "\t\t\t target marking: " << *newMarking.getBitVector() << std::endl;
-//
-//                    findOrAddBitvectorToMarkings(*newMarking.getBitVector());
-//
-//                    auto it = weights.find(markings.getValue(*newMarking.getBitVector()));
-//                    double currentWeight = 0;
-//                    if (it != weights.end()) {
-//                        currentWeight = weights.at(markings.getValue(*newMarking.getBitVector()));
-//                    }
-//                    currentWeight += trans.getWeight() / accWeight;
-//                    weights[markings.getValue(*newMarking.getBitVector())] = currentWeight;
-//                }
-//
-//                addValuesToBuilder(weights);
-//            }
-//        }
-//
-//        template<typename ValueType>
-//        void ExplicitGspnModelBuilder<ValueType>::addRowForTimedTransitions(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const& enabledTimedTransitions, storm::gspn::Marking const& currentMarking, double const& accRate) {
-//            std::map<uint_fast64_t , double, storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> rates;
-//            for (auto& trans : enabledTimedTransitions) {
-//                std::cout << "\t\ttransname: " << trans.getName() << std::endl;
-//                auto newMarking = trans.fire(currentMarking);
-//                std::cout << "\t\t\t target marking: " << *newMarking.getBitVector() << std::endl;
-//
-//                findOrAddBitvectorToMarkings(*newMarking.getBitVector());
-//
-//                auto it = rates.find(markings.getValue(*newMarking.getBitVector()));
-//                double currentWeightRate = 0;
-//                if (it != rates.end()) {
-//                    currentWeightRate = rates.at(markings.getValue(*newMarking.getBitVector()));
-//                }
-//                currentWeightRate += trans.getRate() / accRate;
-//                rates[markings.getValue(*newMarking.getBitVector())] = currentWeightRate;
-//
-//            }
-//
-//            addValuesToBuilder(rates);
-//        }
-//
-//        template<typename ValueType>
-//        void ExplicitGspnModelBuilder<ValueType>::addValuesToBuilder(std::map<uint_fast64_t , double, storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> const& values) {
-//            for (auto& it : values) {
-//                std::cout << "\t\tadd value \"" << it.second << "\" to " << getBitvector(it.first) << std::endl;
-//                builder.addNextValue(currentRowIndex, it.first, it.second);
-//            }
-//        }
-//
-//        template<typename ValueType>
-//        std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>> ExplicitGspnModelBuilder<ValueType>::partitonEnabledImmediateTransitions(
-//                storm::gspn::Marking const& marking,
-//                std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const& enabledImmediateTransitions) {
-//            decltype(partitonEnabledImmediateTransitions(marking, enabledImmediateTransitions)) result;
-//
-//            std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> weightedTransitions;
-//
-//            for (auto& trans : enabledImmediateTransitions) {
-//                if (trans.noWeightAttached()) {
-//                    decltype(weightedTransitions) singleton;
-//                    singleton.push_back(trans);
-//                    result.push_back(singleton);
-//                } else {
-//                    weightedTransitions.push_back(trans);
-//                }
-//            }
-//
-//            if (weightedTransitions.size() != 0) {
-//                result.push_back(weightedTransitions);
-//            }
-//
-//            return result;
-//        }
-//
-//        template<typename ValueType>
-//        double ExplicitGspnModelBuilder<ValueType>::getAccumulatedWeight(std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const& vector) const {
-//            double result = 0;
-//
-//            for (auto &trans : vector) {
-//                result += trans.getWeight();
-//            }
-//
-//            return result;
-//        }
-//
-//        template<typename ValueType>
-//        void ExplicitGspnModelBuilder<ValueType>::computeCapacities(storm::gspn::GSPN const& gspn) {
-//            uint_fast64_t sum = 0;
-//            for (auto& place : gspn.getPlaces()) {//TODO
-//                numberOfBits[place.getID()] = 1;
-//                sum += numberOfBits[place.getID()];
-//            }
-//
-//            // compute next multiple of 64
-//            uint_fast64_t rem = sum % 64;
-//            numberOfTotalBits = sum + 64 - rem;
-//        }
-//
-//        template<typename ValueType>
-//        std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> ExplicitGspnModelBuilder<ValueType>::getEnabledTimedTransition(
-//                storm::gspn::Marking const& marking) {
-//            std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>>result;
-//
-//            uint_fast64_t highestSeenPriority = 0;
-//
-//            for (auto& trans : gspn.getTimedTransitions()) {
-//                if (trans.isEnabled(marking)) {
-//                    if (trans.getPriority() > highestSeenPriority) {
-//                        highestSeenPriority = trans.getPriority();
-//                        result.clear();
-//                    }
-//                    result.push_back(trans);
-//                }
-//            }
-//
-//            return result;
-//        }
-//
-//        template<typename ValueType>
-//        std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> ExplicitGspnModelBuilder<ValueType>::getEnabledImmediateTransition(
-//                storm::gspn::Marking const& marking) {
-//            std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>result;
-//
-//            uint_fast64_t highestSeenPriority = 0;
-//
-//            for (auto& trans : gspn.getImmediateTransitions()) {
-//                if (trans.isEnabled(marking)) {
-//                    if (trans.getPriority() > highestSeenPriority) {
-//                        highestSeenPriority = trans.getPriority();
-//                        result.clear();
-//                    }
-//                    result.push_back(trans);
-//                }
-//            }
-//
-//            return result;
-//        }
-//
-//        template<typename ValueType>
-//        double ExplicitGspnModelBuilder<ValueType>::getAccumulatedRate(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const& vector) {
-//            double result = 0;
-//            for (auto trans : vector) {
-//                result += trans.getRate();
-//            }
-//
-//            return result;
-//        }
-//
-//        template<typename ValueType>
-//        storm::storage::BitVector ExplicitGspnModelBuilder<ValueType>::getBitvector(uint_fast64_t const& index) {
-//            for (auto it = markings.begin(); it != markings.end(); ++it) {
-//                if (std::get<1>(*it) == index) {
-//                    return std::get<0>(*it);
-//                }
-//            }
-//            return storm::storage::BitVector();
-//        }
-//
-//        template<typename ValueType>
-//        uint_fast64_t ExplicitGspnModelBuilder<ValueType>::findOrAddBitvectorToMarkings(storm::storage::BitVector const &bitvector) {
-//            auto index = markings.findOrAdd(bitvector, nextRowGroupIndex);
-//
-//            if (index == nextRowGroupIndex) {
-//                // bitvector was not already in the map
-//                ++nextRowGroupIndex;
-//                // bitvector was also never in the todo list
-//                todo.push_back(std::make_shared<storm::storage::BitVector>(bitvector));
-//            }
-//            return index;
-//        }
-//
-//        template<typename ValueType>
-//        storm::models::sparse::StateLabeling ExplicitGspnModelBuilder<ValueType>::getStateLabeling() const {
-//            storm::models::sparse::StateLabeling labeling(markings.size());
-//
-//            std::map<uint_fast64_t , std::string> idToName;
-//            for (auto& place : gspn.getPlaces()) {
-//                idToName[place.getID()] = place.getName();
-//                labeling.addLabel(place.getName());
-//            }
-//
-//            auto it = markings.begin();
-//            for ( ; it != markings.end() ; ++it) {
-//                auto bitvector = std::get<0>(*it);
-//                storm::gspn::Marking marking(gspn.getNumberOfPlaces(), numberOfBits, bitvector);
-//                for (auto i = 0; i < marking.getNumberOfPlaces(); i++) {
-//                    if (marking.getNumberOfTokensAt(i) > 0) {
-//                        std::cout << i << std::endl;
-//                        labeling.addLabelToState(idToName.at(i), i);
-//                    }
-//                }
-//            }
-//
-//            return labeling;
-//        }
-//
-//        template class ExplicitGspnModelBuilder<double>;
-//    }
-//}
+#include "ExplicitGspnModelBuilder.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/expressions/ExpressionEvaluator.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidModelException.h"
+
+namespace storm {
+    namespace builder {
+
+        template<typename ValueType>
+        ExplicitGspnModelBuilder<ValueType>::ExplicitGspnModelBuilder(storm::gspn::GSPN const& gspn, uint64_t bitsForUnboundedPlaces) : gspn(gspn), bitsForUnboundedPlaces(bitsForUnboundedPlaces), markingBits(0), numberOfImmediateTransitions(0) {
+            STORM_LOG_THROW(bitsForUnboundedPlaces > 0 && bitsForUnboundedPlaces < 64, storm::exceptions::InvalidArgumentException, "Number of bits for unbounded places must be between 1 and 63.");
+            computeMarkingLayout();
+            computeTransitionInfos();
+        }
+
+        template<typename ValueType>
+        void ExplicitGspnModelBuilder<ValueType>::computeMarkingLayout() {
+            placeBits.clear();
+            placeOffsets.clear();
+            placeCapacities.clear();
+            markingBits = 0;
+            for (auto const& place : gspn.getPlaces()) {
+                STORM_LOG_ASSERT(place.getID() == placeBits.size(), "Places are not ordered by their id.");
+                uint64_t bits = bitsForUnboundedPlaces;
+                uint64_t capacity = (1ull << bitsForUnboundedPlaces) - 1;
+                if (place.hasRestrictedCapacity()) {
+                    capacity = place.getCapacity();
+                    bits = 1;
+                    while (bits < 64 && (capacity >> bits) > 0) {
+                        ++bits;
+                    }
+                }
+                STORM_LOG_THROW(place.getNumberOfInitialTokens() <= capacity, storm::exceptions::InvalidModelException, "Initial number of tokens in place '" << place.getName() << "' exceeds its capacity.");
+                placeOffsets.push_back(markingBits);
+                placeBits.push_back(bits);
+                placeCapacities.push_back(capacity);
+                markingBits += bits;
+            }
+            // Reserve at least one bit such that the hash map can be used for nets without places
+            markings = storm::storage::BitVectorHashMap<uint64_t>(std::max<uint64_t>(markingBits, 1), 1000);
+        }
+
+        template<typename ValueType>
+        void ExplicitGspnModelBuilder<ValueType>::computeTransitionInfos() {
+            transitions.clear();
+            partitions.clear();
+            numberOfImmediateTransitions = gspn.getNumberOfImmediateTransitions();
+
+            auto createInfo = [](storm::gspn::Transition const& transition) {
+                TransitionInfo info;
+                for (auto const& input : transition.getInputPlaces()) {
+                    info.inputs.emplace_back(input.first, input.second);
+                }
+                for (auto const& inhibitor : transition.getInhibitionPlaces()) {
+                    info.inhibitors.emplace_back(inhibitor.first, inhibitor.second);
+                }
+                std::map<uint64_t, int64_t> delta;
+                for (auto const& input : transition.getInputPlaces()) {
+                    delta[input.first] -= static_cast<int64_t>(input.second);
+                }
+                for (auto const& output : transition.getOutputPlaces()) {
+                    delta[output.first] += static_cast<int64_t>(output.second);
+                }
+                for (auto const& change : delta) {
+                    if (change.second != 0) {
+                        info.delta.push_back(change);
+                    }
+                }
+                // Sort arcs by place to access the marking in order
+                std::sort(info.inputs.begin(), info.inputs.end());
+                std::sort(info.inhibitors.begin(), info.inhibitors.end());
+                return info;
+            };
+
+            for (auto const& transition : gspn.getImmediateTransitions()) {
+                TransitionInfo info = createInfo(transition);
+                info.value = storm::utility::convertNumber<ValueType>(transition.getWeight());
+                transitions.push_back(std::move(info));
+            }
+            for (auto const& transition : gspn.getTimedTransitions()) {
+                TransitionInfo info = createInfo(transition);
+                info.value = storm::utility::convertNumber<ValueType>(transition.getRate());
+                if (transition.hasInfiniteServerSemantics()) {
+                    STORM_LOG_THROW(!info.inputs.empty(), storm::exceptions::InvalidModelException, "Unclear semantics: Found a transition with infinite-server semantics and without input place.");
+                    info.servers = 0;
+                } else {
+                    info.servers = transition.getNumberOfServers();
+                }
+                transitions.push_back(std::move(info));
+            }
+
+            // Partitions of immediate transitions ordered by decreasing priority
+            uint64_t lastPriority = -1;
+            for (auto const& partition : gspn.getPartitions()) {
+                STORM_LOG_THROW(lastPriority >= partition.priority, storm::exceptions::InvalidModelException, "Partitions are not ordered by priority.");
+                lastPriority = partition.priority;
+                storm::gspn::TransitionPartition weightedPartition;
+                weightedPartition.priority = partition.priority;
+                for (auto const& transId : partition.transitions) {
+                    if (gspn.getImmediateTransitions()[transId].noWeightAttached()) {
+                        STORM_LOG_WARN("Immediate transition '" << gspn.getImmediateTransitions()[transId].getName() << "' has no weight attached and is ignored.");
+                        continue;
+                    }
+                    weightedPartition.transitions.push_back(transId);
+                }
+                if (!weightedPartition.transitions.empty()) {
+                    partitions.push_back(std::move(weightedPartition));
+                }
+            }
+
+            // Enabling index: transitions depending on each place
+            std::vector<std::vector<uint64_t>> dependentTransitions(gspn.getNumberOfPlaces());
+            for (uint64_t index = 0; index < transitions.size(); ++index) {
+                for (auto const& input : transitions[index].inputs) {
+                    dependentTransitions[input.first].push_back(index);
+                }
+                for (auto const& inhibitor : transitions[index].inhibitors) {
+                    dependentTransitions[inhibitor.first].push_back(index);
+                }
+            }
+            for (auto& transition : transitions) {
+                for (auto const& change : transition.delta) {
+                    auto const& dependent = dependentTransitions[change.first];
+                    transition.affected.insert(transition.affected.end(), dependent.begin(), dependent.end());
+                }
+                std::sort(transition.affected.begin(), transition.affected.end());
+                transition.affected.erase(std::unique(transition.affected.begin(), transition.affected.end()), transition.affected.end());
+            }
+        }
+
+        template<typename ValueType>
+        bool ExplicitGspnModelBuilder<ValueType>::isEnabled(TransitionInfo const& transition, std::vector<uint64_t> const& tokens) const {
+            for (auto const& input : transition.inputs) {
+                if (tokens[input.first] < input.second) {
+                    return false;
+                }
+            }
+            for (auto const& inhibitor : transition.inhibitors) {
+                if (tokens[inhibitor.first] >= inhibitor.second) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        template<typename ValueType>
+        storm::storage::BitVector ExplicitGspnModelBuilder<ValueType>::computeEnabled(std::vector<uint64_t> const& tokens) const {
+            storm::storage::BitVector enabled(transitions.size(), false);
+            for (uint64_t index = 0; index < transitions.size(); ++index) {
+                if (isEnabled(transitions[index], tokens)) {
+                    enabled.set(index);
+                }
+            }
+            return enabled;
+        }
+
+        template<typename ValueType>
+        storm::storage::BitVector ExplicitGspnModelBuilder<ValueType>::compress(std::vector<uint64_t> const& tokens) const {
+            storm::storage::BitVector marking(std::max<uint64_t>(markingBits, 1));
+            for (uint64_t place = 0; place < tokens.size(); ++place) {
+                marking.setFromInt(placeOffsets[place], placeBits[place], tokens[place]);
+            }
+            return marking;
+        }
+
+        template<typename ValueType>
+        void ExplicitGspnModelBuilder<ValueType>::decompress(storm::storage::BitVector const& marking, std::vector<uint64_t>& tokens) const {
+            tokens.resize(placeBits.size());
+            for (uint64_t place = 0; place < tokens.size(); ++place) {
+                tokens[place] = marking.getAsInt(placeOffsets[place], placeBits[place]);
+            }
+        }
+
+        template<typename ValueType>
+        uint64_t ExplicitGspnModelBuilder<ValueType>::findOrAddMarking(storm::storage::BitVector const& marking, storm::storage::BitVector&& enabled) {
+            uint64_t newIndex = markings.size();
+            uint64_t index = markings.findOrAdd(marking, newIndex);
+            if (index == newIndex) {
+                explorationQueue.emplace_back(marking, std::move(enabled));
+            }
+            return index;
+        }
+
+        template<typename ValueType>
+        uint64_t ExplicitGspnModelBuilder<ValueType>::fire(uint64_t transition, std::vector<uint64_t> const& tokens, storm::storage::BitVector const& enabled) {
+            TransitionInfo const& info = transitions[transition];
+            std::vector<uint64_t> successor = tokens;
+            for (auto const& change : info.delta) {
+                int64_t newTokens = static_cast<int64_t>(successor[change.first]) + change.second;
+                STORM_LOG_ASSERT(newTokens >= 0, "Negative number of tokens.");
+                STORM_LOG_THROW(static_cast<uint64_t>(newTokens) <= placeCapacities[change.first], storm::exceptions::InvalidModelException, "Number of tokens in place '" << gspn.getPlace(change.first)->getName() << "' exceeds its capacity of " << placeCapacities[change.first] << "." << (gspn.getPlace(change.first)->hasRestrictedCapacity() ? "" : " Set a capacity for the place."));
+                successor[change.first] = static_cast<uint64_t>(newTokens);
+            }
+
+            // Only re-check transitions affected by the changed places
+            storm::storage::BitVector successorEnabled = enabled;
+            for (auto const& affected : info.affected) {
+                successorEnabled.set(affected, isEnabled(transitions[affected], successor));
+            }
+            STORM_LOG_ASSERT(successorEnabled == computeEnabled(successor), "Incremental computation of enabled transitions is wrong.");
+            return findOrAddMarking(compress(successor), std::move(successorEnabled));
+        }
+
+        template<typename ValueType>
+        uint64_t ExplicitGspnModelBuilder<ValueType>::getEnablingDegree(TransitionInfo const& transition, std::vector<uint64_t> const& tokens) const {
+            if (transition.servers == 1) {
+                // Single server semantics
+                return 1;
+            }
+            // Infinite or k-server semantics
+            uint64_t degree = transition.servers == 0 ? std::numeric_limits<uint64_t>::max() : transition.servers;
+            for (auto const& input : transition.inputs) {
+                degree = std::min(degree, tokens[input.first] / input.second);
+            }
+            return degree;
+        }
+
+        template<typename ValueType>
+        std::shared_ptr<storm::models::sparse::Model<ValueType>> ExplicitGspnModelBuilder<ValueType>::build(std::map<std::string, storm::expressions::Expression> const& labelExpressions) {
+            bool hasTimed = gspn.getNumberOfTimedTransitions() > 0;
+            bool hasImmediate = numberOfImmediateTransitions > 0;
+            storm::models::ModelType modelType = storm::models::ModelType::MarkovAutomaton;
+            if (!hasTimed) {
+                modelType = storm::models::ModelType::Mdp;
+            } else if (!hasImmediate) {
+                modelType = storm::models::ModelType::Ctmc;
+            }
+            bool deterministic = modelType == storm::models::ModelType::Ctmc;
+
+            // Prepare evaluation of labels
+            storm::expressions::ExpressionEvaluator<double> evaluator(*gspn.getExpressionManager());
+            std::vector<storm::expressions::Variable> placeVariables;
+            if (!labelExpressions.empty()) {
+                for (auto const& place : gspn.getPlaces()) {
+                    placeVariables.push_back(gspn.getExpressionManager()->getVariable(place.getName()));
+                }
+            }
+            std::vector<std::pair<std::string, storm::expressions::Expression>> labels;
+            for (auto const& labelExpression : labelExpressions) {
+                STORM_LOG_THROW(labelExpression.first != "init" && labelExpression.first != "deadlock", storm::exceptions::InvalidArgumentException, "Label '" << labelExpression.first << "' is reserved.");
+                labels.emplace_back(labelExpression.first, labelExpression.second.substitute(gspn.getConstantsSubstitution()));
+            }
+            std::vector<std::vector<uint64_t>> labeledStates(labels.size());
+            std::vector<uint64_t> deadlockStates;
+
+            // Initial marking
+            markings = storm::storage::BitVectorHashMap<uint64_t>(std::max<uint64_t>(markingBits, 1), 1000);
+            explorationQueue.clear();
+            std::vector<uint64_t> tokens(gspn.getNumberOfPlaces());
+            for (auto const& place : gspn.getPlaces()) {
+                tokens[place.getID()] = place.getNumberOfInitialTokens();
+            }
+            uint64_t initialState = findOrAddMarking(compress(tokens), computeEnabled(tokens));
+            STORM_LOG_ASSERT(initialState == 0, "Initial state has wrong index.");
+
+            storm::storage::SparseMatrixBuilder<ValueType> matrixBuilder(0, 0, 0, false, !deterministic, 0);
+            storm::storage::BitVector markovianStates;
+            uint64_t currentState = 0;
+            uint64_t currentRow = 0;
+            std::map<uint64_t, ValueType> row;
+
+            while (!explorationQueue.empty()) {
+                std::pair<storm::storage::BitVector, storm::storage::BitVector> current = std::move(explorationQueue.front());
+                explorationQueue.pop_front();
+                storm::storage::BitVector const& enabled = current.second;
+                decompress(current.first, tokens);
+
+                if (!labels.empty()) {
+                    for (uint64_t place = 0; place < tokens.size(); ++place) {
+                        evaluator.setIntegerValue(placeVariables[place], tokens[place]);
+                    }
+                    for (uint64_t label = 0; label < labels.size(); ++label) {
+                        if (evaluator.asBool(labels[label].second)) {
+                            labeledStates[label].push_back(currentState);
+                        }
+                    }
+                }
+
+                if (!deterministic) {
+                    matrixBuilder.newRowGroup(currentRow);
+                }
+                markovianStates.grow(currentState + 1, false);
+
+                // Find immediate transitions with the highest enabled priority
+                bool foundImmediate = false;
+                uint64_t enabledPriority = 0;
+                for (auto const& partition : partitions) {
+                    if (foundImmediate && partition.priority < enabledPriority) {
+                        break;
+                    }
+                    ValueType totalWeight = storm::utility::zero<ValueType>();
+                    for (auto const& transition : partition.transitions) {
+                        if (enabled.get(transition)) {
+                            totalWeight += transitions[transition].value;
+                        }
+                    }
+                    if (storm::utility::isZero(totalWeight)) {
+                        continue;
+                    }
+                    foundImmediate = true;
+                    enabledPriority = partition.priority;
+                    row.clear();
+                    for (auto const& transition : partition.transitions) {
+                        if (enabled.get(transition)) {
+                            row[fire(transition, tokens, enabled)] += transitions[transition].value / totalWeight;
+                        }
+                    }
+                    for (auto const& entry : row) {
+                        matrixBuilder.addNextValue(currentRow, entry.first, entry.second);
+                    }
+                    ++currentRow;
+                }
+
+                if (!foundImmediate) {
+                    // Markovian state
+                    markovianStates.set(currentState);
+                    row.clear();
+                    for (uint64_t transition = enabled.getNextSetIndex(numberOfImmediateTransitions); transition < enabled.size(); transition = enabled.getNextSetIndex(transition + 1)) {
+                        TransitionInfo const& info = transitions[transition];
+                        if (storm::utility::isZero(info.value)) {
+                            continue;
+                        }
+                        ValueType rate = info.value * storm::utility::convertNumber<ValueType>(getEnablingDegree(info, tokens));
+                        row[fire(transition, tokens, enabled)] += rate;
+                    }
+                    if (row.empty()) {
+                        // Deadlock
+                        deadlockStates.push_back(currentState);
+                        row[currentState] = storm::utility::one<ValueType>();
+                    }
+                    for (auto const& entry : row) {
+                        matrixBuilder.addNextValue(currentRow, entry.first, entry.second);
+                    }
+                    ++currentRow;
+                }
+                ++currentState;
+            }
+
+            uint64_t numberOfStates = currentState;
+            STORM_LOG_ASSERT(numberOfStates == markings.size(), "Number of states does not match number of markings.");
+            STORM_LOG_DEBUG("GSPN has " << numberOfStates << " reachable markings.");
+
+            // Labeling
+            storm::models::sparse::StateLabeling labeling(numberOfStates);
+            labeling.addLabel("init");
+            labeling.addLabelToState("init", initialState);
+            labeling.addLabel("deadlock");
+            for (auto const& state : deadlockStates) {
+                labeling.addLabelToState("deadlock", state);
+            }
+            for (uint64_t label = 0; label < labels.size(); ++label) {
+                labeling.addLabel(labels[label].first);
+                for (auto const& state : labeledStates[label]) {
+                    labeling.addLabelToState(labels[label].first, state);
+                }
+            }
+
+            storm::storage::sparse::ModelComponents<ValueType> components(matrixBuilder.build(currentRow, numberOfStates, numberOfStates), std::move(labeling));
+            switch (modelType) {
+                case storm::models::ModelType::Ctmc:
+                    components.rateTransitions = true;
+                    return std::make_shared<storm::models::sparse::Ctmc<ValueType>>(std::move(components));
+                case storm::models::ModelType::Mdp:
+                    return std::make_shared<storm::models::sparse::Mdp<ValueType>>(std::move(components));
+                case storm::models::ModelType::MarkovAutomaton:
+                    components.rateTransitions = true;
+                    markovianStates.resize(numberOfStates);
+                    components.markovianStates = std::move(markovianStates);
+                    return std::make_shared<storm::models::sparse::MarkovAutomaton<ValueType>>(std::move(components));
+                default:
+                    STORM_LOG_THROW(false, storm::exceptions::InvalidModelException, "Unknown model type.");
+            }
+        }
+
+        template class ExplicitGspnModelBuilder<double>;
+    }
+}
@@ -1,172 +1,164 @@
-//#ifndef STORM_BUILDER_EXPLICITGSPNMODELBUILDER_H_
-//#define STORM_BUILDER_EXPLICITGSPNMODELBUILDER_H_
-//
-//#include <string>
-//
-//#include "storm/models/sparse/MarkovAutomaton.h"
-//#include "storm/models/sparse/StandardRewardModel.h"
-//#include "storm/storage/BitVector.h"
-//#include "storm/storage/BitVectorHashMap.h"
-//#include "storm/storage/gspn/GSPN.h"
-//#include "storm/storage/gspn/ImmediateTransition.h"
-//#include "storm/storage/gspn/TimedTransition.h"
-//
-//namespace storm {
-//    namespace builder {
-//
-//        /*!
-//         * This class provides the facilities for building an markov automaton.
-//         */
-//        template<typename ValueType=double>
-//        class ExplicitGspnModelBuilder {
-//        public:
-//
-//            /*!
-//             * Builds an MarkovAutomaton from the given GSPN.
-//             *
-//             * @param gspn The gspn whose semantic is covered by the MarkovAutomaton
-//             * @return The resulting MarkovAutomaton
-//             */
-//            storm::models::sparse::MarkovAutomaton<ValueType> translateGspn(storm::gspn::GSPN const& gspn, std::string const& formula);
-//        private:
-//
-//            /*!
-//             * Add for each partition a new row in the probability matrix.
-//             *
-//             * @param partitions The partitioned immediate transitions.
-//             * @param currentMarking The current marking which is considered at the moment.
-//             */
-//            void addRowForPartitions(std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>> const& partitions, storm::gspn::Marking const& currentMarking);
-//
-//
-//            /*!
-//             * Add row for a markovian state.
-//             *
-//             * @param enabledTimedTransitions List of enabled timed transitions.
-//             * @param currentMarking The current marking which is considered at the moment.
-//             * @param accRate The sum of all rates of the enabled timed transisitons
-//             */
-//            void addRowForTimedTransitions(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const& enabledTimedTransitions, storm::gspn::Marking const& currentMarking, double const& accRate);
-//
-//            /*!
-//             * Struct for comparing unsigned integer for maps
-//             */
-//            struct cmpByIndex {
-//                bool operator()(const uint_fast64_t &a, const uint_fast64_t &b) const {
-//                    return a < b;
-//                }
-//            };
-//
-//            /*!
-//             * This method insert the values from a map into the matrix
-//             *
-//             * @param values The values which are inserted
-//             */
-//            void addValuesToBuilder(std::map<uint_fast64_t , double, storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> const& values);
-//
-//
-//            /*!
-//             * This method partitions all enabled immediate transitions w.r.t. a marking.
-//             * All enabled weighted immediate transitions are in one vector. Between these transitions
-//             * is chosen probabilistically by the weights.
-//             *
-//             * All other enabled non-weighted immediate transitions are in an singleton vector.
-//             * Between different vectors is chosen non-deterministically.
-//             *
-//             * @param marking The current marking which is considered.
-//             * @param enabledImmediateTransistions A vector of enabled immediate transitions.
-//             * @return The vector of vectors which is described above.
-//             */
-//            std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>> partitonEnabledImmediateTransitions(storm::gspn::Marking const& marking, std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const& enabledImmediateTransitions);
-//
-//            /*!
-//             * Computes the accumulated weight of immediate transisions which are stored in a list.
-//             *
-//             * @param vector List of immediate transisitions.
-//             */
-//            double getAccumulatedWeight(std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const& vector) const;
-//
-//            /*!
-//             * Compute the upper bound for the number of tokens in each place.
-//             * Also computes the number of bits which are used to store a marking.
-//             *
-//             * @param gspn The corresponding gspn.
-//             */
-//            void computeCapacities(storm::gspn::GSPN const& gspn);
-//
-//            /*!
-//             * Returns the vector of enabled timed transition with the highest priority.
-//             *
-//             *
-//             * @param marking The current marking which is considered.
-//             * @return The vector of enabled timed transitions.
-//             */
-//            std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> getEnabledTimedTransition(
-//                    storm::gspn::Marking const& marking);
-//
-//            /*!
-//             * Returns the vector of active immediate transition with the highest priority.
-//             *
-//             * @param marking The current marking which is considered.
-//             * @return The vector of enabled immediate transitions.
-//             */
-//            std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> getEnabledImmediateTransition(
-//                    storm::gspn::Marking const& marking);
-//
-//            /*!
-//             * Computes the accumulated rate of a vector of timed transitions.
-//             *
-//             * @param vector The vector of timed transitions.
-//             * @return The accumulated rate.
-//             */
-//            double getAccumulatedRate(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const& vector);
-//
-//            // is only needed for debugging purposes
-//            // since markings is injective, we can determine the bitvector
-//            storm::storage::BitVector getBitvector(uint_fast64_t const& index);
-//
-//            /*!
-//             * Adds the bitvector to the marking-map.
-//             * If the bitvector corresponds to a new marking the bitvector is added to the todo list.
-//             *
-//             * @return The rowGroup index for the bitvector.
-//             */
-//            uint_fast64_t findOrAddBitvectorToMarkings(storm::storage::BitVector const& bitvector);
-//
-//            /*!
-//             * Computes the state labeling and returns it.
-//             * Every state is labeled with its name.
-//             *
-//             * @return The computed state labeling.
-//             */
-//            storm::models::sparse::StateLabeling getStateLabeling() const;
-//
-//
-//            // contains the number of bits which are used the store the number of tokens at each place
-//            std::map<uint_fast64_t, uint_fast64_t> numberOfBits;
-//
-//            // contains the number of bits used to create markings
-//            uint_fast64_t numberOfTotalBits;
-//
-//            // maps bitvectors (markings w.r.t. the capacity) to their rowgroup
-//            storm::storage::BitVectorHashMap<uint_fast64_t> markings = storm::storage::BitVectorHashMap<uint_fast64_t>(64, 1);
-//
-//            // a list of markings for which the outgoing edges need to be computed
-//            std::deque<std::shared_ptr<storm::storage::BitVector>> todo;
-//
-//            //the gspn which is transformed
-//            storm::gspn::GSPN gspn;
-//
-//            // the next index for a new rowgroup
-//            uint_fast64_t nextRowGroupIndex = 0;
-//
-//            // builder object which is used to create the probability matrix
-//            storm::storage::SparseMatrixBuilder<double> builder;
-//
-//            // contains the current row index during the computation
-//            uint_fast64_t currentRowIndex;
-//        };
-//    }
-//}
-//
-//#endif //STORM_BUILDER_EXPLICITGSPNMODELBUILDER_H_
+#pragma once
+
+#include <deque>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StateLabeling.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/expressions/Expression.h"
+
+#include "storm-gspn/storage/gspn/GSPN.h"
+#include "storm-gspn/storage/gspn/TransitionPartition.h"
+
+namespace storm {
+    namespace builder {
+
+        /*!
+         * Builds the explicit model of a GSPN by exploring the reachable markings directly on the net.
+         *
+         * Markings are compressed into bit vectors which use per place only as many bits as needed for its capacity.
+         * Transitions are preprocessed into flat lists of input, inhibition and firing changes.
+         * An enabling index stores for each transition the transitions whose enabledness might change by firing it.
+         * Thus, the enabled transitions of a successor marking are derived from the predecessor by only re-checking the affected transitions.
+         *
+         * The semantics coincide with the JANI translation in JaniGSPNBuilder:
+         * - Only immediate transitions with the highest enabled priority can fire. Each partition of them forms one choice,
+         *   in which the enabled transitions are chosen according to their weights.
+         * - Timed transitions can only fire if no immediate transition is enabled.
+         * - Markings without enabled transitions are deadlocks and get a self-loop.
+         */
+        template<typename ValueType = double>
+        class ExplicitGspnModelBuilder {
+        public:
+
+            /*!
+             * Constructor.
+             *
+             * @param gspn The GSPN.
+             * @param bitsForUnboundedPlaces Number of bits used to store the tokens of places without capacity.
+             */
+            ExplicitGspnModelBuilder(storm::gspn::GSPN const& gspn, uint64_t bitsForUnboundedPlaces = 16);
+
+            /*!
+             * Builds the model of the GSPN.
+             * The model is a CTMC if the GSPN has only timed transitions, an MDP if it has only immediate transitions and a Markov automaton otherwise.
+             * Each state is labeled with "init" and "deadlock" (where applicable) and with the given labels.
+             *
+             * @param labelExpressions Mapping from label names to Boolean expressions over the places of the GSPN.
+             * @return The model.
+             */
+            std::shared_ptr<storm::models::sparse::Model<ValueType>> build(std::map<std::string, storm::expressions::Expression> const& labelExpressions = {});
+
+        private:
+
+            /*!
+             * Preprocessed information of a single transition.
+             */
+            struct TransitionInfo {
+                // Pairs of places and the number of tokens needed to enable the transition.
+                std::vector<std::pair<uint64_t, uint64_t>> inputs;
+                // Pairs of places and the number of tokens which disable the transition.
+                std::vector<std::pair<uint64_t, uint64_t>> inhibitors;
+                // Pairs of places and the change of tokens when firing the transition.
+                std::vector<std::pair<uint64_t, int64_t>> delta;
+                // Transitions whose enabledness can change by firing this transition.
+                std::vector<uint64_t> affected;
+                // Number of servers of timed transitions, where 0 means infinite server semantics.
+                uint64_t servers = 1;
+                // Weight (immediate transitions) or rate (timed transitions).
+                ValueType value;
+            };
+
+            /*!
+             * Computes the number of bits for each place and the offsets of the places in a compressed marking.
+             */
+            void computeMarkingLayout();
+
+            /*!
+             * Preprocesses the transitions and computes the enabling index.
+             */
+            void computeTransitionInfos();
+
+            /*!
+             * Checks whether the given transition is enabled in the given marking.
+             */
+            bool isEnabled(TransitionInfo const& transition, std::vector<uint64_t> const& tokens) const;
+
+            /*!
+             * Computes all enabled transitions for the given marking.
+             */
+            storm::storage::BitVector computeEnabled(std::vector<uint64_t> const& tokens) const;
+
+            /*!
+             * Compresses the given token counts into a marking.
+             */
+            storm::storage::BitVector compress(std::vector<uint64_t> const& tokens) const;
+
+            /*!
+             * Decompresses the given marking into token counts.
+             */
+            void decompress(storm::storage::BitVector const& marking, std::vector<uint64_t>& tokens) const;
+
+            /*!
+             * Fires the given transition and returns the index of the successor marking.
+             * New markings are added to the exploration queue together with their enabled transitions.
+             *
+             * @param transition Index of the transition.
+             * @param tokens Token counts of the current marking.
+             * @param enabled Enabled transitions in the current marking.
+             * @return Index of the successor marking.
+             */
+            uint64_t fire(uint64_t transition, std::vector<uint64_t> const& tokens, storm::storage::BitVector const& enabled);
+
+            /*!
+             * Returns the index of the given marking and adds it to the exploration queue if it is new.
+             */
+            uint64_t findOrAddMarking(storm::storage::BitVector const& marking, storm::storage::BitVector&& enabled);
+
+            /*!
+             * Computes the enabling degree of the given timed transition in the given marking.
+             */
+            uint64_t getEnablingDegree(TransitionInfo const& transition, std::vector<uint64_t> const& tokens) const;
+
+            // The GSPN.
+            storm::gspn::GSPN const& gspn;
+
+            // Number of bits used for places without capacity.
+            uint64_t bitsForUnboundedPlaces;
+
+            // Number of bits for each place in a compressed marking.
+            std::vector<uint64_t> placeBits;
+
+            // Offset of each place in a compressed marking.
+            std::vector<uint64_t> placeOffsets;
+
+            // Maximal number of tokens in each place.
+            std::vector<uint64_t> placeCapacities;
+
+            // Number of bits of a compressed marking.
+            uint64_t markingBits;
+
+            // Information of all transitions. Immediate transitions come first, timed transitions afterwards.
+            std::vector<TransitionInfo> transitions;
+
+            // Number of immediate transitions.
+            uint64_t numberOfImmediateTransitions;
+
+            // Partitions of immediate transitions ordered by decreasing priority. Only contains weighted transitions.
+            std::vector<storm::gspn::TransitionPartition> partitions;
+
+            // Mapping from compressed markings to state indices.
+            storm::storage::BitVectorHashMap<uint64_t> markings;
+
+            // Markings which still need to be explored together with their enabled transitions.
+            std::deque<std::pair<storm::storage::BitVector, storm::storage::BitVector>> explorationQueue;
+        };
+
+    }
+}
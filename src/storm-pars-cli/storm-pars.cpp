@@ -54,7 +54,7 @@ namespace storm {
 
         template <typename ValueType>
         struct SampleInformation {
-            SampleInformation(bool graphPreserving = false, bool exact = false) : graphPreserving(graphPreserving), exact(exact) {
+            SampleInformation(bool graphPreserving = false, bool exact = false) : graphPreserving(graphPreserving), exact(exact), numberOfThreads(1) {
                 // Intentionally left empty.
             }
 
@@ -65,6 +65,7 @@ namespace storm {
             std::vector<std::map<typename utility::parametric::VariableType<ValueType>::type, std::vector<typename utility::parametric::CoefficientType<ValueType>::type>>> cartesianProducts;
             bool graphPreserving;
             bool exact;
+            uint64_t numberOfThreads;
         };
 
         struct PreprocessResult {
@@ -443,6 +444,10 @@ namespace storm {
                 std::vector<typename std::vector<typename utility::parametric::CoefficientType<ValueType>::type>::const_iterator> iterators;
                 std::vector<typename std::vector<typename utility::parametric::CoefficientType<ValueType>::type>::const_iterator> iteratorEnds;
 
+                // If several threads are used, the valuations are collected first and then checked in one batch.
+                bool checkInParallel = samples.numberOfThreads > 1;
+                std::vector<storm::utility::parametric::Valuation<ValueType>> valuations;
+
                 storm::utility::Stopwatch watch(true);
                 for (auto const& product : samples.cartesianProducts) {
                     parameters.clear();
@@ -462,14 +467,18 @@ namespace storm {
                             valuation[parameters[i]] = *iterators[i];
                         }
 
-                        storm::utility::Stopwatch valuationWatch(true);
-                        std::unique_ptr<storm::modelchecker::CheckResult> result = modelchecker.check(Environment(), valuation);
-                        valuationWatch.stop();
+                        if (checkInParallel) {
+                            valuations.push_back(valuation);
+                        } else {
+                            storm::utility::Stopwatch valuationWatch(true);
+                            std::unique_ptr<storm::modelchecker::CheckResult> result = modelchecker.check(Environment(), valuation);
+                            valuationWatch.stop();
 
-                        if (result) {
-                            result->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model.getInitialStates()));
+                            if (result) {
+                                result->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model.getInitialStates()));
+                            }
+                            printInitialStatesResult<ValueType>(result, property, &valuationWatch, &valuation);
                         }
-                        printInitialStatesResult<ValueType>(result, property, &valuationWatch, &valuation);
 
                         for (uint64_t i = 0; i < parameters.size(); ++i) {
                             ++iterators[i];
@@ -490,6 +499,16 @@ namespace storm {
                     }
                 }
 
+                if (checkInParallel) {
+                    std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results = modelchecker.checkValuations(Environment(), valuations, samples.numberOfThreads);
+                    for (uint64_t i = 0; i < valuations.size(); ++i) {
+                        if (results[i]) {
+                            results[i]->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model.getInitialStates()));
+                        }
+                        printInitialStatesResult<ValueType>(results[i], property, nullptr, &valuations[i]);
+                    }
+                }
+
                 watch.stop();
                 STORM_PRINT_AND_LOG("Overall time for sampling all instances: " << watch << std::endl << std::endl);
             }
@@ -557,6 +576,7 @@ namespace storm {
             STORM_LOG_THROW(regions.size() <= 1, storm::exceptions::InvalidArgumentException, "Monotonicity analysis only allowed on single region");
             if (!monSettings.isMonSolutionSet()) {
                 auto monotonicityHelper = storm::analysis::MonotonicityHelper<ValueType, double>(model, formulas, regions, monSettings.getNumberOfSamples(), storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision(), monSettings.isDotOutputSet());
+                monotonicityHelper.setNumberOfAssumptionThreads(monSettings.getNumberOfAssumptionThreads());
                 if (monSettings.isExportMonotonicitySet()) {
                     monotonicityHelper.checkMonotonicityInBuild(outfile, monSettings.isUsePLABoundsSet(), monSettings.getDotOutputFilename());
                 } else {
@@ -707,7 +727,7 @@ namespace storm {
                         optionalDepthLimit = regionSettings.getDepthLimit();
                     }
                     // TODO @Jip: change allow model simplification when not using monotonicity, for benchmarking purposes simplification is moved forward.
-                    std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> result = storm::api::checkAndRefineRegionWithSparseEngine<ValueType>(model, storm::api::createTask<ValueType>(formula, true), regions.front(), engine, refinementThreshold, optionalDepthLimit, regionSettings.getHypothesis(), false, monotonicitySettings, monThresh);
+                    std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> result = storm::api::checkAndRefineRegionWithSparseEngine<ValueType>(model, storm::api::createTask<ValueType>(formula, true), regions.front(), engine, refinementThreshold, optionalDepthLimit, regionSettings.getHypothesis(), false, monotonicitySettings, monThresh, regionSettings.getRefinementThreads());
                     return result;
                 };
             } else {
@@ -839,6 +859,7 @@ namespace storm {
                 samples = parseSamples<ValueType>(model, samplesAsString,
                                                   parSettings.isSamplesAreGraphPreservingSet());
                 samples.exact = parSettings.isSampleExactSet();
+                samples.numberOfThreads = parSettings.getSampleThreadCount();
             }
 
             if (model) {
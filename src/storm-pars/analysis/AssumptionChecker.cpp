@@ -11,6 +11,7 @@
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/expressions/VariableExpression.h"
 #include "storm/storage/expressions/RationalFunctionToExpression.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
     namespace analysis {
@@ -73,6 +74,70 @@ namespace storm {
 
         template <typename ValueType, typename ConstantType>
         AssumptionStatus AssumptionChecker<ValueType, ConstantType>::validateAssumption(uint_fast64_t val1, uint_fast64_t val2,std::shared_ptr<expressions::BinaryRelationExpression> assumption, std::shared_ptr<Order> order, storage::ParameterRegion<ValueType> region, std::vector<ConstantType>const minValues, std::vector<ConstantType>const maxValues) const {
+            AssumptionStatus result = validateAssumptionWithoutSMTSolver(val1, val2, assumption, minValues, maxValues);
+            if (result == AssumptionStatus::UNKNOWN) {
+                // If result from sample checking was unknown, the assumption might hold
+                STORM_LOG_THROW(assumption->getRelationType() ==
+                                expressions::BinaryRelationExpression::RelationType::Greater ||
+                                assumption->getRelationType() ==
+                                expressions::BinaryRelationExpression::RelationType::Equal,
+                                exceptions::NotSupportedException,
+                                "Only Greater Or Equal assumptions supported");
+                result = validateAssumptionSMTSolver(val1, val2, assumption, order, region, minValues, maxValues);
+            }
+            return result;
+        }
+
+        template <typename ValueType, typename ConstantType>
+        std::vector<AssumptionStatus> AssumptionChecker<ValueType, ConstantType>::validateAssumptions(uint_fast64_t val1, uint_fast64_t val2, std::vector<std::shared_ptr<expressions::BinaryRelationExpression>> const& assumptions, std::shared_ptr<Order> order, storage::ParameterRegion<ValueType> region, std::vector<ConstantType> const& minValues, std::vector<ConstantType> const& maxValues, uint_fast64_t numberOfThreads) const {
+            std::vector<AssumptionStatus> result;
+            result.reserve(assumptions.size());
+            std::vector<uint_fast64_t> assumptionsForSMTSolver;
+            for (uint_fast64_t i = 0; i < assumptions.size(); ++i) {
+                auto const& assumption = assumptions[i];
+                STORM_LOG_THROW(assumption->getRelationType() ==
+                                expressions::BinaryRelationExpression::RelationType::Greater ||
+                                assumption->getRelationType() ==
+                                expressions::BinaryRelationExpression::RelationType::Equal,
+                                exceptions::NotSupportedException,
+                                "Only Greater Or Equal assumptions supported");
+                bool swapped = std::stoull(assumption->getFirstOperand()->asVariableExpression().getVariableName()) != val1;
+                result.push_back(swapped ? validateAssumptionWithoutSMTSolver(val2, val1, assumption, minValues, maxValues) : validateAssumptionWithoutSMTSolver(val1, val2, assumption, minValues, maxValues));
+                if (result.back() == AssumptionStatus::UNKNOWN) {
+                    assumptionsForSMTSolver.push_back(i);
+                }
+            }
+            if (assumptionsForSMTSolver.empty()) {
+                return result;
+            }
+
+            // The constraints on the successors are the same for all assumptions.
+            // Creating them might extend the order, so this is not done in parallel.
+            SmtEncoding encoding = createSmtEncoding(val1, val2, order, region, minValues, maxValues);
+            if (!encoding.orderKnown) {
+                return result;
+            }
+            // The expressions to check are the negations of the assumptions
+            std::vector<expressions::Expression> exprsToCheck;
+            for (auto const& i : assumptionsForSMTSolver) {
+                auto const& assumption = assumptions[i];
+                if (assumption->getRelationType() == expressions::BinaryRelationExpression::RelationType::Greater) {
+                    bool swapped = std::stoull(assumption->getFirstOperand()->asVariableExpression().getVariableName()) != val1;
+                    exprsToCheck.push_back(swapped ? encoding.expr2 <= encoding.expr1 : encoding.expr1 <= encoding.expr2);
+                } else {
+                    exprsToCheck.push_back(encoding.expr1 != encoding.expr2);
+                }
+            }
+
+            // Each solver works on its own Z3 context and only reads the (shared) expressions.
+            storm::utility::parallel::parallelFor(exprsToCheck.size(), numberOfThreads, [&] (uint64_t j) {
+                result[assumptionsForSMTSolver[j]] = checkSmtEncoding(encoding, exprsToCheck[j]);
+            });
+            return result;
+        }
+
+        template <typename ValueType, typename ConstantType>
+        AssumptionStatus AssumptionChecker<ValueType, ConstantType>::validateAssumptionWithoutSMTSolver(uint_fast64_t val1, uint_fast64_t val2, std::shared_ptr<expressions::BinaryRelationExpression> assumption, std::vector<ConstantType> const& minValues, std::vector<ConstantType> const& maxValues) const {
             // First check if based on sample points the assumption can be discharged
             assert (val1 == std::stoull(assumption->getFirstOperand()->asVariableExpression().getVariableName()));
             assert (val2 == std::stoull(assumption->getSecondOperand()->asVariableExpression().getVariableName()));
@@ -101,20 +166,6 @@ namespace storm {
                     }
                 }
             }
-
-            if (result == AssumptionStatus::UNKNOWN) {
-                // If result from sample checking was unknown, the assumption might hold
-                std::set<expressions::Variable> vars = std::set<expressions::Variable>({});
-                assumption->gatherVariables(vars);
-
-                STORM_LOG_THROW(assumption->getRelationType() ==
-                                expressions::BinaryRelationExpression::RelationType::Greater ||
-                                assumption->getRelationType() ==
-                                expressions::BinaryRelationExpression::RelationType::Equal,
-                                exceptions::NotSupportedException,
-                                "Only Greater Or Equal assumptions supported");
-                result = validateAssumptionSMTSolver(val1, val2, assumption, order, region, minValues, maxValues);
-            }
             return result;
         }
 
@@ -140,12 +191,10 @@ namespace storm {
         }
 
         template <typename ValueType, typename ConstantType>
-        AssumptionStatus AssumptionChecker<ValueType, ConstantType>::validateAssumptionSMTSolver(uint_fast64_t val1, uint_fast64_t val2, std::shared_ptr<expressions::BinaryRelationExpression> assumption, std::shared_ptr<Order> order, storage::ParameterRegion<ValueType> region, std::vector<ConstantType>const minValues, std::vector<ConstantType>const maxValues) const {
-            std::shared_ptr<utility::solver::SmtSolverFactory> smtSolverFactory = std::make_shared<utility::solver::MathsatSmtSolverFactory>();
+        typename AssumptionChecker<ValueType, ConstantType>::SmtEncoding AssumptionChecker<ValueType, ConstantType>::createSmtEncoding(uint_fast64_t val1, uint_fast64_t val2, std::shared_ptr<Order> order, storage::ParameterRegion<ValueType> const& region, std::vector<ConstantType> const& minValues, std::vector<ConstantType> const& maxValues) const {
             std::shared_ptr<expressions::ExpressionManager> manager(new expressions::ExpressionManager());
-            AssumptionStatus result = AssumptionStatus::UNKNOWN;
-            auto var1 = assumption->getFirstOperand()->asVariableExpression().getVariableName();
-            auto var2 = assumption->getSecondOperand()->asVariableExpression().getVariableName();
+            auto var1 = std::to_string(val1);
+            auto var2 = std::to_string(val2);
             auto row1 = matrix.getRow(val1);
             auto row2 = matrix.getRow(val2);
 
@@ -225,8 +274,11 @@ namespace storm {
                 }
             }
 
+            SmtEncoding encoding;
+            encoding.manager = manager;
+            encoding.orderKnown = orderKnown;
+            encoding.exprOrderSucc = exprOrderSucc;
             if (orderKnown) {
-                solver::Z3SmtSolver s(*manager);
                 auto valueTypeToExpression = expressions::RationalFunctionToExpression<ValueType>(manager);
                 expressions::Expression expr1 = manager->rational(0);
                 for (auto itr1 = row1.begin(); itr1 != row1.end(); ++itr1) {
@@ -240,17 +292,6 @@ namespace storm {
                                      manager->getVariable("s" + std::to_string(itr2->getColumn())));
                 }
 
-                // Create expression for the assumption based on the relation to successors
-                // It is the negation of actual assumption
-
-                expressions::Expression exprToCheck;
-                if (assumption->getRelationType() == expressions::BinaryRelationExpression::RelationType::Greater) {
-                    exprToCheck = expr1 <= expr2;
-                } else {
-                    assert (assumption->getRelationType() == expressions::BinaryRelationExpression::RelationType::Equal);
-                    exprToCheck = expr1 != expr2;
-                }
-
                 auto variables = manager->getVariables();
                 // Bounds for the state probabilities and parameters
                 expressions::Expression exprBounds = manager->boolean(true);
@@ -285,28 +326,55 @@ namespace storm {
                         exprBounds = exprBounds && manager->rational(lb) < var && var < manager->rational(ub);
                     }
                 }
+                encoding.exprBounds = exprBounds;
+                encoding.expr1 = expr1;
+                encoding.expr2 = expr2;
+            }
+            return encoding;
+        }
 
-                s.add(exprOrderSucc);
-                s.add(exprBounds);
-                s.setTimeout(100);
-                // assert that sorting of successors in the order and the bounds on the expression are at least satisfiable
-                // when this is not the case, the order is invalid
-                // however, it could be that the sat solver didn't finish in time, in that case we just continue.
-                if (s.check() == solver::SmtSolver::CheckResult::Unsat) {
-                    return AssumptionStatus::INVALID;
-                }
-                assert (s.check() != solver::SmtSolver::CheckResult::Unsat);
+        template <typename ValueType, typename ConstantType>
+        AssumptionStatus AssumptionChecker<ValueType, ConstantType>::checkSmtEncoding(SmtEncoding const& encoding, expressions::Expression const& exprToCheck) const {
+            assert (encoding.orderKnown);
+            solver::Z3SmtSolver s(*encoding.manager);
+            s.add(encoding.exprOrderSucc);
+            s.add(encoding.exprBounds);
+            s.setTimeout(100);
+            // assert that sorting of successors in the order and the bounds on the expression are at least satisfiable
+            // when this is not the case, the order is invalid
+            // however, it could be that the sat solver didn't finish in time, in that case we just continue.
+            if (s.check() == solver::SmtSolver::CheckResult::Unsat) {
+                return AssumptionStatus::INVALID;
+            }
 
-                s.add(exprToCheck);
-                auto smtRes = s.check();
-                if (smtRes == solver::SmtSolver::CheckResult::Unsat) {
-                    // If there is no thing satisfying the negation we are safe.
-                    result = AssumptionStatus::VALID;
-                } else if (smtRes == solver::SmtSolver::CheckResult::Sat) {
-                        result = AssumptionStatus::INVALID;
-                }
+            s.add(exprToCheck);
+            auto smtRes = s.check();
+            if (smtRes == solver::SmtSolver::CheckResult::Unsat) {
+                // If there is no thing satisfying the negation we are safe.
+                return AssumptionStatus::VALID;
+            } else if (smtRes == solver::SmtSolver::CheckResult::Sat) {
+                return AssumptionStatus::INVALID;
             }
-            return result;
+            return AssumptionStatus::UNKNOWN;
+        }
+
+        template <typename ValueType, typename ConstantType>
+        AssumptionStatus AssumptionChecker<ValueType, ConstantType>::validateAssumptionSMTSolver(uint_fast64_t val1, uint_fast64_t val2, std::shared_ptr<expressions::BinaryRelationExpression> assumption, std::shared_ptr<Order> order, storage::ParameterRegion<ValueType> region, std::vector<ConstantType>const minValues, std::vector<ConstantType>const maxValues) const {
+            SmtEncoding encoding = createSmtEncoding(val1, val2, order, region, minValues, maxValues);
+            if (!encoding.orderKnown) {
+                return AssumptionStatus::UNKNOWN;
+            }
+
+            // Create expression for the assumption based on the relation to successors
+            // It is the negation of actual assumption
+            expressions::Expression exprToCheck;
+            if (assumption->getRelationType() == expressions::BinaryRelationExpression::RelationType::Greater) {
+                exprToCheck = encoding.expr1 <= encoding.expr2;
+            } else {
+                assert (assumption->getRelationType() == expressions::BinaryRelationExpression::RelationType::Equal);
+                exprToCheck = encoding.expr1 != encoding.expr2;
+            }
+            return checkSmtEncoding(encoding, exprToCheck);
         }
 
         template<typename ValueType, typename ConstantType>
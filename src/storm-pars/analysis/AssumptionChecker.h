@@ -72,7 +72,40 @@ namespace storm {
             AssumptionStatus validateAssumption(uint_fast64_t val1, uint_fast64_t val2, std::shared_ptr<expressions::BinaryRelationExpression> assumption, std::shared_ptr<Order> order, storage::ParameterRegion<ValueType> region,  std::vector<ConstantType> const minValues, std::vector<ConstantType> const maxValue) const;
             AssumptionStatus validateAssumption(std::shared_ptr<expressions::BinaryRelationExpression> assumption, std::shared_ptr<Order> order, storage::ParameterRegion<ValueType> region) const;
 
+            /*!
+             * Tries to validate several assumptions on the relation between the same two states.
+             * The constraints on the successors of the two states are only built once and the remaining SMT queries are solved by the given number of threads.
+             *
+             * @param val1 First state number.
+             * @param val2 Second state number.
+             * @param assumptions The assumptions to validate, each of them relates val1 and val2 (in any direction).
+             * @param order The order.
+             * @param region The region of the considered model.
+             * @param numberOfThreads The number of threads that solve the SMT queries.
+             * @return For each assumption AssumptionStatus::VALID, or AssumptionStatus::UNKNOWN, or AssumptionStatus::INVALID
+             */
+            std::vector<AssumptionStatus> validateAssumptions(uint_fast64_t val1, uint_fast64_t val2, std::vector<std::shared_ptr<expressions::BinaryRelationExpression>> const& assumptions, std::shared_ptr<Order> order, storage::ParameterRegion<ValueType> region, std::vector<ConstantType> const& minValues, std::vector<ConstantType> const& maxValues, uint_fast64_t numberOfThreads) const;
+
         private:
+            /*!
+             * The constraints on the successors of two states val1 and val2.
+             * expr1 (expr2) is the expression for the value of val1 (val2) in terms of its successors.
+             */
+            struct SmtEncoding {
+                std::shared_ptr<expressions::ExpressionManager> manager;
+                bool orderKnown;
+                expressions::Expression exprOrderSucc;
+                expressions::Expression exprBounds;
+                expressions::Expression expr1;
+                expressions::Expression expr2;
+            };
+
+            AssumptionStatus validateAssumptionWithoutSMTSolver(uint_fast64_t val1, uint_fast64_t val2, std::shared_ptr<expressions::BinaryRelationExpression> assumption, std::vector<ConstantType> const& minValues, std::vector<ConstantType> const& maxValues) const;
+
+            SmtEncoding createSmtEncoding(uint_fast64_t val1, uint_fast64_t val2, std::shared_ptr<Order> order, storage::ParameterRegion<ValueType> const& region, std::vector<ConstantType> const& minValues, std::vector<ConstantType> const& maxValues) const;
+
+            AssumptionStatus checkSmtEncoding(SmtEncoding const& encoding, expressions::Expression const& exprToCheck) const;
+
             bool useSamples;
 
             std::vector<std::vector<ConstantType>> samples;
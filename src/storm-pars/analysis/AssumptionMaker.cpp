@@ -1,9 +1,11 @@
 #include "AssumptionMaker.h"
 
+#include "storm/exceptions/InvalidArgumentException.h"
+
 namespace storm {
     namespace analysis {
         template<typename ValueType, typename ConstantType>
-        AssumptionMaker<ValueType, ConstantType>::AssumptionMaker(storage::SparseMatrix<ValueType> matrix) : assumptionChecker(matrix){
+        AssumptionMaker<ValueType, ConstantType>::AssumptionMaker(storage::SparseMatrix<ValueType> matrix) : assumptionChecker(matrix), numberOfThreads(1) {
             numberOfStates = matrix.getColumnCount();
             expressionManager = std::make_shared<expressions::ExpressionManager>(expressions::ExpressionManager());
             for (uint_fast64_t i = 0; i < this->numberOfStates; ++i) {
@@ -23,6 +25,25 @@ namespace storm {
             std::map<std::shared_ptr<expressions::BinaryRelationExpression>, AssumptionStatus> result;
             STORM_LOG_INFO("Creating assumptions for " << val1 << " and " << val2);
             assert (order->compare(val1, val2) == Order::UNKNOWN);
+            if (numberOfThreads > 1) {
+                std::vector<std::shared_ptr<expressions::BinaryRelationExpression>> assumptions;
+                assumptions.push_back(createAssumption(val1, val2, expressions::BinaryRelationExpression::RelationType::Greater));
+                assumptions.push_back(createAssumption(val2, val1, expressions::BinaryRelationExpression::RelationType::Greater));
+                assumptions.push_back(createAssumption(val1, val2, expressions::BinaryRelationExpression::RelationType::Equal));
+                auto validationResults = assumptionChecker.validateAssumptions(val1, val2, assumptions, order, region, minValues, maxValues, numberOfThreads);
+                for (uint_fast64_t i = 0; i < assumptions.size(); ++i) {
+                    if (validationResults[i] == AssumptionStatus::VALID) {
+                        result.clear();
+                        result.insert({assumptions[i], validationResults[i]});
+                        STORM_LOG_INFO("Assumption " << assumptions[i] << "is valid" << std::endl);
+                        return result;
+                    } else if (validationResults[i] != AssumptionStatus::INVALID) {
+                        result.insert({assumptions[i], validationResults[i]});
+                    }
+                }
+                STORM_LOG_INFO("None of the assumptions is valid, number of possible assumptions:  " << result.size() << std::endl);
+                return result;
+            }
             auto assumption = createAndCheckAssumption(val1, val2, expressions::BinaryRelationExpression::RelationType::Greater, order, region, minValues, maxValues);
             if (assumption.second != AssumptionStatus::INVALID) {
                 result.insert(assumption);
@@ -73,12 +94,23 @@ namespace storm {
 
         template <typename ValueType, typename ConstantType>
         std::pair<std::shared_ptr<expressions::BinaryRelationExpression>, AssumptionStatus> AssumptionMaker<ValueType, ConstantType>::createAndCheckAssumption(uint_fast64_t val1, uint_fast64_t val2, expressions::BinaryRelationExpression::RelationType relationType, std::shared_ptr<Order> order, storage::ParameterRegion<ValueType> region,  std::vector<ConstantType> const minValues, std::vector<ConstantType> const maxValues) const {
+            auto assumption = createAssumption(val1, val2, relationType);
+            AssumptionStatus validationResult = assumptionChecker.validateAssumption(val1, val2, assumption, order, region, minValues, maxValues);
+            return std::pair<std::shared_ptr<expressions::BinaryRelationExpression>, AssumptionStatus>(assumption, validationResult);
+        }
+
+        template <typename ValueType, typename ConstantType>
+        std::shared_ptr<expressions::BinaryRelationExpression> AssumptionMaker<ValueType, ConstantType>::createAssumption(uint_fast64_t val1, uint_fast64_t val2, expressions::BinaryRelationExpression::RelationType relationType) const {
             assert (val1 != val2);
             expressions::Variable var1 = expressionManager->getVariable(std::to_string(val1));
             expressions::Variable var2 = expressionManager->getVariable(std::to_string(val2));
-            auto assumption = std::make_shared<expressions::BinaryRelationExpression>(expressions::BinaryRelationExpression(*expressionManager, expressionManager->getBooleanType(), var1.getExpression().getBaseExpressionPointer(), var2.getExpression().getBaseExpressionPointer(), relationType));
-            AssumptionStatus validationResult = assumptionChecker.validateAssumption(val1, val2, assumption, order, region, minValues, maxValues);
-            return std::pair<std::shared_ptr<expressions::BinaryRelationExpression>, AssumptionStatus>(assumption, validationResult);
+            return std::make_shared<expressions::BinaryRelationExpression>(expressions::BinaryRelationExpression(*expressionManager, expressionManager->getBooleanType(), var1.getExpression().getBaseExpressionPointer(), var2.getExpression().getBaseExpressionPointer(), relationType));
+        }
+
+        template <typename ValueType, typename ConstantType>
+        void AssumptionMaker<ValueType, ConstantType>::setNumberOfThreads(uint_fast64_t numberOfThreads) {
+            STORM_LOG_THROW(numberOfThreads > 0, exceptions::InvalidArgumentException, "The number of threads must be positive.");
+            this->numberOfThreads = numberOfThreads;
         }
 
         template class AssumptionMaker<RationalFunction, double>;
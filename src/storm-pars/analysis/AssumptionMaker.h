@@ -53,7 +53,17 @@ namespace storm {
              */
             void setSampleValues(std::vector<std::vector<ConstantType>>const & samples);
 
+            /*!
+             * Sets the number of threads that validate the created assumptions.
+             * If more than one thread is used, all three assumptions are validated at once.
+             *
+             * @param numberOfThreads The number of threads.
+             */
+            void setNumberOfThreads(uint_fast64_t numberOfThreads);
+
         private:
+            std::shared_ptr<expressions::BinaryRelationExpression> createAssumption(uint_fast64_t val1, uint_fast64_t val2, expressions::BinaryRelationExpression::RelationType relationType) const;
+
             std::pair<std::shared_ptr<expressions::BinaryRelationExpression>, AssumptionStatus> createAndCheckAssumption(uint_fast64_t val1, uint_fast64_t val2, expressions::BinaryRelationExpression::RelationType relationType, std::shared_ptr<Order> order, storage::ParameterRegion<ValueType> region, std::vector<ConstantType> const minValues, std::vector<ConstantType> const maxValue) const;
 
             AssumptionChecker<ValueType, ConstantType> assumptionChecker;
@@ -62,6 +72,8 @@ namespace storm {
 
             uint_fast64_t numberOfStates;
 
+            uint_fast64_t numberOfThreads;
+
         };
     }
 }
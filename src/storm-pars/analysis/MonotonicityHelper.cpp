@@ -148,6 +148,12 @@ namespace storm {
             return monResults;
         }
 
+        template <typename ValueType, typename ConstantType>
+        void MonotonicityHelper<ValueType, ConstantType>::setNumberOfAssumptionThreads(uint_fast64_t numberOfThreads) {
+            assumptionMaker.setNumberOfThreads(numberOfThreads);
+            extender->setNumberOfAssumptionThreads(numberOfThreads);
+        }
+
         /*** Private methods ***/
         template <typename ValueType, typename ConstantType>
         void MonotonicityHelper<ValueType, ConstantType>::createOrder() {
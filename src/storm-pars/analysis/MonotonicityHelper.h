@@ -122,6 +122,13 @@ namespace storm {
              */
             Monotonicity checkLocalMonotonicity(std::shared_ptr<Order> order, uint_fast64_t state, VariableType var, storage::ParameterRegion<ValueType> region);
 
+            /*!
+             * Sets the number of threads that validate the assumptions for two states.
+             *
+             * @param numberOfThreads The number of threads.
+             */
+            void setNumberOfAssumptionThreads(uint_fast64_t numberOfThreads);
+
         private:
             void createOrder();
 
@@ -227,6 +227,11 @@ namespace storm {
         template <typename ValueType, typename ConstantType>
         std::tuple<std::shared_ptr<Order>, uint_fast64_t, uint_fast64_t> OrderExtender<ValueType, ConstantType>::extendOrder(std::shared_ptr<Order> order, storm::storage::ParameterRegion<ValueType> region, std::shared_ptr<MonotonicityResult<VariableType>> monRes, std::shared_ptr<expressions::BinaryRelationExpression> assumption) {
             this->region = region;
+            // Orders that are built from scratch without assumptions only depend on the region, so we can reuse them for subregions
+            bool useOrderCache = order == nullptr && monRes == nullptr && assumption == nullptr;
+            if (useOrderCache) {
+                order = getCachedOrder(region);
+            }
             if (order == nullptr) {
                 order = getBottomTopOrder();
                 if (usePLA[order]) {
@@ -285,13 +290,79 @@ namespace storm {
                 }
                 continueExtending[order] = true;
             }
+            std::tuple<std::shared_ptr<Order>, uint_fast64_t, uint_fast64_t> result;
             if (continueExtending[order] || assumption != nullptr) {
-                return extendOrder(order, monRes, assumption);
+                result = extendOrder(order, monRes, assumption);
             } else {
                 auto& res = unknownStatesMap[order];
                 continueExtending[order] = false;
-                return {order, res.first, res.second};
+                result = std::make_tuple(order, res.first, res.second);
+            }
+            if (useOrderCache && !std::get<0>(result)->isInvalid()) {
+                addToOrderCache(region, std::get<0>(result), std::get<1>(result), std::get<2>(result));
+            }
+            return result;
+        }
+
+        template <typename ValueType, typename ConstantType>
+        std::shared_ptr<Order> OrderExtender<ValueType, ConstantType>::getCachedOrder(storage::ParameterRegion<ValueType> const& region) {
+            auto bestEntry = orderCache.end();
+            for (auto entryIt = orderCache.begin(); entryIt != orderCache.end(); ++entryIt) {
+                if (entryIt->first.isSubRegion(region) && (bestEntry == orderCache.end() || entryIt->first.area() < bestEntry->first.area())) {
+                    bestEntry = entryIt;
+                }
+            }
+            if (bestEntry == orderCache.end()) {
+                return nullptr;
+            }
+            STORM_LOG_INFO("Reusing the order of region " << bestEntry->first << " for region " << region << ".");
+            auto cachedOrder = bestEntry->second;
+            auto order = cachedOrder->copy();
+            copyMinMax(cachedOrder, order);
+            if (unknownStatesMap.find(cachedOrder) != unknownStatesMap.end()) {
+                setUnknownStates(cachedOrder, order);
+            }
+            if (minValuesInit && maxValuesInit) {
+                // Bounds for the (smaller) region are more precise than the ones of the cached order
+                usePLA[order] = true;
+                minValues[order] = std::move(minValuesInit.get());
+                maxValues[order] = std::move(maxValuesInit.get());
+                minValuesInit = boost::none;
+                maxValuesInit = boost::none;
+            }
+            // Only the part of the order that could not be built on the larger region needs to be extended
+            continueExtending[order] = !order->getDoneBuilding();
+            return order;
+        }
+
+        template <typename ValueType, typename ConstantType>
+        void OrderExtender<ValueType, ConstantType>::addToOrderCache(storage::ParameterRegion<ValueType> const& region, std::shared_ptr<Order> order, uint_fast64_t unknownState1, uint_fast64_t unknownState2) {
+            auto entryIt = orderCache.begin();
+            for (; entryIt != orderCache.end(); ++entryIt) {
+                if (entryIt->first.isSubRegion(region) && region.isSubRegion(entryIt->first)) {
+                    if (entryIt->second->getNumberOfDoneStates() >= order->getNumberOfDoneStates()) {
+                        // The cache already contains an order for this region that is at least as complete
+                        return;
+                    }
+                    break;
+                }
             }
+            // The order might be extended for subregions later, so we store a copy
+            auto cachedOrder = order->copy();
+            copyMinMax(order, cachedOrder);
+            if (unknownState1 != numberOfStates) {
+                setUnknownStates(cachedOrder, unknownState1, unknownState2);
+            }
+            if (entryIt == orderCache.end()) {
+                orderCache.emplace_back(region, cachedOrder);
+            } else {
+                entryIt->second = cachedOrder;
+            }
+        }
+
+        template <typename ValueType, typename ConstantType>
+        void OrderExtender<ValueType, ConstantType>::setNumberOfAssumptionThreads(uint_fast64_t numberOfThreads) {
+            assumptionMaker->setNumberOfThreads(numberOfThreads);
         }
 
         template <typename ValueType, typename ConstantType>
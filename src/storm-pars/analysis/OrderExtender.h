@@ -79,7 +79,24 @@ namespace storm {
             void checkParOnStateMonRes(uint_fast64_t s, std::shared_ptr<Order> order, typename OrderExtender<ValueType, ConstantType>::VariableType param, std::shared_ptr<MonotonicityResult<VariableType>> monResult);
 
             bool isHope(std::shared_ptr<Order> order, storage::ParameterRegion<ValueType>);
+
+            /*!
+             * Sets the number of threads that are used to validate the candidate assumptions for two states.
+             *
+             * @param numberOfThreads The number of threads.
+             */
+            void setNumberOfAssumptionThreads(uint_fast64_t numberOfThreads);
+
         private:
+            /*!
+             * Retrieves a copy of the cached order of the smallest region that contains the given region (if any).
+             * As the order is valid on the larger region, it is also valid on the given region and only needs to be extended.
+             *
+             * @return the copy or nullptr if no cached order is applicable.
+             */
+            std::shared_ptr<Order> getCachedOrder(storage::ParameterRegion<ValueType> const& region);
+            void addToOrderCache(storage::ParameterRegion<ValueType> const& region, std::shared_ptr<Order> order, uint_fast64_t unknownState1, uint_fast64_t unknownState2);
+
 
             Order::NodeComparison addStatesBasedOnMinMax(std::shared_ptr<Order> order, uint_fast64_t state1, uint_fast64_t state2) const;
             std::tuple<std::shared_ptr<Order>, uint_fast64_t, uint_fast64_t> extendOrder(std::shared_ptr<Order> order, std::shared_ptr<MonotonicityResult<VariableType>> monRes, std::shared_ptr<expressions::BinaryRelationExpression> assumption = nullptr);
@@ -97,6 +114,9 @@ namespace storm {
 
             std::shared_ptr<Order> bottomTopOrder = nullptr;
 
+            // Orders built from scratch together with the region they were built for
+            std::vector<std::pair<storage::ParameterRegion<ValueType>, std::shared_ptr<Order>>> orderCache;
+
             std::map<std::shared_ptr<Order>, std::vector<ConstantType>> minValues;
             boost::optional<std::vector<ConstantType>> minValuesInit;
             boost::optional<std::vector<ConstantType>> maxValuesInit;
@@ -12,10 +12,15 @@ namespace storm {
             //Intentionally left empty
         }
         
+        template <typename SparseModelType, typename ConstantType>
+        std::unique_ptr<SparseInstantiationModelChecker<SparseModelType, ConstantType>> SparseCtmcInstantiationModelChecker<SparseModelType, ConstantType>::createFreshChecker() const {
+            return std::make_unique<SparseCtmcInstantiationModelChecker<SparseModelType, ConstantType>>(this->parametricModel);
+        }
+        
         template <typename SparseModelType, typename ConstantType>
         std::unique_ptr<CheckResult> SparseCtmcInstantiationModelChecker<SparseModelType, ConstantType>::check(Environment const& env, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) {
             STORM_LOG_THROW(this->currentCheckTask, storm::exceptions::InvalidStateException, "Checking has been invoked but no property has been specified before.");
-            auto const& instantiatedModel = modelInstantiator.instantiate(valuation);
+            auto const& instantiatedModel = this->instantiate(modelInstantiator, valuation);
             storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<ConstantType>> modelChecker(instantiatedModel);
             
             return modelChecker.check(env, *this->currentCheckTask);
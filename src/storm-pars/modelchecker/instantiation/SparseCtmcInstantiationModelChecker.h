@@ -22,6 +22,12 @@ namespace storm {
             
             virtual std::unique_ptr<CheckResult> check(Environment const& env, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) override;
             
+        protected:
+            
+            virtual std::unique_ptr<SparseInstantiationModelChecker<SparseModelType, ConstantType>> createFreshChecker() const override;
+            
+        public:
+            
             storm::utility::ModelInstantiator<SparseModelType, storm::models::sparse::Ctmc<ConstantType>> modelInstantiator;
         };
     }
@@ -24,6 +24,8 @@ namespace storm {
 
         protected:
             
+            virtual std::unique_ptr<SparseInstantiationModelChecker<SparseModelType, ConstantType>> createFreshChecker() const override;
+            
             // Optimizations for the different formula types
             std::unique_ptr<CheckResult> checkReachabilityProbabilityFormula(Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker);
             std::unique_ptr<CheckResult> checkReachabilityRewardFormula(Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker);
@@ -1,18 +1,24 @@
 #include "storm-pars/modelchecker/instantiation/SparseInstantiationModelChecker.h"
 
+#include <algorithm>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/environment/Environment.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidStateException.h"
 
 namespace storm {
     namespace modelchecker {
         
         template <typename SparseModelType, typename ConstantType>
-        SparseInstantiationModelChecker<SparseModelType, ConstantType>::SparseInstantiationModelChecker(SparseModelType const& parametricModel) : parametricModel(parametricModel), instantiationsAreGraphPreserving(false) {
+        SparseInstantiationModelChecker<SparseModelType, ConstantType>::SparseInstantiationModelChecker(SparseModelType const& parametricModel) : parametricModel(parametricModel), instantiationsAreGraphPreserving(false), currentInstantiationIsGraphPreserving(false) {
             // Intentionally left empty
         }
         
@@ -22,6 +28,46 @@ namespace storm {
             currentCheckTask = std::make_unique<storm::modelchecker::CheckTask<storm::logic::Formula, ConstantType>>(checkTask.substituteFormula(*currentFormula).template convertValueType<ConstantType>());
         }
         
+        template <typename SparseModelType, typename ConstantType>
+        std::vector<std::unique_ptr<CheckResult>> SparseInstantiationModelChecker<SparseModelType, ConstantType>::checkValuations(Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations, uint64_t numberOfThreads) {
+            STORM_LOG_THROW(currentCheckTask, storm::exceptions::InvalidStateException, "Checking has been invoked but no property has been specified before.");
+            std::vector<std::unique_ptr<CheckResult>> results(valuations.size());
+            numberOfThreads = std::max<uint64_t>(1, std::min<uint64_t>(numberOfThreads, valuations.size()));
+            if (numberOfThreads == 1) {
+                for (uint64_t i = 0; i < valuations.size(); ++i) {
+                    results[i] = check(env, valuations[i]);
+                }
+                return results;
+            }
+            
+            // Prepare one checker (with its own instantiated model and hint) for each thread. The first thread uses this checker.
+            // The preparation happens sequentially, as it accesses the parametric functions of the model.
+            std::vector<std::unique_ptr<SparseInstantiationModelChecker<SparseModelType, ConstantType>>> additionalCheckers;
+            std::vector<SparseInstantiationModelChecker<SparseModelType, ConstantType>*> checkers = {this};
+            for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+                additionalCheckers.push_back(createFreshChecker());
+                auto& checker = *additionalCheckers.back();
+                checker.instantiationsAreGraphPreserving = instantiationsAreGraphPreserving;
+                checker.currentFormula = currentFormula;
+                checker.currentCheckTask = std::make_unique<storm::modelchecker::CheckTask<storm::logic::Formula, ConstantType>>(currentCheckTask->substituteFormula(*checker.currentFormula));
+                // Hints must not be shared among threads.
+                checker.currentCheckTask->setHint(std::make_shared<ModelCheckerHint>());
+                checkers.push_back(&checker);
+            }
+            // The environment lazily initializes its sub-environments, so each thread gets its own copy.
+            std::vector<Environment> environments(numberOfThreads, env);
+            
+            // Consecutive valuations are handled by the same checker to exploit warm starts.
+            storm::utility::parallel::parallelFor(numberOfThreads, numberOfThreads, [&] (uint64_t chunk) {
+                uint64_t chunkBegin = chunk * valuations.size() / numberOfThreads;
+                uint64_t chunkEnd = (chunk + 1) * valuations.size() / numberOfThreads;
+                for (uint64_t i = chunkBegin; i < chunkEnd; ++i) {
+                    results[i] = checkers[chunk]->check(environments[chunk], valuations[i]);
+                }
+            });
+            return results;
+        }
+        
         template <typename SparseModelType, typename ConstantType>
         void SparseInstantiationModelChecker<SparseModelType, ConstantType>::setInstantiationsAreGraphPreserving(bool value) {
             instantiationsAreGraphPreserving = value;
@@ -32,6 +78,27 @@ namespace storm {
             return instantiationsAreGraphPreserving;
         }
         
+        template <typename SparseModelType, typename ConstantType>
+        void SparseInstantiationModelChecker<SparseModelType, ConstantType>::updateGraphPreservation(bool supportPreserved) {
+            currentInstantiationIsGraphPreserving = instantiationsAreGraphPreserving || supportPreserved;
+            if (!currentInstantiationIsGraphPreserving && currentCheckTask && currentCheckTask->getHint().isExplicitModelCheckerHint()) {
+                auto& oldHint = currentCheckTask->getHint().template asExplicitModelCheckerHint<ConstantType>();
+                if (oldHint.hasMaybeStates()) {
+                    // The maybestates (and the information derived from them) might be invalid for the new graph.
+                    auto newHint = std::make_shared<ExplicitModelCheckerHint<ConstantType>>();
+                    if (oldHint.hasResultHint()) {
+                        newHint->setResultHint(std::move(oldHint.getResultHint()));
+                    }
+                    currentCheckTask->setHint(newHint);
+                }
+            }
+        }
+        
+        template <typename SparseModelType, typename ConstantType>
+        bool SparseInstantiationModelChecker<SparseModelType, ConstantType>::isCurrentInstantiationGraphPreserving() const {
+            return currentInstantiationIsGraphPreserving;
+        }
+        
         template class SparseInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double>;
         template class SparseInstantiationModelChecker<storm::models::sparse::Ctmc<storm::RationalFunction>, double>;
         template class SparseInstantiationModelChecker<storm::models::sparse::Mdp<storm::RationalFunction>, double>;
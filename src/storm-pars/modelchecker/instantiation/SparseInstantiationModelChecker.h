@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include "storm-pars/utility/parametric.h"
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/CheckTask.h"
@@ -25,6 +27,18 @@ namespace storm {
             
             virtual std::unique_ptr<CheckResult> check(Environment const& env, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) = 0;
             
+            /*!
+             * Checks the specified formula for each of the given valuations.
+             * The valuations are split into contiguous chunks, each of which is processed by a separate thread. Every thread works on its own
+             * instantiated model and keeps its own hints, i.e., the result for one valuation serves as a warm start for the next valuation of the same chunk.
+             *
+             * @param env The environment used for each check. Each thread gets its own copy.
+             * @param valuations The valuations to check.
+             * @param numberOfThreads The (maximal) number of threads to use.
+             * @return The results in the order of the given valuations.
+             */
+            std::vector<std::unique_ptr<CheckResult>> checkValuations(Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations, uint64_t numberOfThreads = 1);
+            
             // If set, it is assumed that all considered model instantiations have the same underlying graph structure.
             // This bypasses the graph analysis for the different instantiations.
             void setInstantiationsAreGraphPreserving(bool value);
@@ -32,6 +46,32 @@ namespace storm {
             
         protected:
             
+            /*!
+             * Creates a new checker of the same type for the same parametric model. No formula is specified for the new checker.
+             */
+            virtual std::unique_ptr<SparseInstantiationModelChecker<SparseModelType, ConstantType>> createFreshChecker() const = 0;
+            
+            /*!
+             * Instantiates the model using the given instantiator and updates the information on graph preservation accordingly.
+             */
+            template<typename InstantiatorType>
+            auto instantiate(InstantiatorType& instantiator, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) -> decltype(instantiator.instantiate(valuation)) {
+                auto const& instantiatedModel = instantiator.instantiate(valuation);
+                updateGraphPreservation(instantiator.isSupportPreserved());
+                return instantiatedModel;
+            }
+            
+            /*!
+             * Has to be invoked after each instantiation. If the graph of the instantiated model might differ from the one of the previous
+             * instantiation, qualitative information stored in the hint of the current check task (e.g. the maybestates) is discarded.
+             * The result hint is kept as it only serves as a starting point for the numerical computations.
+             * @param supportPreserved True iff the instantiated model has the same support as the previously instantiated model.
+             */
+            void updateGraphPreservation(bool supportPreserved);
+            
+            // Returns true iff qualitative results obtained for previous instantiations are also valid for the current instantiation.
+            bool isCurrentInstantiationGraphPreserving() const;
+            
             SparseModelType const& parametricModel;
             std::unique_ptr<CheckTask<storm::logic::Formula, ConstantType>> currentCheckTask;
             
@@ -40,6 +80,7 @@ namespace storm {
             std::shared_ptr<storm::logic::Formula const> currentFormula;
 
             bool instantiationsAreGraphPreserving;
+            bool currentInstantiationIsGraphPreserving;
         };
     }
 }
@@ -19,10 +19,15 @@ namespace storm {
             //Intentionally left empty
         }
 
+        template <typename SparseModelType, typename ConstantType>
+        std::unique_ptr<SparseInstantiationModelChecker<SparseModelType, ConstantType>> SparseMdpInstantiationModelChecker<SparseModelType, ConstantType>::createFreshChecker() const {
+            return std::make_unique<SparseMdpInstantiationModelChecker<SparseModelType, ConstantType>>(this->parametricModel);
+        }
+        
        template <typename SparseModelType, typename ConstantType>
         std::unique_ptr<CheckResult> SparseMdpInstantiationModelChecker<SparseModelType, ConstantType>::check(Environment const& env, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) {
             STORM_LOG_THROW(this->currentCheckTask, storm::exceptions::InvalidStateException, "Checking has been invoked but no property has been specified before.");
-            auto const& instantiatedModel = modelInstantiator.instantiate(valuation);
+            auto const& instantiatedModel = this->instantiate(modelInstantiator, valuation);
             STORM_LOG_THROW(instantiatedModel.getTransitionMatrix().isProbabilistic(), storm::exceptions::InvalidArgumentException, "Instantiation point is invalid as the transition matrix becomes non-stochastic.");
             storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<ConstantType>> modelChecker(instantiatedModel);
 
@@ -48,7 +53,7 @@ namespace storm {
             }
             ExplicitModelCheckerHint<ConstantType>& hint = this->currentCheckTask->getHint().template asExplicitModelCheckerHint<ConstantType>();
             
-            if (this->getInstantiationsAreGraphPreserving() && !hint.hasMaybeStates()) {
+            if (this->isCurrentInstantiationGraphPreserving() && !hint.hasMaybeStates()) {
                 // Perform purely qualitative analysis once
                 std::vector<ConstantType> qualitativeResult;
                 if (this->currentCheckTask->getFormula().asOperatorFormula().hasQuantitativeResult()) {
@@ -107,7 +112,7 @@ namespace storm {
             }
             ExplicitModelCheckerHint<ConstantType>& hint = this->currentCheckTask->getHint().template asExplicitModelCheckerHint<ConstantType>();
             
-            if (this->getInstantiationsAreGraphPreserving() && !hint.hasMaybeStates()) {
+            if (this->isCurrentInstantiationGraphPreserving() && !hint.hasMaybeStates()) {
                 // Perform purely qualitative analysis once
                 std::vector<ConstantType> qualitativeResult;
                 if (this->currentCheckTask->getFormula().asOperatorFormula().hasQuantitativeResult()) {
@@ -165,7 +170,7 @@ namespace storm {
             std::unique_ptr<CheckResult> result;
             ExplicitModelCheckerHint<ConstantType>& hint = this->currentCheckTask->getHint().template asExplicitModelCheckerHint<ConstantType>();
             
-            if (this->getInstantiationsAreGraphPreserving() && !hint.hasMaybeStates()) {
+            if (this->isCurrentInstantiationGraphPreserving() && !hint.hasMaybeStates()) {
                 // We extract the maybestates from the quantitative result
                 // For qualitative properties, we still need a quantitative result. Hence we perform the check on the subformula
                 if (this->currentCheckTask->getFormula().asOperatorFormula().hasQuantitativeResult()) {
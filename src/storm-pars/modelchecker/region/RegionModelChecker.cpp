@@ -1,5 +1,7 @@
 #include <sstream>
 #include <queue>
+#include <mutex>
+#include <condition_variable>
 
 #include "storm-pars/analysis/OrderExtender.cpp"
 #include "storm-pars/modelchecker/region/RegionModelChecker.h"
@@ -8,6 +10,7 @@
 
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/sparse/Dtmc.h"
+#include "storm/environment/Environment.h"
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
@@ -16,10 +19,104 @@
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 
+#include "storm/utility/parallel.h"
+
 
 namespace storm {
     namespace modelchecker {
 
+            namespace {
+                /*!
+                 * Keeps track of the fractions of the parameter space that are known to be AllSat or AllViolated during region refinement.
+                 * If statistics are shown, the progress is displayed as a bar that is extended whenever more of the parameter space is known.
+                 */
+                template <typename CoefficientType>
+                class RegionRefinementProgress {
+                public:
+                    RegionRefinementProgress(CoefficientType const& areaOfParameterSpace, CoefficientType const& coverageThreshold) : areaOfParameterSpace(areaOfParameterSpace), fractionOfUndiscoveredArea(storm::utility::one<CoefficientType>()), fractionOfAllSatArea(storm::utility::zero<CoefficientType>()), fractionOfAllViolatedArea(storm::utility::zero<CoefficientType>()), numberOfAnalyzedRegions(0), showStatistics(storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()), displayedProgress(storm::utility::zero<CoefficientType>()) {
+                        if (showStatistics) {
+                            STORM_PRINT_AND_LOG("Progress (solved fraction) :" << std::endl <<  "0% [");
+                            while (displayedProgress < storm::utility::one<CoefficientType>() - coverageThreshold) {
+                                STORM_PRINT_AND_LOG(" ");
+                                displayedProgress += storm::utility::convertNumber<CoefficientType>(0.01);
+                            }
+                            while (displayedProgress < storm::utility::one<CoefficientType>()) {
+                                STORM_PRINT_AND_LOG("-");
+                                displayedProgress += storm::utility::convertNumber<CoefficientType>(0.01);
+                            }
+                            STORM_PRINT_AND_LOG("] 100%" << std::endl << "   [");
+                            displayedProgress = storm::utility::zero<CoefficientType>();
+                        }
+                    }
+
+                    /*!
+                     * Records that a region with the given area has been analyzed with the given result.
+                     */
+                    void addAnalyzedRegion(CoefficientType const& area, RegionResult const& result) {
+                        ++numberOfAnalyzedRegions;
+                        if (result == RegionResult::AllSat || result == RegionResult::AllViolated) {
+                            CoefficientType fractionOfArea = area / areaOfParameterSpace;
+                            fractionOfUndiscoveredArea -= fractionOfArea;
+                            if (result == RegionResult::AllSat) {
+                                fractionOfAllSatArea += fractionOfArea;
+                            } else {
+                                fractionOfAllViolatedArea += fractionOfArea;
+                            }
+                            if (showStatistics) {
+                                while (displayedProgress < storm::utility::one<CoefficientType>() - fractionOfUndiscoveredArea) {
+                                    STORM_PRINT_AND_LOG("#");
+                                    displayedProgress += storm::utility::convertNumber<CoefficientType>(0.01);
+                                }
+                            }
+                        }
+                    }
+
+                    CoefficientType const& getFractionOfUndiscoveredArea() const {
+                        return fractionOfUndiscoveredArea;
+                    }
+
+                    uint64_t getNumberOfAnalyzedRegions() const {
+                        return numberOfAnalyzedRegions;
+                    }
+
+                    /*!
+                     * Completes the progress bar and prints the refinement statistics (if statistics are shown).
+                     * @param numberOfThreads the number of threads that analyzed the regions
+                     * @param numberOfRegionsKnownThroughMonotonicity if given, the number of regions that were discovered with help of monotonicity
+                     */
+                    void finish(uint64_t numberOfThreads, boost::optional<uint64_t> const& numberOfRegionsKnownThroughMonotonicity = boost::none) {
+                        if (!showStatistics) {
+                            return;
+                        }
+                        while (displayedProgress < storm::utility::one<CoefficientType>()) {
+                            STORM_PRINT_AND_LOG("-");
+                            displayedProgress += storm::utility::convertNumber<CoefficientType>(0.01);
+                        }
+                        STORM_PRINT_AND_LOG("]" << std::endl);
+
+                        STORM_PRINT_AND_LOG("Region Refinement Statistics:" << std::endl);
+                        STORM_PRINT_AND_LOG("    Analyzed a total of " << numberOfAnalyzedRegions << " regions");
+                        if (numberOfThreads > 1) {
+                            STORM_PRINT_AND_LOG(" using " << numberOfThreads << " threads");
+                        }
+                        STORM_PRINT_AND_LOG("." << std::endl);
+                        STORM_PRINT_AND_LOG("    " << storm::utility::convertNumber<double>(fractionOfAllSatArea) * 100 << "% of the parameter space is AllSat and " << storm::utility::convertNumber<double>(fractionOfAllViolatedArea) * 100 << "% is AllViolated." << std::endl);
+                        if (numberOfRegionsKnownThroughMonotonicity) {
+                            STORM_PRINT_AND_LOG("    " << numberOfRegionsKnownThroughMonotonicity.get() << " regions where discovered with help of monotonicity." << std::endl);
+                        }
+                    }
+
+                private:
+                    CoefficientType areaOfParameterSpace;
+                    CoefficientType fractionOfUndiscoveredArea;
+                    CoefficientType fractionOfAllSatArea;
+                    CoefficientType fractionOfAllViolatedArea;
+                    uint64_t numberOfAnalyzedRegions;
+                    bool showStatistics;
+                    CoefficientType displayedProgress;
+                };
+            }
+
             template <typename ParametricType>
             RegionModelChecker<ParametricType>::RegionModelChecker() {
                 // Intentionally left empty
@@ -51,11 +148,19 @@ namespace storm {
             std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> RegionModelChecker<ParametricType>::performRegionRefinement(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold, boost::optional<uint64_t> depthThreshold, RegionResultHypothesis const& hypothesis, uint64_t monThresh) {
                 STORM_LOG_INFO("Applying refinement on region: " << region.toString(true) << " .");
                 
+                if (refinementThreads > 1) {
+                    if (useMonotonicity) {
+                        STORM_LOG_WARN("Parallel region refinement is not supported when monotonicity is used. Falling back to sequential refinement.");
+                    } else {
+                        auto parallelResult = performParallelRegionRefinement(env, region, coverageThreshold, depthThreshold, hypothesis);
+                        if (parallelResult) {
+                            return parallelResult;
+                        }
+                        STORM_LOG_WARN("Parallel region refinement is not supported by the selected region model checker. Falling back to sequential refinement.");
+                    }
+                }
+                
                 auto thresholdAsCoefficient = coverageThreshold ? storm::utility::convertNumber<CoefficientType>(coverageThreshold.get()) : storm::utility::zero<CoefficientType>();
-                auto areaOfParameterSpace = region.area();
-                auto fractionOfUndiscoveredArea = storm::utility::one<CoefficientType>();
-                auto fractionOfAllSatArea = storm::utility::zero<CoefficientType>();
-                auto fractionOfAllViolatedArea = storm::utility::zero<CoefficientType>();
                 numberOfRegionsKnownThroughMonotonicity = 0;
                 
                 // The resulting (sub-)regions
@@ -68,42 +173,25 @@ namespace storm {
                 unprocessedRegions.emplace(region, RegionResult::Unknown);
                 refinementDepths.push(0);
 
-                uint_fast64_t numOfAnalyzedRegions = 0;
-                CoefficientType displayedProgress = storm::utility::zero<CoefficientType>();
-                if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
-                    STORM_PRINT_AND_LOG("Progress (solved fraction) :" << std::endl <<  "0% [");
-                    while (displayedProgress < storm::utility::one<CoefficientType>() - thresholdAsCoefficient) {
-                        STORM_PRINT_AND_LOG(" ");
-                        displayedProgress += storm::utility::convertNumber<CoefficientType>(0.01);
-                    }
-                    while (displayedProgress < storm::utility::one<CoefficientType>()) {
-                        STORM_PRINT_AND_LOG("-");
-                        displayedProgress += storm::utility::convertNumber<CoefficientType>(0.01);
-                    }
-                    STORM_PRINT_AND_LOG("] 100%" << std::endl << "   [");
-                    displayedProgress = storm::utility::zero<CoefficientType>();
-                }
+                RegionRefinementProgress<CoefficientType> progress(region.area(), thresholdAsCoefficient);
 
                 // NORMAL WHILE LOOP
                 uint64_t currentDepth = refinementDepths.front();
-                while ((!useMonotonicity || currentDepth < monThresh) && fractionOfUndiscoveredArea > thresholdAsCoefficient && !unprocessedRegions.empty()) {
+                while ((!useMonotonicity || currentDepth < monThresh) && progress.getFractionOfUndiscoveredArea() > thresholdAsCoefficient && !unprocessedRegions.empty()) {
                     assert(unprocessedRegions.size() == refinementDepths.size());
-                    STORM_LOG_INFO("Analyzing region #" << numOfAnalyzedRegions << " (Refinement depth " << currentDepth << "; " << storm::utility::convertNumber<double>(fractionOfUndiscoveredArea) * 100 << "% still unknown)");
+                    STORM_LOG_INFO("Analyzing region #" << progress.getNumberOfAnalyzedRegions() << " (Refinement depth " << currentDepth << "; " << storm::utility::convertNumber<double>(progress.getFractionOfUndiscoveredArea()) * 100 << "% still unknown)");
                     auto& currentRegion = unprocessedRegions.front().first;
                     auto& res = unprocessedRegions.front().second;
                     std::shared_ptr<storm::analysis::Order> order;
                     std::shared_ptr<storm::analysis::LocalMonotonicityResult<VariableType>> localMonotonicityResult;
                     res = analyzeRegion(env, currentRegion, hypothesis, res, false);
+                    progress.addAnalyzedRegion(currentRegion.area(), res);
 
                     switch (res) {
                         case RegionResult::AllSat:
-                            fractionOfUndiscoveredArea -= currentRegion.area() / areaOfParameterSpace;
-                            fractionOfAllSatArea += currentRegion.area() / areaOfParameterSpace;
                             result.push_back(std::move(unprocessedRegions.front()));
                             break;
                         case RegionResult::AllViolated:
-                            fractionOfUndiscoveredArea -= currentRegion.area() / areaOfParameterSpace;
-                            fractionOfAllViolatedArea += currentRegion.area() / areaOfParameterSpace;
                             result.push_back(std::move(unprocessedRegions.front()));
                             break;
                         default:
@@ -126,15 +214,8 @@ namespace storm {
                             }
                             break;
                     }
-                    ++numOfAnalyzedRegions;
                     unprocessedRegions.pop();
                     refinementDepths.pop();
-                    if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
-                        while (displayedProgress < storm::utility::one<CoefficientType>() - fractionOfUndiscoveredArea) {
-                            STORM_PRINT_AND_LOG("#");
-                            displayedProgress += storm::utility::convertNumber<CoefficientType>(0.01);
-                        }
-                    }
                     currentDepth = refinementDepths.front();
                 }
 
@@ -143,7 +224,7 @@ namespace storm {
                 std::queue<std::shared_ptr<storm::analysis::LocalMonotonicityResult<VariableType>>> localMonotonicityResults;
                 std::shared_ptr<storm::analysis::Order> order;
                 std::shared_ptr<storm::analysis::LocalMonotonicityResult<VariableType>> localMonotonicityResult;
-                if (useMonotonicity && fractionOfUndiscoveredArea > thresholdAsCoefficient && !unprocessedRegions.empty()) {
+                if (useMonotonicity && progress.getFractionOfUndiscoveredArea() > thresholdAsCoefficient && !unprocessedRegions.empty()) {
                     storm::utility::Stopwatch monWatch(true);
 
                     orders.emplace(extendOrder(env, nullptr, region));
@@ -180,12 +261,12 @@ namespace storm {
                 bool useSameLocalMonotonicityResult = useSameOrder && localMonotonicityResult->isDone();
 
                 // USEMON WHILE LOOP
-                while (useMonotonicity && fractionOfUndiscoveredArea > thresholdAsCoefficient && !unprocessedRegions.empty()) {
+                while (useMonotonicity && progress.getFractionOfUndiscoveredArea() > thresholdAsCoefficient && !unprocessedRegions.empty()) {
                     assert ((useSameLocalMonotonicityResult && localMonotonicityResults.size() == 1)|| unprocessedRegions.size() == localMonotonicityResults.size());
                     assert ((useSameOrder && orders.size() == 1) || unprocessedRegions.size() == orders.size());
                     assert(unprocessedRegions.size() == refinementDepths.size());
                     currentDepth = refinementDepths.front();
-                    STORM_LOG_INFO("Analyzing region #" << numOfAnalyzedRegions << " (Refinement depth " << currentDepth << "; " << storm::utility::convertNumber<double>(fractionOfUndiscoveredArea) * 100 << "% still unknown)");
+                    STORM_LOG_INFO("Analyzing region #" << progress.getNumberOfAnalyzedRegions() << " (Refinement depth " << currentDepth << "; " << storm::utility::convertNumber<double>(progress.getFractionOfUndiscoveredArea()) * 100 << "% still unknown)");
                     auto& currentRegion = unprocessedRegions.front().first;
                     auto& res = unprocessedRegions.front().second;
 
@@ -204,17 +285,14 @@ namespace storm {
                     }
 
                     res = analyzeRegion(env, currentRegion, hypothesis, res, false, order, localMonotonicityResult);
+                    progress.addAnalyzedRegion(currentRegion.area(), res);
 
                     switch (res) {
                         case RegionResult::AllSat:
-                            fractionOfUndiscoveredArea -= currentRegion.area() / areaOfParameterSpace;
-                            fractionOfAllSatArea += currentRegion.area() / areaOfParameterSpace;
                             STORM_LOG_INFO("Region " << unprocessedRegions.front() << " is AllSat");
                             result.push_back(std::move(unprocessedRegions.front()));
                             break;
                         case RegionResult::AllViolated:
-                            fractionOfUndiscoveredArea -= currentRegion.area() / areaOfParameterSpace;
-                            fractionOfAllViolatedArea += currentRegion.area() / areaOfParameterSpace;
                             STORM_LOG_INFO("Region " << unprocessedRegions.front() << " is AllViolated");
 
                             result.push_back(std::move(unprocessedRegions.front()));
@@ -279,7 +357,6 @@ namespace storm {
                             break;
                     }
 
-                    ++numOfAnalyzedRegions;
                     unprocessedRegions.pop();
                     refinementDepths.pop();
                     if (!useSameOrder) {
@@ -288,13 +365,6 @@ namespace storm {
                     if (!useSameLocalMonotonicityResult) {
                         localMonotonicityResults.pop();
                     }
-
-                    if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
-                        while (displayedProgress < storm::utility::one<CoefficientType>() - fractionOfUndiscoveredArea) {
-                            STORM_PRINT_AND_LOG("#");
-                            displayedProgress += storm::utility::convertNumber<CoefficientType>(0.01);
-                        }
-                    }
                 }
                 
                 // Add the still unprocessed regions to the result
@@ -303,26 +373,125 @@ namespace storm {
                     unprocessedRegions.pop();
                 }
                 
-                if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
-                    while (displayedProgress < storm::utility::one<CoefficientType>()) {
-                        STORM_PRINT_AND_LOG("-");
-                        displayedProgress += storm::utility::convertNumber<CoefficientType>(0.01);
-                    }
-                    STORM_PRINT_AND_LOG("]" << std::endl);
-                    
-                    STORM_PRINT_AND_LOG("Region Refinement Statistics:" << std::endl);
-                    STORM_PRINT_AND_LOG("    Analyzed a total of " << numOfAnalyzedRegions << " regions." << std::endl);
+                if (useMonotonicity) {
+                    progress.finish(1, numberOfRegionsKnownThroughMonotonicity);
+                } else {
+                    progress.finish(1);
+                }
+                
+                auto regionCopyForResult = region;
+                return std::make_unique<storm::modelchecker::RegionRefinementCheckResult<ParametricType>>(std::move(result), std::move(regionCopyForResult));
+            }
 
-                    if (useMonotonicity) {
-                        STORM_PRINT_AND_LOG("    " << numberOfRegionsKnownThroughMonotonicity << " regions where discovered with help of monotonicity." << std::endl);
 
+            template <typename ParametricType>
+            std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> RegionModelChecker<ParametricType>::performParallelRegionRefinement(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold, boost::optional<uint64_t> depthThreshold, RegionResultHypothesis const& hypothesis) {
+                // Prepare one worker for each thread. The first thread uses this region model checker.
+                std::vector<std::unique_ptr<RegionModelChecker<ParametricType>>> additionalWorkers;
+                std::vector<RegionModelChecker<ParametricType>*> workers = {this};
+                for (uint64_t thread = 1; thread < refinementThreads; ++thread) {
+                    auto worker = createRefinementWorker(env);
+                    if (!worker) {
+                        return nullptr;
+                    }
+                    workers.push_back(worker.get());
+                    additionalWorkers.push_back(std::move(worker));
+                }
+                // The environment lazily initializes its sub-environments, so each thread gets its own copy.
+                std::vector<Environment> environments(refinementThreads, env);
+                
+                auto thresholdAsCoefficient = coverageThreshold ? storm::utility::convertNumber<CoefficientType>(coverageThreshold.get()) : storm::utility::zero<CoefficientType>();
+                
+                // The resulting (sub-)regions
+                std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> result;
+                
+                // The regions that we still need to process. Larger regions are processed first.
+                struct UnprocessedRegion {
+                    storm::storage::ParameterRegion<ParametricType> region;
+                    RegionResult result;
+                    uint64_t depth;
+                    CoefficientType area;
+                };
+                auto smallerArea = [] (UnprocessedRegion const& lhs, UnprocessedRegion const& rhs) { return lhs.area < rhs.area; };
+                std::priority_queue<UnprocessedRegion, std::vector<UnprocessedRegion>, decltype(smallerArea)> unprocessedRegions(smallerArea);
+                unprocessedRegions.push(UnprocessedRegion{region, RegionResult::Unknown, 0, region.area()});
+                
+                // Data that is shared among the threads. It is only accessed while holding the mutex.
+                RegionRefinementProgress<CoefficientType> progress(region.area(), thresholdAsCoefficient);
+                std::mutex mutex;
+                std::condition_variable stateChanged;
+                uint64_t numberOfBusyWorkers = 0;
+                bool aborted = false;
+                auto isDone = [&] () {
+                    return aborted || progress.getFractionOfUndiscoveredArea() <= thresholdAsCoefficient || (unprocessedRegions.empty() && numberOfBusyWorkers == 0);
+                };
+                
+                storm::utility::parallel::parallelFor(refinementThreads, refinementThreads, [&] (uint64_t thread) {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    while (true) {
+                        stateChanged.wait(lock, [&] () { return isDone() || !unprocessedRegions.empty(); });
+                        if (isDone()) {
+                            break;
+                        }
+                        UnprocessedRegion current = unprocessedRegions.top();
+                        unprocessedRegions.pop();
+                        ++numberOfBusyWorkers;
+                        STORM_LOG_INFO("Analyzing region #" << progress.getNumberOfAnalyzedRegions() << " (Refinement depth " << current.depth << "; " << storm::utility::convertNumber<double>(progress.getFractionOfUndiscoveredArea()) * 100 << "% still unknown)");
+                        lock.unlock();
+                        
+                        std::vector<storm::storage::ParameterRegion<ParametricType>> newRegions;
+                        try {
+                            current.result = workers[thread]->analyzeRegion(environments[thread], current.region, hypothesis, current.result, false);
+                            bool isConclusive = current.result == RegionResult::AllSat || current.result == RegionResult::AllViolated;
+                            // Split the region as long as the desired refinement depth is not reached.
+                            if (!isConclusive && (!depthThreshold || current.depth < depthThreshold.get())) {
+                                current.region.split(current.region.getCenterPoint(), newRegions);
+                            }
+                        } catch (...) {
+                            // Let the other workers stop before the exception is passed on.
+                            lock.lock();
+                            aborted = true;
+                            --numberOfBusyWorkers;
+                            stateChanged.notify_all();
+                            throw;
+                        }
+                        
+                        // Merge the result of this worker into the shared data.
+                        lock.lock();
+                        progress.addAnalyzedRegion(current.area, current.result);
+                        if (current.result == RegionResult::AllSat || current.result == RegionResult::AllViolated || newRegions.empty()) {
+                            // If the region is not further refined, it is still added to the result
+                            result.emplace_back(std::move(current.region), current.result);
+                        } else {
+                            RegionResult initResForNewRegions = (current.result == RegionResult::CenterSat) ? RegionResult::ExistsSat :
+                                                                ((current.result == RegionResult::CenterViolated) ? RegionResult::ExistsViolated :
+                                                                 RegionResult::Unknown);
+                            for (auto& newRegion : newRegions) {
+                                auto newArea = newRegion.area();
+                                unprocessedRegions.push(UnprocessedRegion{std::move(newRegion), initResForNewRegions, current.depth + 1, std::move(newArea)});
+                            }
+                        }
+                        --numberOfBusyWorkers;
+                        stateChanged.notify_all();
                     }
+                });
+                
+                // Add the still unprocessed regions to the result
+                while (!unprocessedRegions.empty()) {
+                    result.emplace_back(unprocessedRegions.top().region, unprocessedRegions.top().result);
+                    unprocessedRegions.pop();
                 }
                 
+                progress.finish(refinementThreads);
+                
                 auto regionCopyForResult = region;
                 return std::make_unique<storm::modelchecker::RegionRefinementCheckResult<ParametricType>>(std::move(result), std::move(regionCopyForResult));
             }
 
+        template <typename ParametricType>
+        std::unique_ptr<RegionModelChecker<ParametricType>> RegionModelChecker<ParametricType>::createRefinementWorker(Environment const& env) const {
+            return nullptr;
+        }
 
         template <typename ParametricType>
         void RegionModelChecker<ParametricType>::extendLocalMonotonicityResult(storm::storage::ParameterRegion<ParametricType> const& region, std::shared_ptr<storm::analysis::Order> order, std::shared_ptr<storm::analysis::LocalMonotonicityResult<VariableType>> localMonotonicityResult){
@@ -404,6 +573,17 @@ namespace storm {
             currentRegion.split(currentRegion.getCenterPoint(), regionVector);
         }
 
+        template <typename ParametricType>
+        void RegionModelChecker<ParametricType>::setRefinementThreads(uint64_t threads) {
+            STORM_LOG_THROW(threads > 0, storm::exceptions::InvalidArgumentException, "The number of refinement threads has to be positive.");
+            this->refinementThreads = threads;
+        }
+
+        template <typename ParametricType>
+        uint64_t RegionModelChecker<ParametricType>::getRefinementThreads() const {
+            return refinementThreads;
+        }
+
         template<typename ParametricType>
         void RegionModelChecker<ParametricType>::setMonotoneParameters(std::pair<std::set<typename storm::storage::ParameterRegion<ParametricType>::VariableType>, std::set<typename storm::storage::ParameterRegion<ParametricType>::VariableType>> monotoneParameters) {
             monotoneIncrParameters = std::move(monotoneParameters.first);
@@ -59,6 +59,8 @@ namespace storm {
              * @param depthThreshold if given, the refinement stops at the given depth. depth=0 means no refinement.
              * @param hypothesis if not 'unknown', it is only checked whether the hypothesis holds within the given region.
              * @param monThresh if given, determines at which depth to start using monotonicity
+             *
+             * If more than one refinement thread is set (and monotonicity is not used), the regions are analyzed in parallel. See setRefinementThreads.
              */
             std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> performRegionRefinement(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold, boost::optional<uint64_t> depthThreshold = boost::none, RegionResultHypothesis const& hypothesis = RegionResultHypothesis::Unknown, uint64_t monThresh = 0);
 
@@ -94,12 +96,27 @@ namespace storm {
             void setUseBounds(bool bounds = true);
             void setUseOnlyGlobal(bool global = true);
 
+            /*!
+             * Sets the number of threads that analyze regions during region refinement.
+             * Each thread works on its own copy of this region model checker (see createRefinementWorker).
+             */
+            void setRefinementThreads(uint64_t threads);
+            uint64_t getRefinementThreads() const;
+
             void setMonotoneParameters(std::pair<std::set<typename storm::storage::ParameterRegion<ParametricType>::VariableType>, std::set<typename storm::storage::ParameterRegion<ParametricType>::VariableType>> monotoneParameters);
 
         private:
             bool useMonotonicity = false;
             bool useOnlyGlobal = false;
             bool useBounds = false;
+            uint64_t refinementThreads = 1;
+
+            /*!
+             * Performs the region refinement with several threads that share a queue of unprocessed regions in which larger regions are analyzed first.
+             * The coverage and depth thresholds are checked globally.
+             * @return nullptr if this region model checker can not create workers for parallel refinement.
+             */
+            std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> performParallelRegionRefinement(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold, boost::optional<uint64_t> depthThreshold, RegionResultHypothesis const& hypothesis);
 
         protected:
 
@@ -107,6 +124,13 @@ namespace storm {
             boost::optional<std::set<typename storm::storage::ParameterRegion<ParametricType>::VariableType>> monotoneIncrParameters;
             boost::optional<std::set<typename storm::storage::ParameterRegion<ParametricType>::VariableType>> monotoneDecrParameters;
 
+            /*!
+             * Creates a region model checker for the same model and property that can analyze regions independently of (and concurrently to) this region model checker.
+             * The worker is created sequentially, i.e., it may access data shared with this region model checker.
+             * @return nullptr if this is not supported by this region model checker.
+             */
+            virtual std::unique_ptr<RegionModelChecker<ParametricType>> createRefinementWorker(Environment const& env) const;
+
             virtual void extendLocalMonotonicityResult(storm::storage::ParameterRegion<ParametricType> const& region, std::shared_ptr<storm::analysis::Order> order, std::shared_ptr<storm::analysis::LocalMonotonicityResult<VariableType>> localMonotonicityResult);
 
             virtual void splitSmart(storm::storage::ParameterRegion<ParametricType> & region, std::vector<storm::storage::ParameterRegion<ParametricType>> &regionVector, std::shared_ptr<storm::analysis::Order> order, storm::analysis::MonotonicityResult<VariableType> & monRes, bool splitForExtremum) const;
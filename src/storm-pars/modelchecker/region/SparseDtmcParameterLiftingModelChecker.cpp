@@ -1,6 +1,7 @@
 #include "storm-pars/modelchecker/region/SparseDtmcParameterLiftingModelChecker.h"
 
 #include "storm-pars/transformer/SparseParametricDtmcSimplifier.h"
+#include "storm-pars/utility/parametric.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
@@ -58,6 +59,14 @@ namespace storm {
             }
         }
 
+        template <typename SparseModelType, typename ConstantType>
+        std::unique_ptr<RegionModelChecker<typename SparseModelType::ValueType>> SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::createRefinementWorker(Environment const& env) const {
+            // The considered model is already simplified (if simplifications were allowed).
+            auto worker = std::make_unique<SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>>();
+            worker->specify(env, this->parametricModel, *this->currentParametricCheckTask, regionSplitEstimationsEnabled, false);
+            return worker;
+        }
+
         template <typename SparseModelType, typename ConstantType>
         void SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::specify_internal(Environment const& env, std::shared_ptr<SparseModelType> parametricModel, CheckTask<storm::logic::Formula, ValueType> const& checkTask, bool generateRegionSplitEstimates, bool skipModelSimplification) {
             STORM_LOG_ASSERT(this->canHandle(parametricModel, checkTask), "specified model and formula can not be handled by this.");
@@ -237,6 +246,8 @@ namespace storm {
         template <typename SparseModelType, typename ConstantType>
         storm::modelchecker::SparseInstantiationModelChecker<SparseModelType, ConstantType>& SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::getInstantiationCheckerSAT() {
             if (!instantiationCheckerSAT) {
+                // Region refinement workers might create their checkers concurrently. Copying the parametric functions is not thread-safe.
+                std::lock_guard<std::mutex> lock(storm::utility::parametric::getFunctionEvaluationMutex());
                 instantiationCheckerSAT = std::make_unique<storm::modelchecker::SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>>(*this->parametricModel);
                 instantiationCheckerSAT->specifyFormula(this->currentCheckTask->template convertValueType<ValueType>());
                 instantiationCheckerSAT->setInstantiationsAreGraphPreserving(true);
@@ -247,6 +258,7 @@ namespace storm {
         template <typename SparseModelType, typename ConstantType>
         storm::modelchecker::SparseInstantiationModelChecker<SparseModelType, ConstantType>& SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::getInstantiationCheckerVIO() {
             if (!instantiationCheckerVIO) {
+                std::lock_guard<std::mutex> lock(storm::utility::parametric::getFunctionEvaluationMutex());
                 instantiationCheckerVIO = std::make_unique<storm::modelchecker::SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>>(*this->parametricModel);
                 instantiationCheckerVIO->specifyFormula(this->currentCheckTask->template convertValueType<ValueType>());
                 instantiationCheckerVIO->setInstantiationsAreGraphPreserving(true);
@@ -257,6 +269,7 @@ namespace storm {
         template <typename SparseModelType, typename ConstantType>
         storm::modelchecker::SparseInstantiationModelChecker<SparseModelType, ConstantType>& SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::getInstantiationChecker() {
             if (!instantiationChecker) {
+                std::lock_guard<std::mutex> lock(storm::utility::parametric::getFunctionEvaluationMutex());
                 instantiationChecker = std::make_unique<storm::modelchecker::SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>>(*this->parametricModel);
                 instantiationChecker->specifyFormula(this->currentCheckTask->template convertValueType<ValueType>());
                 instantiationChecker->setInstantiationsAreGraphPreserving(true);
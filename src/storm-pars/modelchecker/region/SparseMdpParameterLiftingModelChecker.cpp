@@ -1,6 +1,7 @@
 #include "storm-pars/modelchecker/region/SparseMdpParameterLiftingModelChecker.h"
 #include "storm-pars/utility/parameterlifting.h"
 #include "storm-pars/transformer/SparseParametricMdpSimplifier.h"
+#include "storm-pars/utility/parametric.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
@@ -50,6 +51,14 @@ namespace storm {
             specify_internal(env, mdp, checkTask, generateRegionSplitEstimates, !allowModelSimplifications);
         }
 
+        template <typename SparseModelType, typename ConstantType>
+        std::unique_ptr<RegionModelChecker<typename SparseModelType::ValueType>> SparseMdpParameterLiftingModelChecker<SparseModelType, ConstantType>::createRefinementWorker(Environment const& env) const {
+            // The considered model is already simplified (if simplifications were allowed).
+            auto worker = std::make_unique<SparseMdpParameterLiftingModelChecker<SparseModelType, ConstantType>>();
+            worker->specify(env, this->parametricModel, *this->currentParametricCheckTask, false, false);
+            return worker;
+        }
+
         template <typename SparseModelType, typename ConstantType>
         void SparseMdpParameterLiftingModelChecker<SparseModelType, ConstantType>::specify_internal(Environment const& env, std::shared_ptr<SparseModelType> parametricModel, CheckTask<storm::logic::Formula, typename SparseModelType::ValueType> const& checkTask, bool generateRegionSplitEstimates, bool skipModelSimplification) {
 
@@ -232,6 +241,8 @@ namespace storm {
         template <typename SparseModelType, typename ConstantType>
         storm::modelchecker::SparseInstantiationModelChecker<SparseModelType, ConstantType>& SparseMdpParameterLiftingModelChecker<SparseModelType, ConstantType>::getInstantiationChecker() {
             if (!instantiationChecker) {
+                // The parametric model is shared with the other region refinement workers, which might instantiate it concurrently.
+                std::lock_guard<std::mutex> lock(storm::utility::parametric::getFunctionEvaluationMutex());
                 instantiationChecker = std::make_unique<storm::modelchecker::SparseMdpInstantiationModelChecker<SparseModelType, ConstantType>>(*this->parametricModel);
                 instantiationChecker->specifyFormula(this->currentCheckTask->template convertValueType<typename SparseModelType::ValueType>());
                 instantiationChecker->setInstantiationsAreGraphPreserving(true);
@@ -33,6 +33,8 @@ namespace storm {
             boost::optional<storm::storage::Scheduler<ConstantType>> getCurrentPlayer1Scheduler();
                 
         protected:
+            
+            virtual std::unique_ptr<RegionModelChecker<typename SparseModelType::ValueType>> createRefinementWorker(Environment const& env) const override;
                 
             virtual void specifyBoundedUntilFormula(Environment const& env, CheckTask<storm::logic::BoundedUntilFormula, ConstantType> const& checkTask) override;
             virtual void specifyUntilFormula(Environment const& env, CheckTask<storm::logic::UntilFormula, ConstantType> const& checkTask) override;
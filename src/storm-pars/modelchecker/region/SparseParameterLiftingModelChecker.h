@@ -85,6 +85,8 @@ namespace storm {
 
             std::shared_ptr<SparseModelType> parametricModel;
             std::unique_ptr<CheckTask<storm::logic::Formula, ConstantType>> currentCheckTask;
+            // The check task that was used to specify the current formula (w.r.t. the possibly simplified model). Used to specify refinement workers.
+            std::unique_ptr<CheckTask<storm::logic::Formula, typename SparseModelType::ValueType>> currentParametricCheckTask;
             ConstantType lastValue;
             boost::optional<storm::analysis::OrderExtender<typename SparseModelType::ValueType, ConstantType>> orderExtender;
 
@@ -26,6 +26,7 @@ namespace storm {
             const std::string MonotonicitySettings::monotonicityThreshold ="depth";
 
             const std::string MonotonicitySettings::monotoneParameters ="parameters";
+            const std::string MonotonicitySettings::assumptionThreads ="assumptionThreads";
 
             MonotonicitySettings::MonotonicitySettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, monotonicityAnalysis, false, "Sets whether monotonicity analysis is done").setIsAdvanced().setShortName(monotonicityAnalysisShortName).build());
@@ -40,6 +41,8 @@ namespace storm {
                                         .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(monotonicityThreshold, "The depth threshold from which on monotonicity is used for Parameter Lifting").setDefaultValueUnsignedInteger(0).build()).build());
 
                 this->addOption(storm::settings::OptionBuilder(moduleName, monotoneParameters, true, "Sets monotone parameters from file.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createStringArgument("monotoneParametersFilename", "The file where the monotone parameters are set").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, assumptionThreads, true, "Sets the number of threads that validate the assumptions created during monotonicity analysis.").setIsAdvanced()
+                                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads.").setDefaultValueUnsignedInteger(1).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
             }
 
             bool MonotonicitySettings::isMonotonicityAnalysisSet() const {
@@ -89,6 +92,10 @@ namespace storm {
             bool MonotonicitySettings::isMonSolutionSet() const {
                 return this->getOption(monSolution).getHasOptionBeenSet();
             }
+
+            uint_fast64_t MonotonicitySettings::getNumberOfAssumptionThreads() const {
+                return this->getOption(assumptionThreads).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
         } // namespace modules
     } // namespace settings
 } // namespace storm
@@ -66,6 +66,11 @@ namespace storm {
                  */
                 uint64_t getMonotonicityThreshold() const;
 
+                /*!
+                 * Retrieves the number of threads that validate assumptions in the monotonicity analysis
+                 */
+                uint_fast64_t getNumberOfAssumptionThreads() const;
+
 
                 const static std::string moduleName;
 
@@ -81,6 +86,7 @@ namespace storm {
                 const static std::string monotoneParameters;
                 const static std::string monSolution;
                 const static std::string monSolutionShortName;
+                const static std::string assumptionThreads;
 
             };
 
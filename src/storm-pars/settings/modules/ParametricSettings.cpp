@@ -21,6 +21,7 @@ namespace storm {
             const std::string ParametricSettings::samplesOptionName = "samples";
             const std::string ParametricSettings::samplesGraphPreservingOptionName = "samples-graph-preserving";
             const std::string ParametricSettings::sampleExactOptionName = "sample-exact";
+            const std::string ParametricSettings::sampleThreadsOptionName = "sample-threads";
             const std::string ParametricSettings::useMonotonicityName = "use-monotonicity";
 //            const std::string ParametricSettings::onlyGlobalName = "onlyGlobal";
 
@@ -34,6 +35,8 @@ namespace storm {
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("samples", "The samples are semicolon-separated entries of the form 'Var1=Val1:Val2:...:Valk,Var2=... that span the sample spaces.").setDefaultValueString("").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, samplesGraphPreservingOptionName, false, "Sets whether it can be assumed that the samples are graph-preserving.").build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, sampleExactOptionName, false, "Sets whether to sample using exact arithmetic.").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, sampleThreadsOptionName, false, "Sets the number of threads that check the samples in parallel.")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads.").setDefaultValueUnsignedInteger(1).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, useMonotonicityName, false, "If set, monotonicity will be used.").build());
 //                this->addOption(storm::settings::OptionBuilder(moduleName, onlyGlobalName, false, "If set, only global monotonicity will be used.").build());
             }
@@ -70,6 +73,10 @@ namespace storm {
                 return this->getOption(sampleExactOptionName).getHasOptionBeenSet();
             }
 
+            uint64_t ParametricSettings::getSampleThreadCount() const {
+                return this->getOption(sampleThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
             bool ParametricSettings::isUseMonotonicitySet() const {
                 return this->getOption(useMonotonicityName).getHasOptionBeenSet();
             }
@@ -63,6 +63,11 @@ namespace storm {
                  * Retrieves whether samples are to be computed exactly.
                  */
                 bool isSampleExactSet() const;
+                
+                /*!
+                 * Retrieves the number of threads that are used to check the samples.
+                 */
+                uint64_t getSampleThreadCount() const;
 
                 /*!
                  * Retrieves whether monotonicity should be used
@@ -82,6 +87,7 @@ namespace storm {
                 const static std::string samplesOptionName;
                 const static std::string samplesGraphPreservingOptionName;
                 const static std::string sampleExactOptionName;
+                const static std::string sampleThreadsOptionName;
                 const static std::string useMonotonicityName;
 //                const static std::string onlyGlobalName;
 
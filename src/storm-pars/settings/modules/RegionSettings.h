@@ -71,6 +71,11 @@ namespace storm {
                  */
                 uint64_t getDepthLimit() const;
                 
+                /*!
+                 * Retrieves the number of threads that analyze regions during refinement.
+                 */
+                uint64_t getRefinementThreads() const;
+                
                 /*!
 				 * Retrieves whether an extremal value is to be computed
 				 */
@@ -120,6 +125,7 @@ namespace storm {
 				const static std::string hypothesisOptionName;
 				const static std::string hypothesisShortOptionName;
 				const static std::string refineOptionName;
+				const static std::string refinementThreadsOptionName;
 				const static std::string splittingThresholdName;
 				const static std::string extremumOptionName;
 				const static std::string extremumSuggestionOptionName;
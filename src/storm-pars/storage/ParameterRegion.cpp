@@ -221,12 +221,12 @@ namespace storm {
         }
 
         template <typename ParametricType>
-        bool ParameterRegion<ParametricType>::isSubRegion(ParameterRegion<ParametricType> subRegion) {
-            auto varsRegion = getVariables();
-            auto varsSubRegion = subRegion.getVariables();
-            for (auto var : varsRegion) {
-                if (std::find(varsSubRegion.begin(), varsSubRegion.end(), var) != varsSubRegion.end()) {
-                    if (getLowerBoundary(var) > subRegion.getLowerBoundary(var) || getUpperBoundary(var) < getUpperBoundary(var)) {
+        bool ParameterRegion<ParametricType>::isSubRegion(ParameterRegion<ParametricType> const& subRegion) const {
+            auto const& varsRegion = getVariables();
+            auto const& varsSubRegion = subRegion.getVariables();
+            for (auto const& var : varsRegion) {
+                if (varsSubRegion.find(var) != varsSubRegion.end()) {
+                    if (getLowerBoundary(var) > subRegion.getLowerBoundary(var) || getUpperBoundary(var) < subRegion.getUpperBoundary(var)) {
                         return false;
                     }
                 } else {
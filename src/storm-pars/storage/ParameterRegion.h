@@ -79,7 +79,10 @@ namespace storm {
             //returns the region as string in the format 0.3<=p<=0.4,0.2<=q<=0.5;
             std::string toString(bool boundariesAsDouble = false) const;
 
-            bool isSubRegion(ParameterRegion<ParametricType> region);
+            /*!
+             * Returns true iff the given region is contained in this region.
+             */
+            bool isSubRegion(ParameterRegion<ParametricType> const& subRegion) const;
 
             CoefficientType getBoundParent();
             void setBoundParent(CoefficientType bound);
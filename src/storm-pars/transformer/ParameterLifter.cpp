@@ -1,5 +1,8 @@
 #include "storm-pars/transformer/ParameterLifter.h"
 
+#include <tuple>
+#include <type_traits>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/utility/vector.h"
 #include "storm/exceptions/UnexpectedException.h"
@@ -337,6 +340,17 @@ namespace storm {
     
         template<typename ParametricType, typename ConstantType>
         void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::evaluateCollectedFunctions(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters) {
+            // Floating point evaluation is only sound if we compute with floating point numbers anyway.
+            if (std::is_same<ConstantType, double>::value) {
+                if (!functionsCompiled) {
+                    std::lock_guard<std::mutex> lock(storm::utility::parametric::getFunctionEvaluationMutex());
+                    compileCollectedFunctions();
+                }
+                evaluateCompiledFunctions(region, dirForUnspecifiedParameters);
+                return;
+            }
+            
+            std::lock_guard<std::mutex> lock(storm::utility::parametric::getFunctionEvaluationMutex());
             for (auto &collectedFunctionValuationPlaceholder : collectedFunctions) {
                 ParametricType const &function = collectedFunctionValuationPlaceholder.first.first;
                 AbstractValuation const &abstrValuation = collectedFunctionValuationPlaceholder.first.second;
@@ -355,6 +369,113 @@ namespace storm {
             }
         }
         
+        template<typename ParametricType, typename ConstantType>
+        void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::compileCollectedFunctions() {
+            std::map<VariableType, uint_fast64_t> variableIndices;
+            auto getVariableIndex = [&] (VariableType const& var) {
+                auto insertionRes = variableIndices.emplace(var, compiledVariables.size());
+                if (insertionRes.second) {
+                    compiledVariables.push_back(var);
+                }
+                return insertionRes.first->second;
+            };
+            termFactorsBegin.assign(1, 0);
+            auto compilePolynomial = [&] (storm::RawPolynomial const& polynomial) {
+                uint_fast64_t termsBegin = termCoefficients.size();
+                for (auto const& term : polynomial) {
+                    termCoefficients.push_back(storm::utility::convertNumber<double>(term.coeff()));
+                    if (term.monomial()) {
+                        for (auto const& factor : *term.monomial()) {
+                            factorVariables.push_back(getVariableIndex(factor.first));
+                            factorExponents.push_back(factor.second);
+                        }
+                    }
+                    termFactorsBegin.push_back(factorVariables.size());
+                }
+                return std::make_pair(termsBegin, termCoefficients.size());
+            };
+            
+            compiledFunctionValuations.reserve(collectedFunctions.size());
+            for (auto& collectedFunctionValuationPlaceholder : collectedFunctions) {
+                ParametricType const& function = collectedFunctionValuationPlaceholder.first.first;
+                AbstractValuation const& abstrValuation = collectedFunctionValuationPlaceholder.first.second;
+                CompiledFunctionValuation compiled;
+                std::tie(compiled.nominatorTermsBegin, compiled.nominatorTermsEnd) = compilePolynomial(function.nominatorAsPolynomial().polynomialWithCoefficient());
+                std::tie(compiled.denominatorTermsBegin, compiled.denominatorTermsEnd) = compilePolynomial(function.denominatorAsPolynomial().polynomialWithCoefficient());
+                compiled.parametersBegin = parameterVariables.size();
+                for (auto const& var : abstrValuation.getLowerParameters()) {
+                    parameterVariables.push_back(getVariableIndex(var));
+                    parameterVertices.push_back(0);
+                }
+                for (auto const& var : abstrValuation.getUpperParameters()) {
+                    parameterVariables.push_back(getVariableIndex(var));
+                    parameterVertices.push_back(1);
+                }
+                compiled.numberOfUnspecifiedParameters = 0;
+                for (auto const& var : abstrValuation.getUnspecifiedParameters()) {
+                    parameterVariables.push_back(getVariableIndex(var));
+                    parameterVertices.push_back(2 + compiled.numberOfUnspecifiedParameters);
+                    ++compiled.numberOfUnspecifiedParameters;
+                }
+                compiled.parametersEnd = parameterVariables.size();
+                compiled.placeholder = &collectedFunctionValuationPlaceholder.second;
+                compiledFunctionValuations.push_back(std::move(compiled));
+            }
+            functionsCompiled = true;
+        }
+        
+        template<typename ParametricType, typename ConstantType>
+        double ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::evaluateCompiledTerms(uint_fast64_t termsBegin, uint_fast64_t termsEnd, std::vector<double> const& variableValues) const {
+            double result = 0.0;
+            for (uint_fast64_t term = termsBegin; term < termsEnd; ++term) {
+                double termValue = termCoefficients[term];
+                for (uint_fast64_t factor = termFactorsBegin[term]; factor < termFactorsBegin[term + 1]; ++factor) {
+                    double const& base = variableValues[factorVariables[factor]];
+                    for (uint_fast64_t exponent = factorExponents[factor]; exponent > 0; --exponent) {
+                        termValue *= base;
+                    }
+                }
+                result += termValue;
+            }
+            return result;
+        }
+        
+        template<typename ParametricType, typename ConstantType>
+        void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::evaluateCompiledFunctions(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters) {
+            // Gather the boundaries of the region once.
+            std::vector<double> lowerBoundaries, upperBoundaries;
+            lowerBoundaries.reserve(compiledVariables.size());
+            upperBoundaries.reserve(compiledVariables.size());
+            for (auto const& var : compiledVariables) {
+                lowerBoundaries.push_back(storm::utility::convertNumber<double>(region.getLowerBoundary(var)));
+                upperBoundaries.push_back(storm::utility::convertNumber<double>(region.getUpperBoundary(var)));
+            }
+            bool minimize = storm::solver::minimize(dirForUnspecifiedParameters);
+            
+            std::vector<double> variableValues(compiledVariables.size());
+            for (auto const& compiled : compiledFunctionValuations) {
+                double result = 0.0;
+                uint_fast64_t numberOfVertices = 1ull << compiled.numberOfUnspecifiedParameters;
+                for (uint_fast64_t vertex = 0; vertex < numberOfVertices; ++vertex) {
+                    for (uint_fast64_t parameter = compiled.parametersBegin; parameter < compiled.parametersEnd; ++parameter) {
+                        uint_fast64_t const& var = parameterVariables[parameter];
+                        uint_fast64_t const& parameterVertex = parameterVertices[parameter];
+                        bool useUpper = parameterVertex == 1 || (parameterVertex > 1 && ((vertex >> (parameterVertex - 2)) & 1) != 0);
+                        variableValues[var] = useUpper ? upperBoundaries[var] : lowerBoundaries[var];
+                    }
+                    double currentResult = evaluateCompiledTerms(compiled.nominatorTermsBegin, compiled.nominatorTermsEnd, variableValues) / evaluateCompiledTerms(compiled.denominatorTermsBegin, compiled.denominatorTermsEnd, variableValues);
+                    if (vertex == 0) {
+                        result = currentResult;
+                    } else if (minimize) {
+                        result = std::min(result, currentResult);
+                    } else {
+                        result = std::max(result, currentResult);
+                    }
+                }
+                *compiled.placeholder = storm::utility::convertNumber<ConstantType>(result);
+            }
+        }
+        
         template class ParameterLifter<storm::RationalFunction, double>;
         template class ParameterLifter<storm::RationalFunction, storm::RationalNumber>;
     }
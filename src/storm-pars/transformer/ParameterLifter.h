@@ -136,6 +136,21 @@ namespace storm {
                 void evaluateCollectedFunctions(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters);
                 
             private:
+                /*!
+                 * Compiles the collected functions into a flat representation (coefficients and exponent tables over doubles).
+                 * Evaluating the compiled functions only requires floating point arithmetic, i.e., it avoids to evaluate rational functions for each region.
+                 * This is done once, upon the first evaluation (where the collected functions are known).
+                 */
+                void compileCollectedFunctions();
+                
+                /*!
+                 * Evaluates the compiled functions and writes the results into the placeholders.
+                 */
+                void evaluateCompiledFunctions(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters);
+                
+                // Evaluates the polynomial given by the terms in the given range for the given variable values.
+                double evaluateCompiledTerms(uint_fast64_t termsBegin, uint_fast64_t termsEnd, std::vector<double> const& variableValues) const;
+
                 // Stores a function and a valuation. The valuation is stored as an index of the collectedValuations-vector.
                 typedef std::pair<ParametricType, AbstractValuation> FunctionValuation;
 
@@ -151,6 +166,27 @@ namespace storm {
 
                 // Stores the collected functions with the valuations together with a placeholder for the result.
                 std::unordered_map<FunctionValuation, ConstantType, FuncValHash> collectedFunctions;
+                
+                // A compiled function valuation consists of the terms of the nominator and the denominator as well as the parameters together with the vertex they are set to.
+                struct CompiledFunctionValuation {
+                    uint_fast64_t nominatorTermsBegin, nominatorTermsEnd;
+                    uint_fast64_t denominatorTermsBegin, denominatorTermsEnd;
+                    uint_fast64_t parametersBegin, parametersEnd;
+                    uint_fast64_t numberOfUnspecifiedParameters;
+                    ConstantType* placeholder;
+                };
+                
+                bool functionsCompiled = false;
+                std::vector<VariableType> compiledVariables;
+                std::vector<CompiledFunctionValuation> compiledFunctionValuations;
+                // Each term has a coefficient and the factors (variable index and exponent) in [termFactorsBegin[t], termFactorsBegin[t+1])
+                std::vector<double> termCoefficients;
+                std::vector<uint_fast64_t> termFactorsBegin;
+                std::vector<uint_fast64_t> factorVariables;
+                std::vector<uint_fast64_t> factorExponents;
+                // For each parameter of a function valuation, the variable index and the vertex: 0 (lower bound), 1 (upper bound) or 2+i (determined by the i-th bit of the considered vertex)
+                std::vector<uint_fast64_t> parameterVariables;
+                std::vector<uint_fast64_t> parameterVertices;
             };
             
             FunctionValuationCollector functionValuationCollector;
@@ -5,7 +5,7 @@ namespace storm {
     namespace utility {
         
             template<typename ParametricSparseModelType, typename ConstantSparseModelType>
-            ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::ModelInstantiator(ParametricSparseModelType const& parametricModel){
+            ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::ModelInstantiator(ParametricSparseModelType const& parametricModel) : supportPreserved(false) {
                 //Now pre-compute the information for the equation system.
                 initializeModelSpecificData(parametricModel);
                 initializeMatrixMapping(this->instantiatedModel->getTransitionMatrix(), this->functions, this->matrixMapping, parametricModel.getTransitionMatrix());
@@ -137,7 +137,10 @@ namespace storm {
             template<typename ParametricSparseModelType, typename ConstantSparseModelType>
             ConstantSparseModelType const& ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::instantiate(storm::utility::parametric::Valuation<ParametricType> const& valuation){
                 //Write results into the placeholders
-                instantiate_helper(valuation);
+                {
+                    std::lock_guard<std::mutex> lock(storm::utility::parametric::getFunctionEvaluationMutex());
+                    instantiate_helper(valuation);
+                }
                 
                 //Write the instantiated values to the matrices and vectors according to the stored mappings
                 for(auto& entryValuePair : this->matrixMapping){
@@ -146,10 +149,29 @@ namespace storm {
                 for(auto& entryValuePair : this->vectorMapping){
                     *(entryValuePair.first)=*(entryValuePair.second);
                 }
+                //The values were written in place, so the backward transitions stored in the instantiated model are outdated
+                this->instantiatedModel->invalidateBackwardTransitions();
+                
+                //Entries that do not depend on a placeholder are constant, so the support only changes if some placeholder switches between zero and non-zero
+                storm::storage::BitVector currentSupport(this->functions.size(), false);
+                uint_fast64_t functionIndex = 0;
+                for(auto const& functionResult : this->functions){
+                    if(!storm::utility::isZero(functionResult.second)){
+                        currentSupport.set(functionIndex, true);
+                    }
+                    ++functionIndex;
+                }
+                this->supportPreserved = this->previousSupport && this->previousSupport.get() == currentSupport;
+                this->previousSupport = std::move(currentSupport);
                 
                 return *this->instantiatedModel;
             }
         
+        template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+        bool ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::isSupportPreserved() const {
+            return this->supportPreserved;
+        }
+        
         template<typename ParametricSparseModelType, typename ConstantSparseModelType>
         void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::checkValid() const {
             // TODO write some checks
@@ -4,8 +4,10 @@
 #include <unordered_map>
 #include <memory>
 #include <type_traits>
+#include <boost/optional.hpp>
 
 #include "storm-pars/utility/parametric.h"
+#include "storm/storage/BitVector.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/Ctmc.h"
@@ -48,6 +50,13 @@ namespace storm {
                  */
                 ConstantSparseModelType const& instantiate(storm::utility::parametric::Valuation<ParametricType> const& valuation);
                 
+                /*!
+                 * Retrieves whether the most recent instantiation yields a model with the same support (i.e. the same non-zero transitions,
+                 * rewards and exit rates) as the instantiation before. In this case, the graph structure of the model did not change.
+                 * @return false if less than two instantiations have been performed so far.
+                 */
+                bool isSupportPreserved() const;
+                
                 /*!
                  *  Check validity
                  */
@@ -189,6 +198,10 @@ namespace storm {
                 std::vector<std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, ConstantType*>> matrixMapping; 
                 /// Connection of Vector entries with placeholders
                 std::vector<std::pair<typename std::vector<ConstantType>::iterator, ConstantType*>> vectorMapping; 
+                /// The placeholders (in the iteration order of functions) that were non-zero in the most recent instantiation
+                boost::optional<storm::storage::BitVector> previousSupport;
+                /// Whether the most recent instantiation had the same support as the one before
+                bool supportPreserved;
                 
                 
             };
@@ -52,6 +52,11 @@ namespace storm {
                 return true;
             }
 #endif
+            
+            std::mutex& getFunctionEvaluationMutex() {
+                static std::mutex functionEvaluationMutex;
+                return functionEvaluationMutex;
+            }
         }
     }
 }
@@ -4,6 +4,7 @@
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include <map>
+#include <mutex>
 
 namespace storm {
     namespace utility {
@@ -60,6 +61,12 @@ namespace storm {
             template<typename FunctionType>
             bool isMultiLinearPolynomial(FunctionType const& function);
             
+            /*!
+             * Retrieves a mutex that has to be held while parametric functions are evaluated by several threads concurrently,
+             * as the underlying function representation shares data (e.g. caches) among functions.
+             */
+            std::mutex& getFunctionEvaluationMutex();
+            
         }
         
     }
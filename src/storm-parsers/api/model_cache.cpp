@@ -0,0 +1,324 @@
+#include "storm-parsers/api/model_cache.h"
+
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+#include <boost/filesystem.hpp>
+
+#include "storm-parsers/parser/DirectEncodingParser.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/builder/BuilderOptions.h"
+#include "storm/io/DirectEncodingExporter.h"
+#include "storm/io/file.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BuildSettings.h"
+
+#include "storm/exceptions/FileIoException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace api {
+
+        namespace {
+            template<typename ValueType>
+            std::string getValueTypeName();
+
+            template<>
+            std::string getValueTypeName<double>() {
+                return "double";
+            }
+
+#ifdef STORM_HAVE_CARL
+            template<>
+            std::string getValueTypeName<storm::RationalNumber>() {
+                return "rational number";
+            }
+
+            template<>
+            std::string getValueTypeName<storm::RationalFunction>() {
+                return "rational function";
+            }
+#endif
+
+            // Computes the 64-bit FNV-1a hash of the given string. In contrast to std::hash, the result does not
+            // depend on the standard library, such that it can be used to name files.
+            std::string computeHash(std::string const& value) {
+                uint64_t hash = 14695981039346656037ull;
+                for (char const& character : value) {
+                    hash ^= static_cast<uint64_t>(static_cast<unsigned char>(character));
+                    hash *= 1099511628211ull;
+                }
+                std::stringstream stream;
+                stream << std::hex << std::setw(16) << std::setfill('0') << hash;
+                return stream.str();
+            }
+
+            boost::filesystem::path getKeyFile(std::string const& cacheDirectory, std::string const& key) {
+                return boost::filesystem::path(cacheDirectory) / (computeHash(key) + ".key");
+            }
+
+            boost::filesystem::path getModelFile(std::string const& cacheDirectory, std::string const& key) {
+                return boost::filesystem::path(cacheDirectory) / (computeHash(key) + ".drn");
+            }
+
+            boost::filesystem::path getLabelFile(std::string const& cacheDirectory, std::string const& key) {
+                return boost::filesystem::path(cacheDirectory) / (computeHash(key) + ".labels");
+            }
+
+            std::string readFile(boost::filesystem::path const& file) {
+                std::ifstream stream;
+                storm::utility::openFile(file.string(), stream);
+                std::stringstream content;
+                content << stream.rdbuf();
+                storm::utility::closeFile(stream);
+                return content.str();
+            }
+
+            // Summary of a cache entry that is stored in front of the key. It is used to detect entries whose model file is damaged.
+            struct EntrySummary {
+                uint64_t numberOfStates;
+                uint64_t numberOfChoices;
+                uint64_t numberOfTransitions;
+                std::string checksum;
+            };
+
+            void writeEntrySummary(std::ostream& stream, EntrySummary const& summary) {
+                stream << "states: " << summary.numberOfStates << std::endl;
+                stream << "choices: " << summary.numberOfChoices << std::endl;
+                stream << "transitions: " << summary.numberOfTransitions << std::endl;
+                stream << "checksum: " << summary.checksum << std::endl;
+            }
+
+            // Reads the summary from the given stream. Returns false if the stream does not start with a summary.
+            bool readEntrySummary(std::istream& stream, EntrySummary& summary) {
+                std::string line;
+                auto readValue = [&stream, &line] (std::string const& name) -> bool {
+                    return storm::utility::getline(stream, line) && line.compare(0, name.size() + 2, name + ": ") == 0;
+                };
+                try {
+                    if (!readValue("states")) {
+                        return false;
+                    }
+                    summary.numberOfStates = std::stoull(line.substr(8));
+                    if (!readValue("choices")) {
+                        return false;
+                    }
+                    summary.numberOfChoices = std::stoull(line.substr(9));
+                    if (!readValue("transitions")) {
+                        return false;
+                    }
+                    summary.numberOfTransitions = std::stoull(line.substr(13));
+                } catch (std::logic_error const&) {
+                    // Thrown by std::stoull for invalid numbers.
+                    return false;
+                }
+                if (!readValue("checksum")) {
+                    return false;
+                }
+                summary.checksum = line.substr(10);
+                return true;
+            }
+
+            // Writes the file via a temporary file, such that concurrent runs never read partially written files.
+            void writeFile(boost::filesystem::path const& file, std::function<void(std::ostream&)> const& writer) {
+                boost::filesystem::path temporaryFile = file;
+                temporaryFile += boost::filesystem::unique_path(".%%%%-%%%%-%%%%-%%%%");
+                std::ofstream stream;
+                try {
+                    storm::utility::openFile(temporaryFile.string(), stream, false, true);
+                    writer(stream);
+                    STORM_LOG_THROW(stream.good(), storm::exceptions::FileIoException, "Could not write file " << temporaryFile.string() << ".");
+                    storm::utility::closeFile(stream);
+                    boost::filesystem::rename(temporaryFile, file);
+                } catch (...) {
+                    // Do not leave the temporary file behind.
+                    if (stream.is_open()) {
+                        stream.close();
+                    }
+                    boost::system::error_code errorCode;
+                    boost::filesystem::remove(temporaryFile, errorCode);
+                    throw;
+                }
+            }
+        }
+
+        bool isModelCacheApplicable(storm::builder::BuilderOptions const& options) {
+            return !options.isBuildStateValuationsSet() && !options.isBuildObservationValuationsSet() && !options.isBuildChoiceLabelsSet() && !options.isBuildChoiceOriginsSet();
+        }
+
+        template<typename ValueType>
+        std::string computeModelCacheKey(storm::storage::SymbolicModelDescription const& modelDescription, storm::builder::BuilderOptions const& options) {
+            std::stringstream stream;
+            stream << "value type: " << getValueTypeName<ValueType>() << std::endl;
+
+            // Settings that are not part of the options but are considered by the model builder.
+            auto const& buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+            stream << "exploration order: " << buildSettings.getExplorationOrder() << std::endl;
+            stream << "fix deadlocks: " << !buildSettings.isDontFixDeadlocksSet() << std::endl;
+
+            stream << "maximal progress: " << options.isApplyMaximalProgressAssumptionSet() << std::endl;
+            stream << "scale and lift transition rewards: " << options.isScaleAndLiftTransitionRewardsSet() << std::endl;
+            stream << "infer observations from actions: " << options.isInferObservationsFromActionsSet() << std::endl;
+            stream << "out of bounds state: " << options.isAddOutOfBoundsStateSet() << std::endl;
+            stream << "overlapping guards label: " << options.isAddOverlappingGuardLabelSet() << std::endl;
+            stream << "bits for unbounded variables: " << options.getReservedBitsForUnboundedVariables() << std::endl;
+            stream << "reward models:";
+            if (options.isBuildAllRewardModelsSet()) {
+                stream << " all";
+            } else {
+                for (auto const& rewardModelName : options.getRewardModelNames()) {
+                    stream << " \"" << rewardModelName << "\"";
+                }
+            }
+            stream << std::endl << "labels:";
+            if (options.isBuildAllLabelsSet()) {
+                stream << " all";
+            } else {
+                for (auto const& labelName : options.getLabelNames()) {
+                    stream << " \"" << labelName << "\"";
+                }
+            }
+            stream << std::endl;
+            for (auto const& expressionLabel : options.getExpressionLabels()) {
+                stream << "expression label: \"" << expressionLabel.first << "\" " << expressionLabel.second << std::endl;
+            }
+            for (auto const& terminalState : options.getTerminalStates()) {
+                stream << "terminal states: " << (terminalState.second ? "" : "!");
+                if (terminalState.first.isLabel()) {
+                    stream << "\"" << terminalState.first.getLabel() << "\"";
+                } else {
+                    stream << terminalState.first.getExpression();
+                }
+                stream << std::endl;
+            }
+
+            // The (preprocessed) model also contains the values of the constants.
+            stream << "model:" << std::endl << modelDescription << std::endl;
+            return stream.str();
+        }
+
+        template<typename ValueType>
+        std::shared_ptr<storm::models::sparse::Model<ValueType>> loadModelFromCache(std::string const& cacheDirectory, std::string const& key) {
+            boost::filesystem::path keyFile = getKeyFile(cacheDirectory, key);
+            boost::filesystem::path modelFile = getModelFile(cacheDirectory, key);
+            if (!storm::utility::fileExistsAndIsReadable(keyFile.string()) || !storm::utility::fileExistsAndIsReadable(modelFile.string())) {
+                STORM_LOG_INFO("The model cache in " << cacheDirectory << " does not contain the model.");
+                return nullptr;
+            }
+
+            // The key file starts with a summary of the entry, followed by the full key.
+            std::ifstream stream;
+            storm::utility::openFile(keyFile.string(), stream);
+            EntrySummary summary;
+            bool hasSummary = readEntrySummary(stream, summary);
+            std::stringstream storedKey;
+            storedKey << stream.rdbuf();
+            storm::utility::closeFile(stream);
+            if (!hasSummary) {
+                STORM_LOG_WARN("Ignoring cache file " << keyFile.string() << " as it does not contain a valid summary of the entry.");
+                return nullptr;
+            }
+            // Compare the full key to rule out collisions of the hashes.
+            if (storedKey.str() != key) {
+                STORM_LOG_INFO("The model cache in " << cacheDirectory << " contains a different model with the same hash.");
+                return nullptr;
+            }
+
+            // A corrupt cache entry is not fatal as the model can still be built.
+            if (computeHash(readFile(modelFile)) != summary.checksum) {
+                STORM_LOG_WARN("Ignoring cache file " << modelFile.string() << " as its checksum does not match.");
+                return nullptr;
+            }
+            STORM_LOG_INFO("Loading model from cache file " << modelFile.string() << ".");
+            std::shared_ptr<storm::models::sparse::Model<ValueType>> model;
+            try {
+                model = storm::parser::DirectEncodingParser<ValueType>::parseModel(modelFile.string());
+            } catch (std::exception const& e) {
+                STORM_LOG_WARN("Could not load the model from cache file " << modelFile.string() << ": " << e.what());
+                return nullptr;
+            }
+            if (model->getNumberOfStates() != summary.numberOfStates || model->getNumberOfChoices() != summary.numberOfChoices || model->getNumberOfTransitions() != summary.numberOfTransitions) {
+                STORM_LOG_WARN("Ignoring cache file " << modelFile.string() << " as the loaded model has " << model->getNumberOfStates() << " states, " << model->getNumberOfChoices() << " choices and " << model->getNumberOfTransitions() << " transitions instead of " << summary.numberOfStates << " states, " << summary.numberOfChoices << " choices and " << summary.numberOfTransitions << " transitions.");
+                return nullptr;
+            }
+
+            // Labels without states do not appear in the DRN format and are therefore restored separately.
+            boost::filesystem::path labelFile = getLabelFile(cacheDirectory, key);
+            if (storm::utility::fileExistsAndIsReadable(labelFile.string())) {
+                std::ifstream labelStream;
+                storm::utility::openFile(labelFile.string(), labelStream);
+                std::string label;
+                while (storm::utility::getline(labelStream, label)) {
+                    if (!label.empty() && !model->getStateLabeling().containsLabel(label)) {
+                        model->getStateLabeling().addLabel(label);
+                    }
+                }
+                storm::utility::closeFile(labelStream);
+            }
+            return model;
+        }
+
+        template<typename ValueType>
+        void storeModelInCache(std::string const& cacheDirectory, std::string const& key, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model) {
+            switch (model->getType()) {
+                case storm::models::ModelType::Dtmc:
+                case storm::models::ModelType::Ctmc:
+                case storm::models::ModelType::Mdp:
+                case storm::models::ModelType::MarkovAutomaton:
+                case storm::models::ModelType::Pomdp:
+                    break;
+                default:
+                    STORM_LOG_WARN("Models of type " << model->getType() << " are not stored in the model cache.");
+                    return;
+            }
+
+            try {
+                boost::filesystem::create_directories(cacheDirectory);
+                // The key file is written last, such that it only exists for complete entries.
+                std::stringstream modelStream;
+                modelStream << std::setprecision(std::numeric_limits<double>::max_digits10);
+                storm::exporter::DirectEncodingOptions options;
+                options.allowPlaceholders = false;
+                storm::exporter::explicitExportSparseModel(modelStream, model, {}, options);
+                std::string modelContent = modelStream.str();
+                writeFile(getModelFile(cacheDirectory, key), [&modelContent] (std::ostream& stream) {
+                    stream << modelContent;
+                });
+                writeFile(getLabelFile(cacheDirectory, key), [&model] (std::ostream& stream) {
+                    for (auto const& label : model->getStateLabeling().getLabels()) {
+                        stream << label << std::endl;
+                    }
+                });
+                EntrySummary summary = {model->getNumberOfStates(), model->getNumberOfChoices(), model->getNumberOfTransitions(), computeHash(modelContent)};
+                writeFile(getKeyFile(cacheDirectory, key), [&key, &summary] (std::ostream& stream) {
+                    writeEntrySummary(stream, summary);
+                    stream << key;
+                });
+                STORM_LOG_INFO("Stored model in cache file " << getModelFile(cacheDirectory, key).string() << ".");
+            } catch (boost::filesystem::filesystem_error const& e) {
+                STORM_LOG_WARN("Could not store the model in the model cache in " << cacheDirectory << ": " << e.what());
+            } catch (storm::exceptions::BaseException const& e) {
+                STORM_LOG_WARN("Could not store the model in the model cache in " << cacheDirectory << ": " << e.what());
+            }
+        }
+
+        template std::string computeModelCacheKey<double>(storm::storage::SymbolicModelDescription const& modelDescription, storm::builder::BuilderOptions const& options);
+        template std::shared_ptr<storm::models::sparse::Model<double>> loadModelFromCache(std::string const& cacheDirectory, std::string const& key);
+        template void storeModelInCache(std::string const& cacheDirectory, std::string const& key, std::shared_ptr<storm::models::sparse::Model<double>> const& model);
+
+#ifdef STORM_HAVE_CARL
+        template std::string computeModelCacheKey<storm::RationalNumber>(storm::storage::SymbolicModelDescription const& modelDescription, storm::builder::BuilderOptions const& options);
+        template std::shared_ptr<storm::models::sparse::Model<storm::RationalNumber>> loadModelFromCache(std::string const& cacheDirectory, std::string const& key);
+        template void storeModelInCache(std::string const& cacheDirectory, std::string const& key, std::shared_ptr<storm::models::sparse::Model<storm::RationalNumber>> const& model);
+
+        template std::string computeModelCacheKey<storm::RationalFunction>(storm::storage::SymbolicModelDescription const& modelDescription, storm::builder::BuilderOptions const& options);
+        template std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> loadModelFromCache(std::string const& cacheDirectory, std::string const& key);
+        template void storeModelInCache(std::string const& cacheDirectory, std::string const& key, std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> const& model);
+#endif
+    }
+}
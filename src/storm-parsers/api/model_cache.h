@@ -0,0 +1,52 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "storm/models/sparse/Model.h"
+
+namespace storm {
+    namespace storage {
+        class SymbolicModelDescription;
+    }
+    namespace builder {
+        class BuilderOptions;
+    }
+
+    namespace api {
+
+        /*!
+         * Retrieves whether sparse models built with the given options can be cached. This is not the case if the
+         * model carries information that is not retained by the DRN format (state valuations, choice labels or choice
+         * origins).
+         */
+        bool isModelCacheApplicable(storm::builder::BuilderOptions const& options);
+
+        /*!
+         * Computes the key under which the sparse model built from the given (preprocessed) model description with the
+         * given options is cached. The key comprises the model description (including the values of the constants),
+         * the build options and the value type.
+         */
+        template<typename ValueType>
+        std::string computeModelCacheKey(storm::storage::SymbolicModelDescription const& modelDescription, storm::builder::BuilderOptions const& options);
+
+        /*!
+         * Loads the sparse model with the given key from the cache in the given directory.
+         *
+         * The entry is only used if the loaded model matches the number of states, choices and transitions as well as the
+         * checksum of the model file that were stored with the entry.
+         *
+         * @return The cached model or a null pointer if the cache does not contain a (valid) model for the key.
+         */
+        template<typename ValueType>
+        std::shared_ptr<storm::models::sparse::Model<ValueType>> loadModelFromCache(std::string const& cacheDirectory, std::string const& key);
+
+        /*!
+         * Stores the given sparse model with the given key in the cache in the given directory. The directory is
+         * created if necessary. Models of types that are not supported by the DRN format are not stored.
+         */
+        template<typename ValueType>
+        void storeModelInCache(std::string const& cacheDirectory, std::string const& key, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model);
+
+    }
+}
@@ -1,4 +1,5 @@
 #pragma once
 
 #include "storm-parsers/api/model_descriptions.h"
-#include "storm-parsers/api/properties.h"
\ No newline at end of file
+#include "storm-parsers/api/properties.h"
+#include "storm-parsers/api/model_cache.h"
\ No newline at end of file
@@ -35,6 +35,9 @@ namespace storm {
                 bool isExplorationTimeLimitSet() const;
                 uint64_t getExplorationTimeLimit() const;
                 
+                /// The number of threads that compute successor beliefs during exploration
+                uint64_t getExplorationThreads() const;
+                
                 /// Discretization Resolution
                 uint64_t getResolutionInit() const;
                 double getResolutionFactor() const;
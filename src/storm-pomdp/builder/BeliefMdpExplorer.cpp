@@ -9,7 +9,10 @@
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.cpp"
 #include "storm/models/sparse/Pomdp.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/SignalHandler.h"
 
@@ -28,7 +31,7 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType>
-        BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefMdpExplorer(std::shared_ptr<BeliefManagerType> beliefManager,storm::pomdp::modelchecker::TrivialPomdpValueBounds<ValueType> const &pomdpValueBounds) : beliefManager(beliefManager), pomdpValueBounds(pomdpValueBounds), status(Status::Uninitialized) {
+        BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefMdpExplorer(std::shared_ptr<BeliefManagerType> beliefManager,storm::pomdp::modelchecker::TrivialPomdpValueBounds<ValueType> const &pomdpValueBounds) : beliefManager(beliefManager), valuesOfExploredMdpComputed(false), pomdpValueBounds(pomdpValueBounds), status(Status::Uninitialized) {
             // Intentionally left empty
         }
 
@@ -56,6 +59,10 @@ namespace storm {
             targetStates.clear();
             truncatedStates.clear();
             delayedExplorationChoices.clear();
+            valuesOfExploredMdpComputed = false;
+            restoredChoices.clear();
+            unchangedStates.clear();
+            schedulerChoiceHint.clear();
             optimalChoices = boost::none;
             optimalChoicesReachableMdpStates = boost::none;
             exploredMdp = nullptr;
@@ -112,6 +119,8 @@ namespace storm {
             truncatedStates = storm::storage::BitVector(getCurrentNumberOfMdpStates(), false);
             delayedExplorationChoices.clear();
             mdpStatesToExplore.clear();
+            restoredChoices = storm::storage::BitVector(exploredMdp->getNumberOfChoices(), false);
+            unchangedStates.clear();
 
             // The extra states are not changed
             if (extraBottomState) {
@@ -151,6 +160,17 @@ namespace storm {
             return mdpStateToBeliefIdMap[currentMdpState];
         }
 
+        template<typename PomdpType, typename BeliefValueType>
+        std::vector<typename BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefId> BeliefMdpExplorer<PomdpType, BeliefValueType>::getBeliefIdsToExploreNext(uint64_t maxNumberOfStates) const {
+            STORM_LOG_ASSERT(status == Status::Exploring, "Method call is invalid in current status.");
+            std::vector<BeliefId> result;
+            result.reserve(std::min<uint64_t>(maxNumberOfStates, mdpStatesToExplore.size()));
+            for (auto stateIt = mdpStatesToExplore.begin(); stateIt != mdpStatesToExplore.end() && result.size() < maxNumberOfStates; ++stateIt) {
+                result.push_back(mdpStateToBeliefIdMap[*stateIt]);
+            }
+            return result;
+        }
+
         template<typename PomdpType, typename BeliefValueType>
         void BeliefMdpExplorer<PomdpType, BeliefValueType>::addTransitionsToExtraStates(uint64_t const &localActionIndex, ValueType const &targetStateValue,
                                                                                         ValueType const &bottomStateValue) {
@@ -299,6 +319,7 @@ namespace storm {
 
             uint64_t choiceIndex = exploredChoiceIndices[getCurrentMdpState()] + localActionIndex;
             STORM_LOG_ASSERT(choiceIndex < exploredChoiceIndices[getCurrentMdpState() + 1], "Invalid local action index.");
+            restoredChoices.set(choiceIndex, true);
 
             // Insert the transitions
             for (auto const &transition : exploredMdp->getTransitionMatrix().getRow(choiceIndex)) {
@@ -334,6 +355,25 @@ namespace storm {
                 mdpActionRewards.resize(getCurrentNumberOfMdpChoices(), storm::utility::zero<ValueType>());
             }
 
+            // Find the states whose behavior is the same as in the previously checked MDP.
+            // The value of target states does not depend on their behavior.
+            if (valuesOfExploredMdpComputed) {
+                unchangedStates = storm::storage::BitVector(getCurrentNumberOfMdpStates(), false);
+                for (uint64_t state = 0; state < exploredMdp->getNumberOfStates(); ++state) {
+                    if (targetStates.get(state) || restoredChoices.getNextUnsetIndex(exploredChoiceIndices[state]) >= exploredChoiceIndices[state + 1]) {
+                        unchangedStates.set(state, true);
+                    }
+                }
+            } else {
+                unchangedStates.clear();
+            }
+            valuesOfExploredMdpComputed = false;
+            restoredChoices.clear();
+            if (!schedulerChoiceHint.empty()) {
+                // New states get an arbitrary choice
+                schedulerChoiceHint.resize(getCurrentNumberOfMdpStates(), 0);
+            }
+
             // We are not exploring anymore
             currentMdpState = noState();
 
@@ -499,6 +539,12 @@ namespace storm {
             storm::utility::vector::filterVectorInPlace(lowerValueBounds, relevantMdpStates);
             storm::utility::vector::filterVectorInPlace(upperValueBounds, relevantMdpStates);
             storm::utility::vector::filterVectorInPlace(values, relevantMdpStates);
+            if (unchangedStates.size() > 0) {
+                unchangedStates = unchangedStates % relevantMdpStates;
+            }
+            if (!schedulerChoiceHint.empty()) {
+                storm::utility::vector::filterVectorInPlace(schedulerChoiceHint, relevantMdpStates);
+            }
 
         }
 
@@ -565,15 +611,72 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType>
-        void BeliefMdpExplorer<PomdpType, BeliefValueType>::computeValuesOfExploredMdp(storm::solver::OptimizationDirection const &dir) {
+        void BeliefMdpExplorer<PomdpType, BeliefValueType>::computeValuesOfExploredMdp(storm::Environment const &env, storm::solver::OptimizationDirection const &dir) {
             STORM_LOG_ASSERT(status == Status::ModelFinished, "Method call is invalid in current status.");
             STORM_LOG_ASSERT(exploredMdp, "Tried to compute values but the MDP is not explored");
             auto property = createStandardProperty(dir, exploredMdp->hasRewardModel());
-            auto task = createStandardCheckTask(property);
 
-            std::unique_ptr<storm::modelchecker::CheckResult> res(storm::api::verifyWithSparseEngine<ValueType>(exploredMdp, task));
+            // Only states that can reach a state whose behavior changed since the previous check need to be considered.
+            storm::storage::BitVector statesToRecompute(exploredMdp->getNumberOfStates(), true);
+            if (unchangedStates.size() == exploredMdp->getNumberOfStates()) {
+                statesToRecompute = storm::utility::graph::performProbGreater0E(exploredMdp->getBackwardTransitions(), statesToRecompute, ~unchangedStates);
+                STORM_LOG_INFO("Recomputing the values of " << statesToRecompute.getNumberOfSetBits() << " of " << statesToRecompute.size() << " states of the explored MDP.");
+            }
+            if (statesToRecompute.empty()) {
+                // Nothing changed, so the values of the previous check remain valid.
+                valuesOfExploredMdpComputed = true;
+                status = Status::ModelChecked;
+                return;
+            }
+            std::shared_ptr<storm::models::sparse::Mdp<ValueType>> mdpToCheck = exploredMdp;
+            if (!statesToRecompute.full()) {
+                mdpToCheck = createMdpForStatesToRecompute(statesToRecompute);
+                if (!mdpToCheck) {
+                    statesToRecompute.fill();
+                    mdpToCheck = exploredMdp;
+                }
+            }
+
+            // Warm start from the values (and, for policy iteration, the scheduler) of the previous check.
+            std::vector<ValueType> resultHint = storm::utility::vector::filterVector(values, statesToRecompute);
+            if (mdpToCheck != exploredMdp) {
+                // Hints for the extra target (and bottom) state
+                resultHint.push_back(mdpToCheck->hasRewardModel() ? storm::utility::zero<ValueType>() : storm::utility::one<ValueType>());
+                if (!mdpToCheck->hasRewardModel()) {
+                    resultHint.push_back(storm::utility::zero<ValueType>());
+                }
+            }
+            bool produceScheduler = env.solver().minMax().getMethod() == storm::solver::MinMaxMethod::PolicyIteration;
+            boost::optional<storm::storage::Scheduler<ValueType>> schedulerHint;
+            if (produceScheduler && !schedulerChoiceHint.empty()) {
+                schedulerHint = storm::storage::Scheduler<ValueType>(mdpToCheck->getNumberOfStates());
+                uint64_t subState = 0;
+                for (auto state : statesToRecompute) {
+                    schedulerHint->setChoice(schedulerChoiceHint[state], subState);
+                    ++subState;
+                }
+                for (; subState < mdpToCheck->getNumberOfStates(); ++subState) {
+                    schedulerHint->setChoice(0, subState);
+                }
+            }
+            auto task = createStandardCheckTask(property, std::move(resultHint), std::move(schedulerHint));
+            task.setProduceSchedulers(produceScheduler);
+
+            std::unique_ptr<storm::modelchecker::CheckResult> res(storm::api::verifyWithSparseEngine<ValueType>(env, mdpToCheck, task));
             if (res) {
-                values = std::move(res->asExplicitQuantitativeCheckResult<ValueType>().getValueVector());
+                auto const &quantitativeResult = res->asExplicitQuantitativeCheckResult<ValueType>();
+                if (produceScheduler && schedulerChoiceHint.empty()) {
+                    schedulerChoiceHint.resize(exploredMdp->getNumberOfStates(), 0);
+                }
+                uint64_t subState = 0;
+                for (auto state : statesToRecompute) {
+                    values[state] = quantitativeResult[subState];
+                    if (produceScheduler) {
+                        schedulerChoiceHint[state] = quantitativeResult.getScheduler().getChoice(subState).getDeterministicChoice();
+                    }
+                    ++subState;
+                }
+                valuesOfExploredMdpComputed = true;
                 STORM_LOG_WARN_COND_DEBUG(storm::utility::vector::compareElementWise(lowerValueBounds, values, std::less_equal<ValueType>()),
                                           "Computed values are smaller than the lower bound.");
                 STORM_LOG_WARN_COND_DEBUG(storm::utility::vector::compareElementWise(upperValueBounds, values, std::greater_equal<ValueType>()),
@@ -720,17 +823,95 @@ namespace storm {
 
         template<typename PomdpType, typename BeliefValueType>
         storm::modelchecker::CheckTask<storm::logic::Formula, typename BeliefMdpExplorer<PomdpType, BeliefValueType>::ValueType>
-        BeliefMdpExplorer<PomdpType, BeliefValueType>::createStandardCheckTask(std::shared_ptr<storm::logic::Formula const> &property) {
+        BeliefMdpExplorer<PomdpType, BeliefValueType>::createStandardCheckTask(std::shared_ptr<storm::logic::Formula const> &property, std::vector<ValueType> &&resultHint,
+                                                                               boost::optional<storm::storage::Scheduler<ValueType>> &&schedulerHint) {
             //Note: The property should not run out of scope after calling this because the task only stores the property by reference.
             // Therefore, this method needs the property by reference (and not const reference)
             auto task = storm::api::createTask<ValueType>(property, false);
             auto hint = storm::modelchecker::ExplicitModelCheckerHint<ValueType>();
-            hint.setResultHint(values);
+            hint.setResultHint(std::move(resultHint));
+            hint.setSchedulerHint(std::move(schedulerHint));
             auto hintPtr = std::make_shared<storm::modelchecker::ExplicitModelCheckerHint<ValueType>>(hint);
             task.setHint(hintPtr);
             return task;
         }
 
+        template<typename PomdpType, typename BeliefValueType>
+        std::shared_ptr<storm::models::sparse::Mdp<typename BeliefMdpExplorer<PomdpType, BeliefValueType>::ValueType>>
+        BeliefMdpExplorer<PomdpType, BeliefValueType>::createMdpForStatesToRecompute(storm::storage::BitVector const &statesToRecompute) const {
+            STORM_LOG_ASSERT(exploredMdp, "Tried to create a sub-MDP but no MDP was explored.");
+            bool computeRewards = exploredMdp->hasRewardModel();
+            auto const &transitionMatrix = exploredMdp->getTransitionMatrix();
+            auto const &rowGroupIndices = transitionMatrix.getRowGroupIndices();
+            std::vector<uint64_t> toSubState = statesToRecompute.getNumberOfSetBitsBeforeIndices();
+            MdpStateType extraTarget = statesToRecompute.getNumberOfSetBits();
+            MdpStateType extraBottom = extraTarget + 1;
+            MdpStateType numberOfSubStates = computeRewards ? extraTarget + 1 : extraBottom + 1;
+
+            storm::storage::SparseMatrixBuilder<ValueType> builder(0, numberOfSubStates, 0, false, true);
+            std::vector<ValueType> subActionRewards;
+            uint64_t subRow = 0;
+            for (auto state : statesToRecompute) {
+                builder.newRowGroup(subRow);
+                for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row, ++subRow) {
+                    std::map<MdpStateType, ValueType> subTransitions;
+                    ValueType reward = computeRewards ? exploredMdp->getUniqueRewardModel().getStateActionReward(row) : storm::utility::zero<ValueType>();
+                    for (auto const &entry : transitionMatrix.getRow(row)) {
+                        if (statesToRecompute.get(entry.getColumn())) {
+                            subTransitions[toSubState[entry.getColumn()]] += entry.getValue();
+                        } else {
+                            // The value of this successor is known from the previous check.
+                            ValueType const &successorValue = values[entry.getColumn()];
+                            if (computeRewards) {
+                                if (storm::utility::isInfinity(successorValue)) {
+                                    return nullptr;
+                                }
+                                reward += entry.getValue() * successorValue;
+                                subTransitions[extraTarget] += entry.getValue();
+                            } else {
+                                if (!storm::utility::isZero(successorValue)) {
+                                    subTransitions[extraTarget] += entry.getValue() * successorValue;
+                                }
+                                if (!storm::utility::isOne(successorValue)) {
+                                    subTransitions[extraBottom] += entry.getValue() * (storm::utility::one<ValueType>() - successorValue);
+                                }
+                            }
+                        }
+                    }
+                    for (auto const &subTransition : subTransitions) {
+                        builder.addNextValue(subRow, subTransition.first, subTransition.second);
+                    }
+                    if (computeRewards) {
+                        subActionRewards.push_back(std::move(reward));
+                    }
+                }
+            }
+            // Add the extra states
+            for (MdpStateType extraState = extraTarget; extraState < numberOfSubStates; ++extraState) {
+                builder.newRowGroup(subRow);
+                builder.addNextValue(subRow, extraState, storm::utility::one<ValueType>());
+                if (computeRewards) {
+                    subActionRewards.push_back(storm::utility::zero<ValueType>());
+                }
+                ++subRow;
+            }
+
+            storm::models::sparse::StateLabeling subLabeling(numberOfSubStates);
+            subLabeling.addLabel("init");
+            subLabeling.addLabelToState("init", statesToRecompute.get(initialMdpState) ? toSubState[initialMdpState] : extraTarget);
+            storm::storage::BitVector subTargetStates = exploredMdp->getStates("target") % statesToRecompute;
+            subTargetStates.resize(numberOfSubStates, false);
+            subTargetStates.set(extraTarget, true);
+            subLabeling.addLabel("target", std::move(subTargetStates));
+
+            std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>> subRewardModels;
+            if (computeRewards) {
+                subRewardModels.emplace("default", storm::models::sparse::StandardRewardModel<ValueType>(boost::optional<std::vector<ValueType>>(), std::move(subActionRewards)));
+            }
+            storm::storage::sparse::ModelComponents<ValueType> modelComponents(builder.build(), std::move(subLabeling), std::move(subRewardModels));
+            return std::make_shared<storm::models::sparse::Mdp<ValueType>>(std::move(modelComponents));
+        }
+
         template<typename PomdpType, typename BeliefValueType>
         typename BeliefMdpExplorer<PomdpType, BeliefValueType>::MdpStateType BeliefMdpExplorer<PomdpType, BeliefValueType>::getCurrentMdpState() const {
             STORM_LOG_ASSERT(status == Status::Exploring, "Method call is invalid in current status.");
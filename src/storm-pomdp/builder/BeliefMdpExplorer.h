@@ -8,10 +8,12 @@
 
 
 #include "storm/storage/BitVector.h"
+#include "storm/storage/Scheduler.h"
 #include "storm-pomdp/storage/BeliefManager.h"
 #include "storm-pomdp/modelchecker/TrivialPomdpValueBoundsModelChecker.h"
 
 namespace storm {
+    class Environment;
     
     namespace builder {
         template<typename PomdpType, typename BeliefValueType = typename PomdpType::ValueType>
@@ -58,6 +60,11 @@ namespace storm {
 
             BeliefId exploreNextState();
 
+            /*!
+             * Retrieves the beliefs of (at most) the given number of states that are explored next, in the order in which they will be explored.
+             */
+            std::vector<BeliefId> getBeliefIdsToExploreNext(uint64_t maxNumberOfStates) const;
+
             void addTransitionsToExtraStates(uint64_t const &localActionIndex, ValueType const &targetStateValue = storm::utility::zero<ValueType>(),
                                              ValueType const &bottomStateValue = storm::utility::zero<ValueType>());
 
@@ -139,7 +146,13 @@ namespace storm {
 
             ValueType computeUpperValueBoundAtBelief(BeliefId const &beliefId) const;
 
-            void computeValuesOfExploredMdp(storm::solver::OptimizationDirection const &dir);
+            /*!
+             * Computes the values of the explored MDP.
+             * If the MDP results from a restarted exploration whose previous MDP has been checked, only the states that can reach a state with changed behavior are considered.
+             * The values of the remaining states are taken from the previous check.
+             * @param env the environment that is used for checking the MDP
+             */
+            void computeValuesOfExploredMdp(storm::Environment const &env, storm::solver::OptimizationDirection const &dir);
 
             bool hasComputedValues() const;
 
@@ -173,7 +186,15 @@ namespace storm {
 
             std::shared_ptr<storm::logic::Formula const> createStandardProperty(storm::solver::OptimizationDirection const &dir, bool computeRewards);
 
-            storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> createStandardCheckTask(std::shared_ptr<storm::logic::Formula const> &property);
+            storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> createStandardCheckTask(std::shared_ptr<storm::logic::Formula const> &property, std::vector<ValueType> &&resultHint,
+                                                                                                     boost::optional<storm::storage::Scheduler<ValueType>> &&schedulerHint = boost::none);
+
+            /*!
+             * Creates an MDP that only considers the given states of the explored MDP. Transitions to other states are redirected to an extra target (and an extra bottom) state,
+             * using the values of the previous check for these states. The extra states are the last states of the resulting MDP.
+             * @return the MDP or nullptr if the MDP can not be created (because the value of a redirected state is infinite)
+             */
+            std::shared_ptr<storm::models::sparse::Mdp<ValueType>> createMdpForStatesToRecompute(storm::storage::BitVector const &statesToRecompute) const;
 
             MdpStateType getCurrentMdpState() const;
 
@@ -209,6 +230,12 @@ namespace storm {
             storm::storage::BitVector truncatedStates;
             MdpStateType initialMdpState;
             storm::storage::BitVector delayedExplorationChoices;
+            
+            // Information about the behavior that did not change w.r.t. the previously explored (and checked) MDP
+            bool valuesOfExploredMdpComputed;
+            storm::storage::BitVector restoredChoices;
+            storm::storage::BitVector unchangedStates;
+            std::vector<uint64_t> schedulerChoiceHint; // For each state a local choice index that was optimal in the previous check (if available)
 
             // Final Mdp
             std::shared_ptr<storm::models::sparse::Mdp<ValueType>> exploredMdp;
@@ -19,6 +19,10 @@ namespace storm {
                 boost::optional<uint64_t> refineStepLimit;
                 ValueType refinePrecision = storm::utility::zero<ValueType>();
                 boost::optional<uint64_t> explorationTimeLimit;
+                // The number of threads that compute successor beliefs (and their triangulations) in advance
+                uint64_t explorationThreads = 1;
+                // How many of the states that are explored next are considered when computing successor beliefs in advance
+                uint64_t explorationBatchSize = 1000;
                 
                 // Controlparameters for the refinement heuristic
                 // Discretization Resolution
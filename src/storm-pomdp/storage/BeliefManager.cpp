@@ -1,10 +1,16 @@
 #include "storm-pomdp/storage/BeliefManager.h"
 
+#include <algorithm>
+
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/NumberTraits.h"
+#include "storm/utility/parallel.h"
 #include "storm/models/sparse/Pomdp.h"
 
+#include "storm/exceptions/InvalidArgumentException.h"
+
 namespace storm {
     namespace storage {
 
@@ -29,7 +35,23 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        std::size_t BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefHash::operator()(const BeliefType &belief) const {
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView::const_iterator BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView::begin() const {
+            return beginEntry;
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView::const_iterator BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView::end() const {
+            return endEntry;
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView::size() const {
+            return endEntry - beginEntry;
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        template<typename BeliefRangeType>
+        std::size_t BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefHash::operator()(BeliefRangeType const &belief) const {
             std::size_t seed = 0;
             // Assumes that beliefs are ordered
             for (auto const &entry : belief) {
@@ -43,7 +65,8 @@ namespace storm {
         BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefManager(PomdpType const &pomdp, BeliefValueType const &precision, TriangulationMode const &triangulationMode)
                 : pomdp(pomdp), triangulationMode(triangulationMode) {
             cc = storm::utility::ConstantsComparator<ValueType>(precision, false);
-            beliefToIdMap.resize(pomdp.getNrObservations());
+            beliefEntriesBegin.push_back(0);
+            beliefHashToIdMap.resize(pomdp.getNrObservations());
             initialBeliefId = computeInitialBelief();
         }
 
@@ -69,12 +92,12 @@ namespace storm {
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         bool BeliefManager<PomdpType, BeliefValueType, StateType>::isEqual(BeliefId const &first, BeliefId const &second) const {
-            return isEqual(getBelief(first), getBelief(second));
+            return isEqualBelief(getBelief(first), getBelief(second));
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         std::string BeliefManager<PomdpType, BeliefValueType, StateType>::toString(BeliefId const &beliefId) const {
-            return toString(getBelief(beliefId));
+            return beliefToString(getBelief(beliefId));
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -82,7 +105,7 @@ namespace storm {
             std::stringstream str;
             str << "(\n";
             for (uint64_t i = 0; i < t.size(); ++i) {
-                str << "\t" << t.weights[i] << " * \t" << toString(getBelief(t.gridPoints[i])) << "\n";
+                str << "\t" << t.weights[i] << " * \t" << beliefToString(getBelief(t.gridPoints[i])) << "\n";
             }
             str << ")\n";
             return str.str();
@@ -121,7 +144,7 @@ namespace storm {
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefId beliefId) {
-            return getBeliefObservation(getBelief(beliefId));
+            return getObservation(getBelief(beliefId));
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -133,12 +156,14 @@ namespace storm {
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation
         BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(BeliefId beliefId, BeliefValueType resolution) {
-            return triangulateBelief(getBelief(beliefId), resolution);
+            // Triangulating might add new beliefs which invalidates the view on the stored belief. Hence, we copy it.
+            auto storedBelief = getBelief(beliefId);
+            return triangulateBelief(BeliefType(boost::container::ordered_unique_range, storedBelief.begin(), storedBelief.end()), resolution);
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         template<typename DistributionType>
-        void BeliefManager<PomdpType, BeliefValueType, StateType>::addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value) {
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value) const {
             auto insertionRes = distr.emplace(state, value);
             if (!insertionRes.second) {
                 insertionRes.first->second += value;
@@ -155,7 +180,7 @@ namespace storm {
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getNumberOfBeliefIds() const {
-            return beliefs.size();
+            return beliefEntriesBegin.size() - 1;
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -172,23 +197,38 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType const &BeliefManager<PomdpType, BeliefValueType, StateType>::getBelief(BeliefId const &id) const {
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView BeliefManager<PomdpType, BeliefValueType, StateType>::getBelief(BeliefId const &id) const {
             STORM_LOG_ASSERT(id != noId(), "Tried to get a non-existend belief.");
             STORM_LOG_ASSERT(id < getNumberOfBeliefIds(), "Belief index " << id << " is out of range.");
-            return beliefs[id];
+            return BeliefView{beliefEntries.data() + beliefEntriesBegin[id], beliefEntries.data() + beliefEntriesBegin[id + 1]};
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getId(BeliefType const &belief) const {
-            uint32_t obs = getBeliefObservation(belief);
-            STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
-            auto idIt = beliefToIdMap[obs].find(belief);
-            STORM_LOG_ASSERT(idIt != beliefToIdMap[obs].end(), "Unknown Belief.");
-            return idIt->second;
+            uint32_t obs = getObservation(belief);
+            STORM_LOG_ASSERT(obs < beliefHashToIdMap.size(), "Belief has unknown observation.");
+            BeliefId id = findBeliefId(belief, obs, BeliefHash()(belief));
+            STORM_LOG_ASSERT(id != noId(), "Unknown Belief.");
+            return id;
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId
+        BeliefManager<PomdpType, BeliefValueType, StateType>::findBeliefId(BeliefType const &belief, uint32_t const &observation, std::size_t const &hash) const {
+            auto candidates = beliefHashToIdMap[observation].equal_range(hash);
+            for (auto candidateIt = candidates.first; candidateIt != candidates.second; ++candidateIt) {
+                auto storedBelief = getBelief(candidateIt->second);
+                // The entries are stored consecutively, so this is a plain comparison of two arrays
+                if (storedBelief.size() == belief.size() && std::equal(storedBelief.begin(), storedBelief.end(), belief.begin())) {
+                    return candidateIt->second;
+                }
+            }
+            return noId();
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        std::string BeliefManager<PomdpType, BeliefValueType, StateType>::toString(BeliefType const &belief) const {
+        template<typename BeliefRangeType>
+        std::string BeliefManager<PomdpType, BeliefValueType, StateType>::beliefToString(BeliefRangeType const &belief) const {
             std::stringstream str;
             str << "{ ";
             bool first = true;
@@ -205,7 +245,8 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        bool BeliefManager<PomdpType, BeliefValueType, StateType>::isEqual(BeliefType const &first, BeliefType const &second) const {
+        template<typename FirstBeliefRangeType, typename SecondBeliefRangeType>
+        bool BeliefManager<PomdpType, BeliefValueType, StateType>::isEqualBelief(FirstBeliefRangeType const &first, SecondBeliefRangeType const &second) const {
             if (first.size() != second.size()) {
                 return false;
             }
@@ -223,7 +264,8 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertBelief(BeliefType const &belief) const {
+        template<typename BeliefRangeType>
+        bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertBelief(BeliefRangeType const &belief) const {
             BeliefValueType sum = storm::utility::zero<ValueType>();
             boost::optional<uint32_t> observation;
             for (auto const &entry : belief) {
@@ -264,34 +306,33 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(BeliefType const &belief, Triangulation const &triangulation) const {
-            if (triangulation.weights.size() != triangulation.gridPoints.size()) {
+        bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(BeliefType const &belief, std::vector<BeliefType> const &gridPoints, std::vector<BeliefValueType> const &weights) const {
+            if (weights.size() != gridPoints.size()) {
                 STORM_LOG_ERROR("Number of weights and points in triangulation does not match.");
                 return false;
             }
-            if (triangulation.size() == 0) {
+            if (weights.empty()) {
                 STORM_LOG_ERROR("Empty triangulation.");
                 return false;
             }
             BeliefType triangulatedBelief;
             BeliefValueType weightSum = storm::utility::zero<BeliefValueType>();
-            for (uint64_t i = 0; i < triangulation.weights.size(); ++i) {
-                if (cc.isZero(triangulation.weights[i])) {
+            for (uint64_t i = 0; i < weights.size(); ++i) {
+                if (cc.isZero(weights[i])) {
                     STORM_LOG_ERROR("Zero weight in triangulation.");
                     return false;
                 }
-                if (cc.isLess(triangulation.weights[i], storm::utility::zero<BeliefValueType>())) {
+                if (cc.isLess(weights[i], storm::utility::zero<BeliefValueType>())) {
                     STORM_LOG_ERROR("Negative weight in triangulation.");
                     return false;
                 }
-                if (cc.isLess(storm::utility::one<BeliefValueType>(), triangulation.weights[i])) {
+                if (cc.isLess(storm::utility::one<BeliefValueType>(), weights[i])) {
                     STORM_LOG_ERROR("Weight greater than one in triangulation.");
                 }
-                weightSum += triangulation.weights[i];
-                BeliefType const &gridPoint = getBelief(triangulation.gridPoints[i]);
-                for (auto const &pointEntry : gridPoint) {
+                weightSum += weights[i];
+                for (auto const &pointEntry : gridPoints[i]) {
                     BeliefValueType &triangulatedValue = triangulatedBelief.emplace(pointEntry.first, storm::utility::zero<ValueType>()).first->second;
-                    triangulatedValue += triangulation.weights[i] * pointEntry.second;
+                    triangulatedValue += weights[i] * pointEntry.second;
                 }
             }
             if (!cc.isOne(weightSum)) {
@@ -301,22 +342,23 @@ namespace storm {
             if (!assertBelief(triangulatedBelief)) {
                 STORM_LOG_ERROR("Triangulated belief is not a belief.");
             }
-            if (!isEqual(belief, triangulatedBelief)) {
-                STORM_LOG_ERROR("Belief:\n\t" << toString(belief) << "\ndoes not match triangulated belief:\n\t" << toString(triangulatedBelief) << ".");
+            if (!isEqualBelief(belief, triangulatedBelief)) {
+                STORM_LOG_ERROR("Belief:\n\t" << beliefToString(belief) << "\ndoes not match triangulated belief:\n\t" << beliefToString(triangulatedBelief) << ".");
                 return false;
             }
             return true;
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefType belief) const {
+        template<typename BeliefRangeType>
+        uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getObservation(BeliefRangeType const &belief) const {
             STORM_LOG_ASSERT(assertBelief(belief), "Invalid belief.");
             return pomdp.getObservation(belief.begin()->first);
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        void
-        BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result) {
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, std::vector<BeliefType> &gridPoints,
+                                                                                               std::vector<BeliefValueType> &weights) const {
             STORM_LOG_ASSERT(resolution != 0, "Invalid resolution: 0");
             STORM_LOG_ASSERT(storm::utility::isInteger(resolution), "Expected an integer resolution");
             StateType numEntries = belief.size();
@@ -340,8 +382,8 @@ namespace storm {
             // Insert a dummy 0 column in the qs matrix so the loops below are a bit simpler
             qsRow.push_back(storm::utility::zero<BeliefValueType>());
 
-            result.weights.reserve(numEntries);
-            result.gridPoints.reserve(numEntries);
+            weights.reserve(numEntries);
+            gridPoints.reserve(numEntries);
             auto currentSortedDiff = sorted_diffs.begin();
             auto previousSortedDiff = sorted_diffs.end();
             --previousSortedDiff;
@@ -356,7 +398,7 @@ namespace storm {
                     qsRow[previousSortedDiff->dimension] += storm::utility::one<BeliefValueType>();
                 }
                 if (!cc.isZero(weight)) {
-                    result.weights.push_back(weight);
+                    weights.push_back(weight);
                     // Compute the grid point
                     BeliefType gridPoint;
                     for (StateType j = 0; j < numEntries; ++j) {
@@ -365,14 +407,15 @@ namespace storm {
                             gridPoint[toOriginalIndicesMap[j]] = gridPointEntry / resolution;
                         }
                     }
-                    result.gridPoints.push_back(getOrAddBeliefId(gridPoint));
+                    gridPoints.push_back(std::move(gridPoint));
                 }
                 previousSortedDiff = currentSortedDiff++;
             }
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result) {
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, std::vector<BeliefType> &gridPoints,
+                                                                                           std::vector<BeliefValueType> &weights) const {
             // Find the best resolution for this belief, i.e., N such that the largest distance between one of the belief values to a value in {i/N | 0 ≤ i ≤ N} is minimal
             STORM_LOG_ASSERT(storm::utility::isInteger(resolution), "Expected an integer resolution");
             BeliefValueType finalResolution = resolution;
@@ -402,45 +445,56 @@ namespace storm {
                 }
             }
 
-            STORM_LOG_TRACE("Picking resolution " << finalResolution << " for belief " << toString(belief));
+            STORM_LOG_TRACE("Picking resolution " << finalResolution << " for belief " << beliefToString(belief));
 
             // do standard freudenthal with the found resolution
-            triangulateBeliefFreudenthal(belief, finalResolution, result);
+            triangulateBeliefFreudenthal(belief, finalResolution, gridPoints, weights);
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation
-        BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(BeliefType const &belief, BeliefValueType const &resolution) {
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefToGridPoints(BeliefType const &belief, BeliefValueType const &resolution, std::vector<BeliefType> &gridPoints,
+                                                                                                std::vector<BeliefValueType> &weights) const {
             STORM_LOG_ASSERT(assertBelief(belief), "Input belief for triangulation is not valid.");
-            Triangulation result;
             // Quickly triangulate Dirac beliefs
             if (belief.size() == 1u) {
-                result.weights.push_back(storm::utility::one<BeliefValueType>());
-                result.gridPoints.push_back(getOrAddBeliefId(belief));
+                weights.push_back(storm::utility::one<BeliefValueType>());
+                gridPoints.push_back(belief);
             } else {
                 auto ceiledResolution = storm::utility::ceil<BeliefValueType>(resolution);
                 switch (triangulationMode) {
                     case TriangulationMode::Static:
-                        triangulateBeliefFreudenthal(belief, ceiledResolution, result);
+                        triangulateBeliefFreudenthal(belief, ceiledResolution, gridPoints, weights);
                         break;
                     case TriangulationMode::Dynamic:
-                        triangulateBeliefDynamic(belief, ceiledResolution, result);
+                        triangulateBeliefDynamic(belief, ceiledResolution, gridPoints, weights);
                         break;
                     default:
                         STORM_LOG_ASSERT(false, "Invalid triangulation mode.");
                 }
             }
-            STORM_LOG_ASSERT(assertTriangulation(belief, result), "Incorrect triangulation: " << toString(result));
+            STORM_LOG_ASSERT(assertTriangulation(belief, gridPoints, weights), "Incorrect triangulation of belief " << beliefToString(belief) << ".");
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation
+        BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(BeliefType const &belief, BeliefValueType const &resolution) {
+            Triangulation result;
+            std::vector<BeliefType> gridPoints;
+            triangulateBeliefToGridPoints(belief, resolution, gridPoints, result.weights);
+            result.gridPoints.reserve(gridPoints.size());
+            for (auto const &gridPoint : gridPoints) {
+                result.gridPoints.push_back(getOrAddBeliefId(gridPoint));
+            }
             return result;
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId, typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
-        BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId const &beliefId, uint64_t actionIndex,
-                                                                             boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) {
-            std::vector<std::pair<BeliefId, ValueType>> destinations;
+        std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType, typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
+        BeliefManager<PomdpType, BeliefValueType, StateType>::computeSuccessorBeliefs(BeliefId const &beliefId, uint64_t actionIndex,
+                                                                                      boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) const {
+            std::vector<std::pair<BeliefType, ValueType>> destinations;
 
-            BeliefType belief = getBelief(beliefId);
+            auto belief = getBelief(beliefId);
 
             // Find the probability we go to each observation
             BeliefType successorObs; // This is actually not a belief but has the same type
@@ -470,18 +524,70 @@ namespace storm {
 
                 // Insert the destination. We know that destinations have to be disjoined since they have different observations
                 if (observationTriangulationResolutions) {
-                    Triangulation triangulation = triangulateBelief(successorBelief, observationTriangulationResolutions.get()[successor.first]);
-                    for (size_t j = 0; j < triangulation.size(); ++j) {
-                        // Here we additionally assume that triangulation.gridPoints does not contain the same point multiple times
-                        destinations.emplace_back(triangulation.gridPoints[j], triangulation.weights[j] * successor.second);
+                    std::vector<BeliefType> gridPoints;
+                    std::vector<BeliefValueType> weights;
+                    triangulateBeliefToGridPoints(successorBelief, observationTriangulationResolutions.get()[successor.first], gridPoints, weights);
+                    for (size_t j = 0; j < gridPoints.size(); ++j) {
+                        // Here we additionally assume that the grid points do not contain the same point multiple times
+                        destinations.emplace_back(std::move(gridPoints[j]), weights[j] * successor.second);
                     }
                 } else {
-                    destinations.emplace_back(getOrAddBeliefId(successorBelief), successor.second);
+                    destinations.emplace_back(std::move(successorBelief), successor.second);
                 }
             }
 
             return destinations;
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId, typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
+        BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId const &beliefId, uint64_t actionIndex,
+                                                                             boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) {
+            std::vector<std::pair<BeliefType, ValueType>> successors;
+            auto precomputedIt = precomputedSuccessors.find(std::make_pair(beliefId, actionIndex));
+            if (precomputedIt != precomputedSuccessors.end() && precomputedSuccessorsResolutions == observationTriangulationResolutions) {
+                successors = std::move(precomputedIt->second);
+                precomputedSuccessors.erase(precomputedIt);
+            } else {
+                successors = computeSuccessorBeliefs(beliefId, actionIndex, observationTriangulationResolutions);
+            }
+
+            // Assign ids to the successors. This is the only step that modifies the belief storage.
+            std::vector<std::pair<BeliefId, ValueType>> destinations;
+            destinations.reserve(successors.size());
+            for (auto const &successor : successors) {
+                destinations.emplace_back(getOrAddBeliefId(successor.first), successor.second);
+            }
+            return destinations;
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::precomputeSuccessors(std::vector<BeliefId> const &beliefIds, boost::optional<std::vector<BeliefValueType>> const &observationResolutions,
+                                                                                        uint64_t numberOfThreads) {
+            STORM_LOG_THROW(numberOfThreads > 0, storm::exceptions::InvalidArgumentException, "The number of threads has to be positive.");
+            precomputedSuccessors.clear();
+            precomputedSuccessorsResolutions = observationResolutions;
+
+            std::vector<std::pair<BeliefId, uint64_t>> beliefActionPairs;
+            for (auto const &beliefId : beliefIds) {
+                for (uint64_t action = 0, numActions = getBeliefNumberOfChoices(beliefId); action < numActions; ++action) {
+                    beliefActionPairs.emplace_back(beliefId, action);
+                }
+            }
+
+            // The workers only read the belief storage. Ids are assigned later, when the successors are requested.
+            std::vector<std::vector<std::pair<BeliefType, ValueType>>> successors(beliefActionPairs.size());
+            if (storm::NumberTraits<ValueType>::IsExact || storm::NumberTraits<BeliefValueType>::IsExact) {
+                // Copies of exact numbers might share (non-atomically) reference counted data, so we do not compute these concurrently.
+                numberOfThreads = 1;
+            }
+            storm::utility::parallel::parallelFor(beliefActionPairs.size(), numberOfThreads, [&] (uint64_t i) {
+                successors[i] = computeSuccessorBeliefs(beliefActionPairs[i].first, beliefActionPairs[i].second, observationResolutions);
+            });
 
+            for (uint64_t i = 0; i < beliefActionPairs.size(); ++i) {
+                precomputedSuccessors.emplace(beliefActionPairs[i], std::move(successors[i]));
+            }
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -499,15 +605,18 @@ namespace storm {
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getOrAddBeliefId(BeliefType const &belief) {
-            uint32_t obs = getBeliefObservation(belief);
-            STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
-            auto insertioRes = beliefToIdMap[obs].emplace(belief, beliefs.size());
-            if (insertioRes.second) {
-                // There actually was an insertion, so add the new belief
-                beliefs.push_back(belief);
-            }
-            // Return the id
-            return insertioRes.first->second;
+            uint32_t obs = getObservation(belief);
+            STORM_LOG_ASSERT(obs < beliefHashToIdMap.size(), "Belief has unknown observation.");
+            std::size_t hash = BeliefHash()(belief);
+            BeliefId id = findBeliefId(belief, obs, hash);
+            if (id == noId()) {
+                // The belief is new, so add its entries to the storage
+                id = getNumberOfBeliefIds();
+                beliefEntries.insert(beliefEntries.end(), belief.begin(), belief.end());
+                beliefEntriesBegin.push_back(beliefEntries.size());
+                beliefHashToIdMap[obs].emplace(hash, id);
+            }
+            return id;
         }
 
         template class BeliefManager<storm::models::sparse::Pomdp<double>>;
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <vector>
+#include <map>
+#include <utility>
 #include <unordered_map>
 #include <boost/optional.hpp>
 #include <boost/container/flat_map.hpp>
@@ -58,7 +60,7 @@ namespace storm {
             Triangulation triangulateBelief(BeliefId beliefId, BeliefValueType resolution);
 
             template<typename DistributionType>
-            void addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value);
+            void addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value) const;
 
             void joinSupport(BeliefId const &beliefId, BeliefSupportType &support);
 
@@ -69,10 +71,39 @@ namespace storm {
 
             std::vector<std::pair<BeliefId, ValueType>> expand(BeliefId const &beliefId, uint64_t actionIndex);
 
+            /*!
+             * Computes the successor beliefs (and, if observation resolutions are given, their triangulations) of all choices of the given beliefs using multiple threads.
+             * The results are kept until they are requested by expand (without resolutions) or expandAndTriangulate (with the same resolutions).
+             * Ids for the successors are only assigned when the results are requested. Hence, the assigned ids do not depend on the number of threads.
+             * Previously precomputed results are discarded.
+             *
+             * @param beliefIds the beliefs whose successors are computed
+             * @param observationResolutions if given, the successor beliefs are triangulated using these resolutions
+             * @param numberOfThreads the number of threads that compute successors
+             */
+            void precomputeSuccessors(std::vector<BeliefId> const &beliefIds, boost::optional<std::vector<BeliefValueType>> const &observationResolutions, uint64_t numberOfThreads);
+
         private:
 
+            typedef std::pair<StateType, BeliefValueType> BeliefEntryType;
+
+            /*!
+             * A read-only view on a belief in the belief storage.
+             * Adding new beliefs to the storage invalidates the view.
+             */
+            struct BeliefView {
+                typedef BeliefEntryType const* const_iterator;
+                const_iterator begin() const;
+                const_iterator end() const;
+                uint64_t size() const;
+
+                const_iterator beginEntry;
+                const_iterator endEntry;
+            };
+
             struct BeliefHash {
-                std::size_t operator()(const BeliefType &belief) const;
+                template<typename BeliefRangeType>
+                std::size_t operator()(BeliefRangeType const &belief) const;
             };
 
             struct FreudenthalDiff {
@@ -83,26 +114,47 @@ namespace storm {
                 bool operator>(FreudenthalDiff const &other) const;
             };
 
-            BeliefType const &getBelief(BeliefId const &id) const;
+            BeliefView getBelief(BeliefId const &id) const;
 
             BeliefId getId(BeliefType const &belief) const;
 
-            std::string toString(BeliefType const &belief) const;
+            /*!
+             * Returns the id of the given belief (with the given observation and hash value) or noId() if the belief is not stored.
+             */
+            BeliefId findBeliefId(BeliefType const &belief, uint32_t const &observation, std::size_t const &hash) const;
+
+            template<typename BeliefRangeType>
+            std::string beliefToString(BeliefRangeType const &belief) const;
+
+            template<typename FirstBeliefRangeType, typename SecondBeliefRangeType>
+            bool isEqualBelief(FirstBeliefRangeType const &first, SecondBeliefRangeType const &second) const;
 
-            bool isEqual(BeliefType const &first, BeliefType const &second) const;
+            template<typename BeliefRangeType>
+            bool assertBelief(BeliefRangeType const &belief) const;
 
-            bool assertBelief(BeliefType const &belief) const;
+            bool assertTriangulation(BeliefType const &belief, std::vector<BeliefType> const &gridPoints, std::vector<BeliefValueType> const &weights) const;
 
-            bool assertTriangulation(BeliefType const &belief, Triangulation const &triangulation) const;
+            template<typename BeliefRangeType>
+            uint32_t getObservation(BeliefRangeType const &belief) const;
 
-            uint32_t getBeliefObservation(BeliefType belief) const;
+            void triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, std::vector<BeliefType> &gridPoints, std::vector<BeliefValueType> &weights) const;
 
-            void triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result);
+            void triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, std::vector<BeliefType> &gridPoints, std::vector<BeliefValueType> &weights) const;
 
-            void triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result);
+            /*!
+             * Triangulates the given belief without adding the grid points to the belief storage.
+             */
+            void triangulateBeliefToGridPoints(BeliefType const &belief, BeliefValueType const &resolution, std::vector<BeliefType> &gridPoints, std::vector<BeliefValueType> &weights) const;
 
             Triangulation triangulateBelief(BeliefType const &belief, BeliefValueType const &resolution);
 
+            /*!
+             * Computes the successor beliefs (or the grid points of their triangulations) together with their probabilities.
+             * This does not modify the belief storage and can thus be called concurrently.
+             */
+            std::vector<std::pair<BeliefType, ValueType>>
+            computeSuccessorBeliefs(BeliefId const &beliefId, uint64_t actionIndex, boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) const;
+
             std::vector<std::pair<BeliefId, ValueType>>
             expandInternal(BeliefId const &beliefId, uint64_t actionIndex, boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions = boost::none);
 
@@ -113,10 +165,17 @@ namespace storm {
             PomdpType const& pomdp;
             std::vector<ValueType> pomdpActionRewardVector;
             
-            std::vector<BeliefType> beliefs;
-            std::vector<std::unordered_map<BeliefType, BeliefId, BeliefHash>> beliefToIdMap;
+            // The entries of all beliefs are stored consecutively. The entries of the belief with id i are in [beliefEntriesBegin[i], beliefEntriesBegin[i+1]).
+            std::vector<BeliefEntryType> beliefEntries;
+            std::vector<uint64_t> beliefEntriesBegin;
+            // For each observation, maps the hash values of the stored beliefs to their ids.
+            std::vector<std::unordered_multimap<std::size_t, BeliefId>> beliefHashToIdMap;
             BeliefId initialBeliefId;
             
+            // Successors that were computed in advance (see precomputeSuccessors) but have not been requested yet.
+            std::map<std::pair<BeliefId, uint64_t>, std::vector<std::pair<BeliefType, ValueType>>> precomputedSuccessors;
+            boost::optional<std::vector<BeliefValueType>> precomputedSuccessorsResolutions;
+            
             storm::utility::ConstantsComparator<ValueType> cc;
             
             TriangulationMode triangulationMode;
@@ -1,4 +1,5 @@
 #include "storm/builder/DdJaniModelBuilder.h"
+#include "storm/builder/DdVariableOrder.h"
 
 #include <sstream>
 
@@ -98,18 +99,18 @@ namespace storm {
         }
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdJaniModelBuilder<Type, ValueType>::Options::Options(bool buildAllLabels, bool buildAllRewardModels, bool applyMaximumProgressAssumption) : buildAllLabels(buildAllLabels), buildAllRewardModels(buildAllRewardModels), applyMaximumProgressAssumption(applyMaximumProgressAssumption), rewardModelsToBuild(), constantDefinitions() {
+        DdJaniModelBuilder<Type, ValueType>::Options::Options(bool buildAllLabels, bool buildAllRewardModels, bool applyMaximumProgressAssumption) : buildAllLabels(buildAllLabels), buildAllRewardModels(buildAllRewardModels), applyMaximumProgressAssumption(applyMaximumProgressAssumption), rewardModelsToBuild(), constantDefinitions(), variableOrderHeuristic(storm::builder::DdVariableOrderHeuristic::Declaration), variableOrder() {
             // Intentionally left empty.
         }
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdJaniModelBuilder<Type, ValueType>::Options::Options(storm::logic::Formula const& formula) : buildAllRewardModels(false), rewardModelsToBuild(), constantDefinitions() {
+        DdJaniModelBuilder<Type, ValueType>::Options::Options(storm::logic::Formula const& formula) : buildAllRewardModels(false), rewardModelsToBuild(), constantDefinitions(), variableOrderHeuristic(storm::builder::DdVariableOrderHeuristic::Declaration), variableOrder() {
             this->preserveFormula(formula);
             this->setTerminalStatesFromFormula(formula);
         }
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdJaniModelBuilder<Type, ValueType>::Options::Options(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) : buildAllLabels(false), buildAllRewardModels(false), rewardModelsToBuild(), constantDefinitions() {
+        DdJaniModelBuilder<Type, ValueType>::Options::Options(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) : buildAllLabels(false), buildAllRewardModels(false), rewardModelsToBuild(), constantDefinitions(), variableOrderHeuristic(storm::builder::DdVariableOrderHeuristic::Declaration), variableOrder() {
             if (!formulas.empty()) {
                 for (auto const& formula : formulas) {
                     this->preserveFormula(*formula);
@@ -287,7 +288,7 @@ namespace storm {
         template <storm::dd::DdType Type, typename ValueType>
         class CompositionVariableCreator : public storm::jani::CompositionVisitor {
         public:
-            CompositionVariableCreator(storm::jani::Model const& model, storm::jani::CompositionInformation const& actionInformation) : model(model), automata(), actionInformation(actionInformation) {
+            CompositionVariableCreator(storm::jani::Model const& model, storm::jani::CompositionInformation const& actionInformation, typename DdJaniModelBuilder<Type, ValueType>::Options const& options) : model(model), automata(), actionInformation(actionInformation), options(options) {
                 // Intentionally left empty.
             }
             
@@ -353,41 +354,48 @@ namespace storm {
                     result.allNondeterminismVariables.insert(result.probabilisticNondeterminismVariable);
                 }
                 
+                // Collect the location variables of the automata.
+                std::map<storm::expressions::Variable, std::string> locationVariableToAutomatonName;
                 for (auto const& automatonName : this->automata) {
-                    storm::jani::Automaton const& automaton =  this->model.getAutomaton(automatonName);
-                    
-                    // Start by creating a meta variable for the location of the automaton.
-                    storm::expressions::Variable locationExpressionVariable = automaton.getLocationExpressionVariable();
-                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = result.manager->addMetaVariable("l_" + automaton.getName(), 0, automaton.getNumberOfLocations() - 1);
-                    result.automatonToLocationDdVariableMap[automaton.getName()] = variablePair;
-                    result.rowColumnMetaVariablePairs.push_back(variablePair);
-
-                    result.variableToRowMetaVariableMap->emplace(locationExpressionVariable, variablePair.first);
-                    result.variableToColumnMetaVariableMap->emplace(locationExpressionVariable, variablePair.second);
-                    
-                    // Add the location variable to the row/column variables.
-                    result.rowMetaVariables.insert(variablePair.first);
-                    result.columnMetaVariables.insert(variablePair.second);
-                    
-                    // Add the legal range for the location variables.
-                    result.variableToRangeMap.emplace(variablePair.first, result.manager->getRange(variablePair.first));
-                    result.variableToRangeMap.emplace(variablePair.second, result.manager->getRange(variablePair.second));
+                    locationVariableToAutomatonName.emplace(this->model.getAutomaton(automatonName).getLocationExpressionVariable(), automatonName);
+                }
+                
+                // Create the location variables and the (non-transient) variables in the order that is selected in the options.
+                for (auto const& variable : storm::builder::getDdVariableOrder(this->model, options.variableOrderHeuristic, options.variableOrder)) {
+                    auto locationIt = locationVariableToAutomatonName.find(variable);
+                    if (locationIt != locationVariableToAutomatonName.end()) {
+                        createLocationVariable(this->model.getAutomaton(locationIt->second), result);
+                    } else if (this->model.getGlobalVariables().hasVariable(variable)) {
+                        createVariable(this->model.getGlobalVariables().getVariable(variable), result);
+                    } else {
+                        bool found = false;
+                        for (auto const& automaton : this->model.getAutomata()) {
+                            if (automaton.getVariables().hasVariable(variable)) {
+                                createVariable(automaton.getVariables().getVariable(variable), result);
+                                found = true;
+                                break;
+                            }
+                            // Automata that do not occur in the system composition do not get a location variable.
+                            if (automaton.getLocationExpressionVariable() == variable) {
+                                found = true;
+                                break;
+                            }
+                        }
+                        STORM_LOG_ASSERT(found, "Unknown variable '" << variable.getName() << "'.");
+                    }
                 }
                 
-                // Create global variables.
+                // Compute the ranges of the global variables.
                 storm::dd::Bdd<Type> globalVariableRanges = result.manager->getBddOne();
                 for (auto const& variable : this->model.getGlobalVariables()) {
-                    // Only create the variable if it's non-transient.
                     if (variable.isTransient()) {
                         continue;
                     }
-                    
-                    createVariable(variable, result);
                     globalVariableRanges &= result.manager->getRange(result.variableToRowMetaVariableMap->at(variable.getExpressionVariable()));
                 }
                 result.globalVariableRanges = globalVariableRanges.template toAdd<ValueType>();
                 
-                // Create the variables for the individual automata.
+                // Compute the identities and ranges of the individual automata.
                 for (auto const& automaton : this->model.getAutomata()) {
                     storm::dd::Bdd<Type> identity = result.manager->getBddOne();
                     storm::dd::Bdd<Type> range = result.manager->getBddOne();
@@ -398,14 +406,12 @@ namespace storm {
                     identity &= variableIdentity;
                     range &= result.manager->getRange(locationVariables.first);
                     
-                    // Then create variables for the variables of the automaton.
+                    // Then add the variables of the automaton.
                     for (auto const& variable : automaton.getVariables()) {
-                        // Only create the variable if it's non-transient.
                         if (variable.isTransient()) {
                             continue;
                         }
                         
-                        createVariable(variable, result);
                         identity &= result.variableToIdentityMap.at(variable.getExpressionVariable()).toBdd();
                         range &= result.manager->getRange(result.variableToRowMetaVariableMap->at(variable.getExpressionVariable()));
                     }
@@ -423,6 +429,24 @@ namespace storm {
                 return result;
             }
             
+            void createLocationVariable(storm::jani::Automaton const& automaton, CompositionVariables<Type, ValueType>& result) {
+                storm::expressions::Variable locationExpressionVariable = automaton.getLocationExpressionVariable();
+                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = result.manager->addMetaVariable("l_" + automaton.getName(), 0, automaton.getNumberOfLocations() - 1);
+                result.automatonToLocationDdVariableMap[automaton.getName()] = variablePair;
+                result.rowColumnMetaVariablePairs.push_back(variablePair);
+                
+                result.variableToRowMetaVariableMap->emplace(locationExpressionVariable, variablePair.first);
+                result.variableToColumnMetaVariableMap->emplace(locationExpressionVariable, variablePair.second);
+                
+                // Add the location variable to the row/column variables.
+                result.rowMetaVariables.insert(variablePair.first);
+                result.columnMetaVariables.insert(variablePair.second);
+                
+                // Add the legal range for the location variables.
+                result.variableToRangeMap.emplace(variablePair.first, result.manager->getRange(variablePair.first));
+                result.variableToRangeMap.emplace(variablePair.second, result.manager->getRange(variablePair.second));
+            }
+            
             void createVariable(storm::jani::Variable const& variable, CompositionVariables<Type, ValueType>& result) {
                 if (variable.isBooleanVariable()) {
                     createVariable(variable.asBooleanVariable(), result);
@@ -481,6 +505,7 @@ namespace storm {
             storm::jani::Model const& model;
             std::set<std::string> automata;
             storm::jani::CompositionInformation actionInformation;
+            typename DdJaniModelBuilder<Type, ValueType>::Options const& options;
         };
         
         template <storm::dd::DdType Type, typename ValueType>
@@ -2169,7 +2194,7 @@ namespace storm {
             storm::jani::CompositionInformation actionInformation = visitor.getInformation();
             
             // Create all necessary variables.
-            CompositionVariableCreator<Type, ValueType> variableCreator(preparedModel, actionInformation);
+            CompositionVariableCreator<Type, ValueType> variableCreator(preparedModel, actionInformation, options);
             CompositionVariables<Type, ValueType> variables = variableCreator.create();
             
             // Determine which transient assignments need to be considered in the building process.
@@ -7,6 +7,7 @@
 
 #include "storm/logic/Formula.h"
 #include "storm/builder/TerminalStatesGetter.h"
+#include "storm/builder/DdVariableOrder.h"
 
 
 namespace storm {
@@ -119,6 +120,13 @@ namespace storm {
                 // If this is set, the outgoing transitions of these states are replaced with a self-loop.
                 storm::builder::TerminalStates terminalStates;
                 
+                /// The heuristic that is used to order the location variables and the variables of the model.
+                storm::builder::DdVariableOrderHeuristic variableOrderHeuristic;
+                
+                /// An optional order of the variables (given by their names) that, if given and matching the variables of
+                /// the model, is used instead of the heuristic.
+                boost::optional<std::vector<std::string>> variableOrder;
+                
             };
                         
             /*!
@@ -1,4 +1,5 @@
 #include "storm/builder/DdPrismModelBuilder.h"
+#include "storm/builder/DdVariableOrder.h"
 
 #include <boost/algorithm/string/join.hpp>
 
@@ -92,10 +93,10 @@ namespace storm {
         template <storm::dd::DdType Type, typename ValueType>
         class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
         public:
-            GenerationInformation(storm::prism::Program const& program) : program(program), manager(std::make_shared<storm::dd::DdManager<Type>>()), rowMetaVariables(), variableToRowMetaVariableMap(std::make_shared<std::map<storm::expressions::Variable, storm::expressions::Variable>>()), rowExpressionAdapter(std::make_shared<storm::adapters::AddExpressionAdapter<Type, ValueType>>(manager, variableToRowMetaVariableMap)), columnMetaVariables(), variableToColumnMetaVariableMap((std::make_shared<std::map<storm::expressions::Variable, storm::expressions::Variable>>())), rowColumnMetaVariablePairs(), nondeterminismMetaVariables(), variableToIdentityMap(), allGlobalVariables(), moduleToIdentityMap(), parameters() {
+            GenerationInformation(storm::prism::Program const& program, typename DdPrismModelBuilder<Type, ValueType>::Options const& options) : program(program), manager(std::make_shared<storm::dd::DdManager<Type>>()), rowMetaVariables(), variableToRowMetaVariableMap(std::make_shared<std::map<storm::expressions::Variable, storm::expressions::Variable>>()), rowExpressionAdapter(std::make_shared<storm::adapters::AddExpressionAdapter<Type, ValueType>>(manager, variableToRowMetaVariableMap)), columnMetaVariables(), variableToColumnMetaVariableMap((std::make_shared<std::map<storm::expressions::Variable, storm::expressions::Variable>>())), rowColumnMetaVariablePairs(), nondeterminismMetaVariables(), variableToIdentityMap(), allGlobalVariables(), moduleToIdentityMap(), parameters() {
                 
                 // Initializes variables and identity DDs.
-                createMetaVariablesAndIdentities();
+                createMetaVariablesAndIdentities(options);
                 
                 // Initialize the parameters (if any).
                 ParameterCreator<Type, ValueType> parameterCreator;
@@ -155,7 +156,7 @@ namespace storm {
             /*!
              * Creates the required meta variables and variable/module identities.
              */
-            void createMetaVariablesAndIdentities() {
+            void createMetaVariablesAndIdentities(typename DdPrismModelBuilder<Type, ValueType>::Options const& options) {
                 // Add synchronization variables.
                 for (auto const& actionIndex : program.getSynchronizingActionIndices()) {
                     std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(program.getActionName(actionIndex));
@@ -175,84 +176,61 @@ namespace storm {
                     allNondeterminismVariables.insert(variablePair.first);
                 }
                 
-                // Create meta variables for global program variables.
+                // Collect the declarations of the program variables.
+                std::map<storm::expressions::Variable, storm::prism::IntegerVariable const*> integerVariables;
+                std::map<storm::expressions::Variable, storm::prism::BooleanVariable const*> booleanVariables;
                 for (storm::prism::IntegerVariable const& integerVariable : program.getGlobalIntegerVariables()) {
-                    int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
-                    int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
-                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(integerVariable.getName(), low, high);
-                    
-                    STORM_LOG_TRACE("Created meta variables for global integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
-                    
-                    rowMetaVariables.insert(variablePair.first);
-                    variableToRowMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.first);
-                    
-                    columnMetaVariables.insert(variablePair.second);
-                    variableToColumnMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.second);
-                    
-                    storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-                    variableToIdentityMap.emplace(integerVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-                    rowColumnMetaVariablePairs.push_back(variablePair);
-                    
+                    integerVariables.emplace(integerVariable.getExpressionVariable(), &integerVariable);
                     allGlobalVariables.insert(integerVariable.getExpressionVariable());
                 }
                 for (storm::prism::BooleanVariable const& booleanVariable : program.getGlobalBooleanVariables()) {
-                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
-                    
-                    STORM_LOG_TRACE("Created meta variables for global boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
+                    booleanVariables.emplace(booleanVariable.getExpressionVariable(), &booleanVariable);
+                    allGlobalVariables.insert(booleanVariable.getExpressionVariable());
+                }
+                for (storm::prism::Module const& module : program.getModules()) {
+                    for (storm::prism::IntegerVariable const& integerVariable : module.getIntegerVariables()) {
+                        integerVariables.emplace(integerVariable.getExpressionVariable(), &integerVariable);
+                    }
+                    for (storm::prism::BooleanVariable const& booleanVariable : module.getBooleanVariables()) {
+                        booleanVariables.emplace(booleanVariable.getExpressionVariable(), &booleanVariable);
+                    }
+                }
+                
+                // Create meta variables for the program variables in the order that is selected in the options.
+                for (storm::expressions::Variable const& variable : storm::builder::getDdVariableOrder(program, options.variableOrderHeuristic, options.variableOrder)) {
+                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair;
+                    auto integerIt = integerVariables.find(variable);
+                    if (integerIt != integerVariables.end()) {
+                        int_fast64_t low = integerIt->second->getLowerBoundExpression().evaluateAsInt();
+                        int_fast64_t high = integerIt->second->getUpperBoundExpression().evaluateAsInt();
+                        variablePair = manager->addMetaVariable(integerIt->second->getName(), low, high);
+                        STORM_LOG_TRACE("Created meta variables for integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
+                    } else {
+                        auto booleanIt = booleanVariables.find(variable);
+                        STORM_LOG_ASSERT(booleanIt != booleanVariables.end(), "Unknown program variable '" << variable.getName() << "'.");
+                        variablePair = manager->addMetaVariable(booleanIt->second->getName());
+                        STORM_LOG_TRACE("Created meta variables for boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
+                    }
                     
                     rowMetaVariables.insert(variablePair.first);
-                    variableToRowMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.first);
+                    variableToRowMetaVariableMap->emplace(variable, variablePair.first);
                     
                     columnMetaVariables.insert(variablePair.second);
-                    variableToColumnMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.second);
+                    variableToColumnMetaVariableMap->emplace(variable, variablePair.second);
                     
                     storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-                    variableToIdentityMap.emplace(booleanVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-                    
+                    variableToIdentityMap.emplace(variable, variableIdentity.template toAdd<ValueType>());
                     rowColumnMetaVariablePairs.push_back(variablePair);
-                    allGlobalVariables.insert(booleanVariable.getExpressionVariable());
                 }
                 
-                // Create meta variables for each of the modules' variables.
+                // Build the identities and ranges of the modules.
                 for (storm::prism::Module const& module : program.getModules()) {
                     storm::dd::Bdd<Type> moduleIdentity = manager->getBddOne();
                     storm::dd::Bdd<Type> moduleRange = manager->getBddOne();
                     
-                    for (storm::prism::IntegerVariable const& integerVariable : module.getIntegerVariables()) {
-                        int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
-                        int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
-                        std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(integerVariable.getName(), low, high);
-                        STORM_LOG_TRACE("Created meta variables for integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
-                        
-                        rowMetaVariables.insert(variablePair.first);
-                        variableToRowMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.first);
-                        
-                        columnMetaVariables.insert(variablePair.second);
-                        variableToColumnMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.second);
-                        
-                        storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-                        variableToIdentityMap.emplace(integerVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-                        moduleIdentity &= variableIdentity;
-                        moduleRange &= manager->getRange(variablePair.first);
-                        
-                        rowColumnMetaVariablePairs.push_back(variablePair);
-                    }
-                    for (storm::prism::BooleanVariable const& booleanVariable : module.getBooleanVariables()) {
-                        std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
-                        STORM_LOG_TRACE("Created meta variables for boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
-                        
-                        rowMetaVariables.insert(variablePair.first);
-                        variableToRowMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.first);
-                        
-                        columnMetaVariables.insert(variablePair.second);
-                        variableToColumnMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.second);
-                        
-                        storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-                        variableToIdentityMap.emplace(booleanVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-                        moduleIdentity &= variableIdentity;
-                        moduleRange &= manager->getRange(variablePair.first);
-                        
-                        rowColumnMetaVariablePairs.push_back(variablePair);
+                    for (auto const& variable : module.getAllExpressionVariables()) {
+                        moduleIdentity &= variableToIdentityMap.at(variable).toBdd();
+                        moduleRange &= manager->getRange(variableToRowMetaVariableMap->at(variable));
                     }
                     moduleToIdentityMap[module.getName()] = moduleIdentity.template toAdd<ValueType>();
                     moduleToRangeMap[module.getName()] = moduleRange.template toAdd<ValueType>();
@@ -545,18 +523,18 @@ namespace storm {
         }
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdPrismModelBuilder<Type, ValueType>::Options::Options() : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(), terminalStates() {
+        DdPrismModelBuilder<Type, ValueType>::Options::Options() : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(), terminalStates(), variableOrderHeuristic(storm::builder::DdVariableOrderHeuristic::Declaration), variableOrder() {
             // Intentionally left empty.
         }
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdPrismModelBuilder<Type, ValueType>::Options::Options(storm::logic::Formula const& formula) : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(std::set<std::string>()) {
+        DdPrismModelBuilder<Type, ValueType>::Options::Options(storm::logic::Formula const& formula) : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(std::set<std::string>()), variableOrderHeuristic(storm::builder::DdVariableOrderHeuristic::Declaration), variableOrder() {
             this->preserveFormula(formula);
             this->setTerminalStatesFromFormula(formula);
         }
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdPrismModelBuilder<Type, ValueType>::Options::Options(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild() {
+        DdPrismModelBuilder<Type, ValueType>::Options::Options(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(), variableOrderHeuristic(storm::builder::DdVariableOrderHeuristic::Declaration), variableOrder() {
             for (auto const& formula : formulas) {
                 this->preserveFormula(*formula);
             }
@@ -1317,7 +1295,7 @@ namespace storm {
             
             // Start by initializing the structure used for storing all information needed during the model generation.
             // In particular, this creates the meta variables used to encode the model.
-            GenerationInformation generationInfo(program);
+            GenerationInformation generationInfo(program, options);
             
             SystemResult system = createSystemDecisionDiagram(generationInfo);
             storm::dd::Add<Type, ValueType> transitionMatrix = system.allTransitionsDd;
@@ -8,6 +8,7 @@
 #include "storm/storage/prism/Program.h"
 
 #include "storm/builder/TerminalStatesGetter.h"
+#include "storm/builder/DdVariableOrder.h"
 
 #include "storm/logic/Formulas.h"
 #include "storm/adapters/AddExpressionAdapter.h"
@@ -93,6 +94,13 @@ namespace storm {
                 // An optional set of expression or labels that characterizes (a subset of) the terminal states of the model.
                 // If this is set, the outgoing transitions of these states are replaced with a self-loop.
                 storm::builder::TerminalStates terminalStates;
+                
+                // The heuristic that is used to order the variables of the program.
+                storm::builder::DdVariableOrderHeuristic variableOrderHeuristic;
+                
+                // An optional order of the variables (given by their names) that, if given and matching the variables of
+                // the program, is used instead of the heuristic.
+                boost::optional<std::vector<std::string>> variableOrder;
             };
             
             /*!
@@ -0,0 +1,303 @@
+#include "storm/builder/DdVariableOrder.h"
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <numeric>
+#include <set>
+#include <unordered_map>
+
+#include "storm/storage/prism/Program.h"
+#include "storm/storage/jani/Model.h"
+#include "storm/storage/jani/Automaton.h"
+#include "storm/storage/jani/Edge.h"
+#include "storm/storage/jani/EdgeDestination.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace builder {
+
+        std::ostream& operator<<(std::ostream& out, DdVariableOrderHeuristic const& heuristic) {
+            switch (heuristic) {
+                case DdVariableOrderHeuristic::Declaration:
+                    out << "declaration";
+                    break;
+                case DdVariableOrderHeuristic::Force:
+                    out << "force";
+                    break;
+                default:
+                    out << "undefined";
+                    break;
+            }
+            return out;
+        }
+
+        namespace {
+            uint64_t computeSpan(std::vector<uint64_t> const& positions, std::vector<std::vector<uint64_t>> const& hyperedges) {
+                uint64_t span = 0;
+                for (auto const& hyperedge : hyperedges) {
+                    if (hyperedge.empty()) {
+                        continue;
+                    }
+                    auto minMax = std::minmax_element(hyperedge.begin(), hyperedge.end(), [&positions] (uint64_t const& a, uint64_t const& b) { return positions[a] < positions[b]; });
+                    span += positions[*minMax.second] - positions[*minMax.first];
+                }
+                return span;
+            }
+
+            /*!
+             * Collects the hyperedges over the given variables and orders them via FORCE.
+             */
+            class HypergraphBuilder {
+            public:
+                HypergraphBuilder(std::vector<storm::expressions::Variable> const& variables) : variables(variables) {
+                    for (uint64_t index = 0; index < variables.size(); ++index) {
+                        variableToIndex.emplace(variables[index], index);
+                    }
+                }
+
+                void add(std::set<storm::expressions::Variable>& hyperedge, storm::expressions::Expression const& expression) const {
+                    if (expression.isInitialized()) {
+                        std::set<storm::expressions::Variable> occurringVariables = expression.getVariables();
+                        hyperedge.insert(occurringVariables.begin(), occurringVariables.end());
+                    }
+                }
+
+                void addHyperedge(std::set<storm::expressions::Variable> const& hyperedge) {
+                    std::vector<uint64_t> nodes;
+                    for (auto const& variable : hyperedge) {
+                        // Skip variables that are not ordered (e.g. transient variables or parameters).
+                        auto it = variableToIndex.find(variable);
+                        if (it != variableToIndex.end()) {
+                            nodes.push_back(it->second);
+                        }
+                    }
+                    if (nodes.size() > 1) {
+                        hyperedges.push_back(std::move(nodes));
+                    }
+                }
+
+                std::vector<storm::expressions::Variable> computeOrder() const {
+                    std::vector<storm::expressions::Variable> result;
+                    result.reserve(variables.size());
+                    for (auto const& index : computeForceOrder(variables.size(), hyperedges)) {
+                        result.push_back(variables[index]);
+                    }
+                    return result;
+                }
+
+            private:
+                std::vector<storm::expressions::Variable> const& variables;
+                std::unordered_map<storm::expressions::Variable, uint64_t> variableToIndex;
+                std::vector<std::vector<uint64_t>> hyperedges;
+            };
+
+            std::vector<storm::expressions::Variable> getOrder(std::vector<storm::expressions::Variable> const& declarationOrder, boost::optional<std::vector<std::string>> const& variableNames, std::function<std::vector<storm::expressions::Variable>()> const& computeOrder) {
+                if (variableNames) {
+                    std::map<std::string, storm::expressions::Variable> nameToVariable;
+                    for (auto const& variable : declarationOrder) {
+                        nameToVariable.emplace(variable.getName(), variable);
+                    }
+
+                    std::vector<storm::expressions::Variable> result;
+                    for (auto const& name : variableNames.get()) {
+                        auto it = nameToVariable.find(name);
+                        if (it == nameToVariable.end()) {
+                            break;
+                        }
+                        result.push_back(it->second);
+                        nameToVariable.erase(it);
+                    }
+
+                    if (result.size() == variableNames->size() && nameToVariable.empty()) {
+                        STORM_LOG_INFO("Using the given variable order for the symbolic model.");
+                        return result;
+                    }
+                    STORM_LOG_WARN("The given variable order does not match the variables of the model and is ignored.");
+                }
+                return computeOrder();
+            }
+        }
+
+        std::vector<uint64_t> computeForceOrder(uint64_t numberOfNodes, std::vector<std::vector<uint64_t>> const& hyperedges, uint64_t maximalIterations) {
+            std::vector<uint64_t> order(numberOfNodes);
+            std::iota(order.begin(), order.end(), 0);
+            std::vector<uint64_t> positions = order;
+
+            std::vector<std::vector<uint64_t>> nodeToHyperedges(numberOfNodes);
+            for (uint64_t hyperedgeIndex = 0; hyperedgeIndex < hyperedges.size(); ++hyperedgeIndex) {
+                for (auto const& node : hyperedges[hyperedgeIndex]) {
+                    STORM_LOG_ASSERT(node < numberOfNodes, "Hyperedge refers to illegal node " << node << ".");
+                    nodeToHyperedges[node].push_back(hyperedgeIndex);
+                }
+            }
+
+            std::vector<uint64_t> bestOrder = order;
+            uint64_t bestSpan = computeSpan(positions, hyperedges);
+            STORM_LOG_TRACE("Initial span of the variable order is " << bestSpan << ".");
+
+            std::vector<double> centers(hyperedges.size());
+            std::vector<double> tentativePositions(numberOfNodes);
+            for (uint64_t iteration = 0; iteration < maximalIterations && bestSpan > 0; ++iteration) {
+                for (uint64_t hyperedgeIndex = 0; hyperedgeIndex < hyperedges.size(); ++hyperedgeIndex) {
+                    auto const& hyperedge = hyperedges[hyperedgeIndex];
+                    double sum = 0.0;
+                    for (auto const& node : hyperedge) {
+                        sum += static_cast<double>(positions[node]);
+                    }
+                    centers[hyperedgeIndex] = hyperedge.empty() ? 0.0 : sum / hyperedge.size();
+                }
+                for (uint64_t node = 0; node < numberOfNodes; ++node) {
+                    if (nodeToHyperedges[node].empty()) {
+                        tentativePositions[node] = static_cast<double>(positions[node]);
+                    } else {
+                        double sum = 0.0;
+                        for (auto const& hyperedgeIndex : nodeToHyperedges[node]) {
+                            sum += centers[hyperedgeIndex];
+                        }
+                        tentativePositions[node] = sum / nodeToHyperedges[node].size();
+                    }
+                }
+
+                // Ties are resolved according to the previous order.
+                std::stable_sort(order.begin(), order.end(), [&tentativePositions] (uint64_t const& a, uint64_t const& b) { return tentativePositions[a] < tentativePositions[b]; });
+                for (uint64_t position = 0; position < numberOfNodes; ++position) {
+                    positions[order[position]] = position;
+                }
+
+                uint64_t span = computeSpan(positions, hyperedges);
+                STORM_LOG_TRACE("Span of the variable order after iteration " << iteration << " is " << span << ".");
+                if (span >= bestSpan) {
+                    break;
+                }
+                bestSpan = span;
+                bestOrder = order;
+            }
+            return bestOrder;
+        }
+
+        std::vector<storm::expressions::Variable> computeDdVariableOrder(storm::prism::Program const& program, DdVariableOrderHeuristic heuristic) {
+            // The declaration order coincides with the order in which the symbolic model builder used to create the variables.
+            std::vector<storm::expressions::Variable> declarationOrder;
+            for (auto const& variable : program.getGlobalIntegerVariables()) {
+                declarationOrder.push_back(variable.getExpressionVariable());
+            }
+            for (auto const& variable : program.getGlobalBooleanVariables()) {
+                declarationOrder.push_back(variable.getExpressionVariable());
+            }
+            for (auto const& module : program.getModules()) {
+                for (auto const& variable : module.getIntegerVariables()) {
+                    declarationOrder.push_back(variable.getExpressionVariable());
+                }
+                for (auto const& variable : module.getBooleanVariables()) {
+                    declarationOrder.push_back(variable.getExpressionVariable());
+                }
+            }
+            if (heuristic == DdVariableOrderHeuristic::Declaration) {
+                return declarationOrder;
+            }
+
+            // Every command induces a hyperedge and so does every synchronizing action (over all its commands).
+            HypergraphBuilder builder(declarationOrder);
+            std::map<uint_fast64_t, std::set<storm::expressions::Variable>> actionToVariables;
+            for (auto const& module : program.getModules()) {
+                for (auto const& command : module.getCommands()) {
+                    std::set<storm::expressions::Variable> hyperedge;
+                    builder.add(hyperedge, command.getGuardExpression());
+                    for (auto const& update : command.getUpdates()) {
+                        builder.add(hyperedge, update.getLikelihoodExpression());
+                        for (auto const& assignment : update.getAssignments()) {
+                            hyperedge.insert(assignment.getVariable());
+                            builder.add(hyperedge, assignment.getExpression());
+                        }
+                    }
+                    if (command.isLabeled()) {
+                        actionToVariables[command.getActionIndex()].insert(hyperedge.begin(), hyperedge.end());
+                    }
+                    builder.addHyperedge(hyperedge);
+                }
+            }
+            for (auto const& actionVariables : actionToVariables) {
+                builder.addHyperedge(actionVariables.second);
+            }
+
+            std::vector<storm::expressions::Variable> result = builder.computeOrder();
+            STORM_LOG_INFO("Computed variable order for the symbolic model using the " << heuristic << " heuristic.");
+            return result;
+        }
+
+        std::vector<storm::expressions::Variable> computeDdVariableOrder(storm::jani::Model const& model, DdVariableOrderHeuristic heuristic) {
+            // The declaration order coincides with the order in which the symbolic model builder used to create the
+            // variables: first the location variables (ordered by the names of the automata), then the global variables
+            // and then the variables of the automata.
+            std::vector<storm::expressions::Variable> declarationOrder;
+            std::map<std::string, storm::expressions::Variable> nameToLocationVariable;
+            for (auto const& automaton : model.getAutomata()) {
+                nameToLocationVariable.emplace(automaton.getName(), automaton.getLocationExpressionVariable());
+            }
+            for (auto const& entry : nameToLocationVariable) {
+                declarationOrder.push_back(entry.second);
+            }
+            for (auto const& variable : model.getGlobalVariables()) {
+                if (!variable.isTransient()) {
+                    declarationOrder.push_back(variable.getExpressionVariable());
+                }
+            }
+            for (auto const& automaton : model.getAutomata()) {
+                for (auto const& variable : automaton.getVariables()) {
+                    if (!variable.isTransient()) {
+                        declarationOrder.push_back(variable.getExpressionVariable());
+                    }
+                }
+            }
+            if (heuristic == DdVariableOrderHeuristic::Declaration) {
+                return declarationOrder;
+            }
+
+            // Every edge induces a hyperedge (including the location variable of its automaton) and so does every
+            // non-silent action (over all its edges).
+            HypergraphBuilder builder(declarationOrder);
+            std::map<uint64_t, std::set<storm::expressions::Variable>> actionToVariables;
+            for (auto const& automaton : model.getAutomata()) {
+                for (auto const& edge : automaton.getEdges()) {
+                    std::set<storm::expressions::Variable> hyperedge;
+                    hyperedge.insert(automaton.getLocationExpressionVariable());
+                    builder.add(hyperedge, edge.getGuard());
+                    if (edge.hasRate()) {
+                        builder.add(hyperedge, edge.getRate());
+                    }
+                    for (auto const& destination : edge.getDestinations()) {
+                        builder.add(hyperedge, destination.getProbability());
+                        for (auto const& assignment : destination.getOrderedAssignments()) {
+                            if (assignment.lValueIsVariable()) {
+                                hyperedge.insert(assignment.getExpressionVariable());
+                            }
+                            builder.add(hyperedge, assignment.getAssignedExpression());
+                        }
+                    }
+                    if (edge.getActionIndex() != storm::jani::Model::SILENT_ACTION_INDEX) {
+                        actionToVariables[edge.getActionIndex()].insert(hyperedge.begin(), hyperedge.end());
+                    }
+                    builder.addHyperedge(hyperedge);
+                }
+            }
+            for (auto const& actionVariables : actionToVariables) {
+                builder.addHyperedge(actionVariables.second);
+            }
+
+            std::vector<storm::expressions::Variable> result = builder.computeOrder();
+            STORM_LOG_INFO("Computed variable order for the symbolic model using the " << heuristic << " heuristic.");
+            return result;
+        }
+
+        std::vector<storm::expressions::Variable> getDdVariableOrder(storm::prism::Program const& program, DdVariableOrderHeuristic heuristic, boost::optional<std::vector<std::string>> const& variableNames) {
+            return getOrder(computeDdVariableOrder(program, DdVariableOrderHeuristic::Declaration), variableNames, [&program, heuristic] () { return computeDdVariableOrder(program, heuristic); });
+        }
+
+        std::vector<storm::expressions::Variable> getDdVariableOrder(storm::jani::Model const& model, DdVariableOrderHeuristic heuristic, boost::optional<std::vector<std::string>> const& variableNames) {
+            return getOrder(computeDdVariableOrder(model, DdVariableOrderHeuristic::Declaration), variableNames, [&model, heuristic] () { return computeDdVariableOrder(model, heuristic); });
+        }
+
+    }
+}
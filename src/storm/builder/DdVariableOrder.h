@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+    namespace prism {
+        class Program;
+    }
+    namespace jani {
+        class Model;
+    }
+
+    namespace builder {
+
+        // An enum that contains all currently supported heuristics to order the variables of symbolic models.
+        enum class DdVariableOrderHeuristic { Declaration, Force };
+
+        std::ostream& operator<<(std::ostream& out, DdVariableOrderHeuristic const& heuristic);
+
+        /*!
+         * Computes an order of the nodes of the given hypergraph using the FORCE heuristic (Aloul et al., 2003).
+         * Starting from the identity order, the nodes are repeatedly moved towards the centers of gravity of their
+         * hyperedges. The order with the smallest total span (the sum over the distances of the outermost nodes of each
+         * hyperedge) is returned.
+         *
+         * @param numberOfNodes The number of nodes of the hypergraph.
+         * @param hyperedges The hyperedges given as the lists of their nodes.
+         * @param maximalIterations The maximal number of iterations.
+         * @return The nodes in the computed order.
+         */
+        std::vector<uint64_t> computeForceOrder(uint64_t numberOfNodes, std::vector<std::vector<uint64_t>> const& hyperedges, uint64_t maximalIterations = 100);
+
+        /*!
+         * Computes the order of the (non-transient) state variables of the given program in which the symbolic model
+         * builder creates the meta variables. For the FORCE heuristic, the variables occurring in the same command and
+         * in commands that synchronize over the same action are placed close to each other.
+         *
+         * @param program The program whose variables to order.
+         * @param heuristic The heuristic to use.
+         * @return The variables of the program in the computed order.
+         */
+        std::vector<storm::expressions::Variable> computeDdVariableOrder(storm::prism::Program const& program, DdVariableOrderHeuristic heuristic);
+
+        /*!
+         * Computes the order of the location variables and the non-transient variables of the given model in which the
+         * symbolic model builder creates the meta variables. For the FORCE heuristic, the variables occurring in the
+         * same edge and in edges with the same action are placed close to each other.
+         *
+         * @param model The model whose variables to order.
+         * @param heuristic The heuristic to use.
+         * @return The variables of the model in the computed order.
+         */
+        std::vector<storm::expressions::Variable> computeDdVariableOrder(storm::jani::Model const& model, DdVariableOrderHeuristic heuristic);
+
+        /*!
+         * Retrieves the order of the variables of the given program in which the symbolic model builder creates the
+         * meta variables. If the names of the variables are given and match the variables of the program, the order is
+         * taken from the given names. Otherwise, the order is computed using the given heuristic.
+         *
+         * @param program The program whose variables to order.
+         * @param heuristic The heuristic to use if no (matching) order is given.
+         * @param variableNames If given, the names of the variables in the desired order.
+         * @return The variables of the program in the retrieved order.
+         */
+        std::vector<storm::expressions::Variable> getDdVariableOrder(storm::prism::Program const& program, DdVariableOrderHeuristic heuristic, boost::optional<std::vector<std::string>> const& variableNames = boost::none);
+
+        /*!
+         * Retrieves the order of the variables of the given model in which the symbolic model builder creates the meta
+         * variables. If the names of the variables are given and match the variables of the model, the order is taken
+         * from the given names. Otherwise, the order is computed using the given heuristic.
+         *
+         * @param model The model whose variables to order.
+         * @param heuristic The heuristic to use if no (matching) order is given.
+         * @param variableNames If given, the names of the variables in the desired order.
+         * @return The variables of the model in the retrieved order.
+         */
+        std::vector<storm::expressions::Variable> getDdVariableOrder(storm::jani::Model const& model, DdVariableOrderHeuristic heuristic, boost::optional<std::vector<std::string>> const& variableNames = boost::none);
+
+    }
+}
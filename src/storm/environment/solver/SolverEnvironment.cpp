@@ -5,6 +5,7 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/settings/modules/CoreSettings.h"
+#include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
 #include "storm/exceptions/InvalidEnvironmentException.h"
@@ -19,6 +20,11 @@ namespace storm {
         forceExact = generalSettings.isExactSet() || generalSettings.isExactFinitePrecisionSet();
         linearEquationSolverType = storm::settings::getModule<storm::settings::modules::CoreSettings>().getEquationSolver();
         linearEquationSolverTypeSetFromDefault = storm::settings::getModule<storm::settings::modules::CoreSettings>().isEquationSolverSetFromDefaultValue();
+        auto const& coreSettings = storm::settings::getModule<storm::settings::modules::CoreSettings>();
+        if (coreSettings.isDdRoundingSet()) {
+            ddRoundingPrecision = storm::utility::convertNumber<storm::RationalNumber>(coreSettings.getDdRoundingPrecision());
+        }
+        ddRoundingInterval = coreSettings.getDdRoundingInterval();
     }
     
     SolverEnvironment::~SolverEnvironment() {
@@ -134,6 +140,28 @@ namespace storm {
         return linearEquationSolverTypeSetFromDefault;
     }
     
+    bool SolverEnvironment::isDdRoundingSet() const {
+        return static_cast<bool>(ddRoundingPrecision);
+    }
+    
+    storm::RationalNumber const& SolverEnvironment::getDdRoundingPrecision() const {
+        STORM_LOG_ASSERT(ddRoundingPrecision, "Rounding of decision diagrams is not enabled.");
+        return ddRoundingPrecision.get();
+    }
+    
+    void SolverEnvironment::setDdRoundingPrecision(boost::optional<storm::RationalNumber> const& value) {
+        ddRoundingPrecision = value;
+    }
+    
+    uint64_t SolverEnvironment::getDdRoundingInterval() const {
+        return ddRoundingInterval;
+    }
+    
+    void SolverEnvironment::setDdRoundingInterval(uint64_t value) {
+        STORM_LOG_THROW(value > 0, storm::exceptions::InvalidEnvironmentException, "The rounding interval has to be positive.");
+        ddRoundingInterval = value;
+    }
+    
     std::pair<boost::optional<storm::RationalNumber>, boost::optional<bool>> SolverEnvironment::getPrecisionOfLinearEquationSolver(storm::solver::EquationSolverType const& solverType) const {
         std::pair<boost::optional<storm::RationalNumber>, boost::optional<bool>> result;
         switch (solverType) {
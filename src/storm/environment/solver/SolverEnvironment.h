@@ -57,6 +57,12 @@ namespace storm {
         storm::solver::EquationSolverType const& getLinearEquationSolverType() const;
         void setLinearEquationSolverType(storm::solver::EquationSolverType const& value, bool isSetFromDefault = false);
         bool isLinearEquationSolverTypeSetFromDefaultValue() const;
+        
+        bool isDdRoundingSet() const;
+        storm::RationalNumber const& getDdRoundingPrecision() const;
+        void setDdRoundingPrecision(boost::optional<storm::RationalNumber> const& value);
+        uint64_t getDdRoundingInterval() const;
+        void setDdRoundingInterval(uint64_t value);
 
         std::pair<boost::optional<storm::RationalNumber>, boost::optional<bool>> getPrecisionOfLinearEquationSolver(storm::solver::EquationSolverType const& solverType) const;
         void setLinearEquationSolverPrecision(boost::optional<storm::RationalNumber> const& newPrecision, boost::optional<bool> const& relativePrecision = boost::none);
@@ -77,6 +83,8 @@ namespace storm {
         bool linearEquationSolverTypeSetFromDefault;
         bool forceSoundness;
         bool forceExact;
+        boost::optional<storm::RationalNumber> ddRoundingPrecision;
+        uint64_t ddRoundingInterval;
     };
 }
 
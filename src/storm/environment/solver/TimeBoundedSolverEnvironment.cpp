@@ -14,6 +14,7 @@ namespace storm {
         precision = storm::utility::convertNumber<storm::RationalNumber>(tbSettings.getPrecision());
         relative = tbSettings.isRelativePrecision();
         unifPlusKappa = storm::utility::convertNumber<storm::RationalNumber>(tbSettings.getUnifPlusKappa());
+        steadyStateDetection = tbSettings.isSteadyStateDetectionSet();
     }
     
     TimeBoundedSolverEnvironment::~TimeBoundedSolverEnvironment() {
@@ -56,5 +57,13 @@ namespace storm {
     void TimeBoundedSolverEnvironment::setUnifPlusKappa(storm::RationalNumber value) {
         unifPlusKappa = value;
     }
+    
+    bool const& TimeBoundedSolverEnvironment::isSteadyStateDetectionEnabled() const {
+        return steadyStateDetection;
+    }
+    
+    void TimeBoundedSolverEnvironment::setSteadyStateDetection(bool value) {
+        steadyStateDetection = value;
+    }
 
 }
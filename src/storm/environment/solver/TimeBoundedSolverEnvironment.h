@@ -22,6 +22,9 @@ namespace storm {
 
         storm::RationalNumber const& getUnifPlusKappa() const;
         void setUnifPlusKappa(storm::RationalNumber value);
+        
+        bool const& isSteadyStateDetectionEnabled() const;
+        void setSteadyStateDetection(bool value);
 
     private:
         storm::solver::MaBoundedReachabilityMethod maMethod;
@@ -31,6 +34,7 @@ namespace storm {
         bool relative;
         
         storm::RationalNumber unifPlusKappa;
+        bool steadyStateDetection;
     };
 }
 
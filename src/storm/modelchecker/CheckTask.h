@@ -21,6 +21,9 @@ namespace storm {
     }
     
     namespace modelchecker {
+        namespace helper {
+            class QualitativeStateSetsCache;
+        }
         
         enum class CheckType {
             Probabilities, Rewards
@@ -52,7 +55,7 @@ namespace storm {
              */
             template<typename NewFormulaType>
             CheckTask<NewFormulaType, ValueType> substituteFormula(NewFormulaType const& newFormula) const {
-                CheckTask<NewFormulaType, ValueType> result(newFormula, this->optimizationDirection, this->playerCoalition, this->rewardModel, this->onlyInitialStatesRelevant, this->bound, this->qualitative, this->produceSchedulers, this->hint);
+                CheckTask<NewFormulaType, ValueType> result(newFormula, this->optimizationDirection, this->playerCoalition, this->rewardModel, this->onlyInitialStatesRelevant, this->bound, this->qualitative, this->produceSchedulers, this->hint, this->qualitativeStateSetsCache);
                 result.updateOperatorInformation();
                 return result;
             }
@@ -105,7 +108,7 @@ namespace storm {
              */
             template<typename NewValueType>
             CheckTask<FormulaType, NewValueType> convertValueType() const {
-                return CheckTask<FormulaType, NewValueType>(this->formula, this->optimizationDirection, this->playerCoalition, this->rewardModel, this->onlyInitialStatesRelevant, this->bound, this->qualitative, this->produceSchedulers, this->hint);
+                return CheckTask<FormulaType, NewValueType>(this->formula, this->optimizationDirection, this->playerCoalition, this->rewardModel, this->onlyInitialStatesRelevant, this->bound, this->qualitative, this->produceSchedulers, this->hint, this->qualitativeStateSetsCache);
             }
             
             /*!
@@ -271,6 +274,20 @@ namespace storm {
                 return *hint;
             }
             
+            /*!
+             * Sets a cache for the results of qualitative analyses that is shared with other tasks on the same model.
+             */
+            void setQualitativeStateSetsCache(std::shared_ptr<helper::QualitativeStateSetsCache> const& qualitativeStateSetsCache) {
+                this->qualitativeStateSetsCache = qualitativeStateSetsCache;
+            }
+            
+            /*!
+             * Retrieves the cache for the results of qualitative analyses or null if no cache is set.
+             */
+            helper::QualitativeStateSetsCache* getQualitativeStateSetsCache() const {
+                return qualitativeStateSetsCache.get();
+            }
+            
             /*!
              * Conversion operator that strips the type of the formula.
              */
@@ -293,8 +310,10 @@ namespace storm {
              * with bounds 0/1.
              * @param produceSchedulers If supported by the model checker and the model formalism, schedulers to achieve
              * a value will be produced if this flag is set.
+             * @param hint A hint that might speed up the model checking process.
+             * @param qualitativeStateSetsCache If set, results of qualitative analyses are taken from and stored in this cache.
              */
-            CheckTask(std::reference_wrapper<FormulaType const> const& formula, boost::optional<storm::OptimizationDirection> const& optimizationDirection, boost::optional<storm::logic::PlayerCoalition> playerCoalition, boost::optional<std::string> const& rewardModel, bool onlyInitialStatesRelevant, boost::optional<storm::logic::Bound> const& bound, bool qualitative, bool produceSchedulers, std::shared_ptr<ModelCheckerHint> const& hint) : formula(formula), optimizationDirection(optimizationDirection), playerCoalition(playerCoalition), rewardModel(rewardModel), onlyInitialStatesRelevant(onlyInitialStatesRelevant), bound(bound), qualitative(qualitative), produceSchedulers(produceSchedulers), hint(hint) {
+            CheckTask(std::reference_wrapper<FormulaType const> const& formula, boost::optional<storm::OptimizationDirection> const& optimizationDirection, boost::optional<storm::logic::PlayerCoalition> playerCoalition, boost::optional<std::string> const& rewardModel, bool onlyInitialStatesRelevant, boost::optional<storm::logic::Bound> const& bound, bool qualitative, bool produceSchedulers, std::shared_ptr<ModelCheckerHint> const& hint, std::shared_ptr<helper::QualitativeStateSetsCache> const& qualitativeStateSetsCache) : formula(formula), optimizationDirection(optimizationDirection), playerCoalition(playerCoalition), rewardModel(rewardModel), onlyInitialStatesRelevant(onlyInitialStatesRelevant), bound(bound), qualitative(qualitative), produceSchedulers(produceSchedulers), hint(hint), qualitativeStateSetsCache(qualitativeStateSetsCache) {
                 // Intentionally left empty.
             }
             
@@ -325,6 +344,9 @@ namespace storm {
             
             // A hint that might contain information that speeds up the modelchecking process (if supported by the model checker)
             std::shared_ptr<ModelCheckerHint> hint;
+            
+            // If set, results of qualitative analyses are taken from and stored in this cache.
+            std::shared_ptr<helper::QualitativeStateSetsCache> qualitativeStateSetsCache;
         };
         
     }
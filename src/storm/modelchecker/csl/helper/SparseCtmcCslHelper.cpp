@@ -1,5 +1,7 @@
 #include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
 
+#include <list>
+
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 #include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
 
@@ -104,6 +106,20 @@ namespace storm {
                     relevantValues = statesWithProbabilityGreater0;
                 }
                 
+                // The uniformized matrices only depend on the considered states (which also determine the uniformization rate).
+                // Since the transient probabilities might have to be computed several times with a smaller truncation error, we
+                // keep the uniformized matrices instead of building them again in each iteration.
+                std::list<std::pair<storm::storage::BitVector, storm::storage::SparseMatrix<ValueType>>> uniformizedMatrixCache;
+                auto getUniformizedMatrix = [&] (storm::storage::BitVector const& states, ValueType const& uniformizationRate) -> storm::storage::SparseMatrix<ValueType> const& {
+                    for (auto const& cachedMatrix : uniformizedMatrixCache) {
+                        if (cachedMatrix.first == states) {
+                            return cachedMatrix.second;
+                        }
+                    }
+                    uniformizedMatrixCache.emplace_back(states, computeUniformizedMatrix(rateMatrix, states, uniformizationRate, exitRates));
+                    return uniformizedMatrixCache.back().second;
+                };
+                
                 do { // Iterate until the desired precision is reached (only relevant for relative precision criterion)
                     if (!statesWithProbabilityGreater0.empty()) {
                         if (storm::utility::isZero(upperBound)) {
@@ -127,7 +143,7 @@ namespace storm {
                                     STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
                                     
                                     // Compute the uniformized matrix.
-                                    storm::storage::SparseMatrix<ValueType> uniformizedMatrix = computeUniformizedMatrix(rateMatrix, statesWithProbabilityGreater0NonPsi, uniformizationRate, exitRates);
+                                    storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix = getUniformizedMatrix(statesWithProbabilityGreater0NonPsi, uniformizationRate);
                                     
                                     // Compute the vector that is to be added as a compensation for removing the absorbing states.
                                     std::vector<ValueType> b = rateMatrix.getConstrainedRowSumVector(statesWithProbabilityGreater0NonPsi, psiStates);
@@ -160,7 +176,7 @@ namespace storm {
                                 STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
                                 
                                 // Compute the uniformized matrix.
-                                storm::storage::SparseMatrix<ValueType> uniformizedMatrix = computeUniformizedMatrix(rateMatrix, relevantStates, uniformizationRate, exitRates);
+                                storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix = getUniformizedMatrix(relevantStates, uniformizationRate);
                                 
                                 // Compute the transient probabilities.
                                 subResult = computeTransientProbabilities<ValueType>(env, uniformizedMatrix, nullptr, lowerBound, uniformizationRate, subResult, epsilon);
@@ -188,7 +204,7 @@ namespace storm {
                                         STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
                                         
                                         // Compute the (first) uniformized matrix.
-                                        storm::storage::SparseMatrix<ValueType> uniformizedMatrix = computeUniformizedMatrix(rateMatrix, statesWithProbabilityGreater0NonPsi, uniformizationRate, exitRates);
+                                        storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix = getUniformizedMatrix(statesWithProbabilityGreater0NonPsi, uniformizationRate);
                                         
                                         // Compute the vector that is to be added as a compensation for removing the absorbing states.
                                         std::vector<ValueType> b = rateMatrix.getConstrainedRowSumVector(statesWithProbabilityGreater0NonPsi, psiStates);
@@ -213,7 +229,7 @@ namespace storm {
                                     STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
                                     
                                     // Finally, we compute the second set of transient probabilities.
-                                    storm::storage::SparseMatrix<ValueType> uniformizedMatrix = computeUniformizedMatrix(rateMatrix, relevantStates, uniformizationRate, exitRates);
+                                    storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix = getUniformizedMatrix(relevantStates, uniformizationRate);
                                     newSubresult = computeTransientProbabilities<ValueType>(env, uniformizedMatrix, nullptr, lowerBound, uniformizationRate, newSubresult, epsilon / storm::utility::convertNumber<ValueType>(2.0));
                                     
                                     // Fill in the correct values.
@@ -236,7 +252,7 @@ namespace storm {
                                     STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
                                     
                                     // Finally, we compute the second set of transient probabilities.
-                                    storm::storage::SparseMatrix<ValueType> uniformizedMatrix = computeUniformizedMatrix(rateMatrix, statesWithProbabilityGreater0, uniformizationRate, exitRates);
+                                    storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix = getUniformizedMatrix(statesWithProbabilityGreater0, uniformizationRate);
                                     newSubresult = computeTransientProbabilities<ValueType>(env, uniformizedMatrix, nullptr, lowerBound, uniformizationRate, newSubresult, epsilon);
                                     
                                     // Fill in the correct values.
@@ -258,9 +274,66 @@ namespace storm {
                 STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
             }
 
+            template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, std::vector<double> const& upperBounds) {
+                STORM_LOG_THROW(!env.solver().isForceExact(), storm::exceptions::InvalidOperationException, "Exact computations not possible for bounded until probabilities.");
+                for (auto const& upperBound : upperBounds) {
+                    STORM_LOG_THROW(upperBound >= 0.0 && upperBound != storm::utility::infinity<double>(), storm::exceptions::InvalidOperationException, "Time bound " << upperBound << " is not supported when computing bounded until probabilities for multiple time bounds.");
+                }
+                STORM_LOG_WARN_COND(!env.solver().isForceSoundness() || !env.solver().timeBounded().getRelativeTerminationCriterion(), "Computing bounded until probabilities for multiple time bounds only guarantees an absolute precision.");
+                
+                uint_fast64_t numberOfStates = rateMatrix.getRowCount();
+                
+                // Set the possible (absolute) error allowed for truncation (epsilon for fox-glynn)
+                ValueType epsilon = storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getPrecision()) / 8.0;
+                
+                storm::storage::BitVector statesWithProbabilityGreater0 = storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates);
+                storm::storage::BitVector statesWithProbabilityGreater0NonPsi = statesWithProbabilityGreater0 & ~psiStates;
+                STORM_LOG_INFO("Found " << statesWithProbabilityGreater0NonPsi.getNumberOfSetBits() << " 'maybe' states.");
+                
+                std::vector<ValueType> initialResult(numberOfStates, storm::utility::zero<ValueType>());
+                storm::utility::vector::setVectorValues<ValueType>(initialResult, psiStates, storm::utility::one<ValueType>());
+                std::vector<std::vector<ValueType>> result(upperBounds.size(), initialResult);
+                if (statesWithProbabilityGreater0NonPsi.empty() || upperBounds.empty()) {
+                    return result;
+                }
+                
+                // Find the maximal rate of all 'maybe' states to take it as the uniformization rate.
+                ValueType uniformizationRate = storm::utility::zero<ValueType>();
+                for (auto state : statesWithProbabilityGreater0NonPsi) {
+                    uniformizationRate = std::max(uniformizationRate, exitRates[state]);
+                }
+                uniformizationRate *= 1.02;
+                STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
+                
+                // The uniformized matrix and the compensation vector are the same for all time bounds.
+                storm::storage::SparseMatrix<ValueType> uniformizedMatrix = computeUniformizedMatrix(rateMatrix, statesWithProbabilityGreater0NonPsi, uniformizationRate, exitRates);
+                std::vector<ValueType> b = rateMatrix.getConstrainedRowSumVector(statesWithProbabilityGreater0NonPsi, psiStates);
+                for (auto& element : b) {
+                    element /= uniformizationRate;
+                }
+                
+                std::vector<ValueType> timeBounds;
+                timeBounds.reserve(upperBounds.size());
+                for (auto const& upperBound : upperBounds) {
+                    timeBounds.push_back(storm::utility::convertNumber<ValueType>(upperBound));
+                }
+                std::vector<ValueType> values(statesWithProbabilityGreater0NonPsi.getNumberOfSetBits(), storm::utility::zero<ValueType>());
+                std::vector<std::vector<ValueType>> subresults = computeTransientProbabilities(env, uniformizedMatrix, &b, timeBounds, uniformizationRate, std::move(values), epsilon);
+                for (uint64_t boundIndex = 0; boundIndex < upperBounds.size(); ++boundIndex) {
+                    storm::utility::vector::setVectorValues(result[boundIndex], statesWithProbabilityGreater0NonPsi, subresults[boundIndex]);
+                }
+                return result;
+            }
+            
+            template <typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const&, storm::storage::SparseMatrix<ValueType> const&, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&, storm::storage::BitVector const&, std::vector<ValueType> const&, std::vector<double> const&) {
+                STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
+            }
+
             template <typename ValueType>
-            std::vector<ValueType> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative) {
-                return SparseDtmcPrctlHelper<ValueType>::computeUntilProbabilities(env, std::move(goal), computeProbabilityMatrix(rateMatrix, exitRateVector), backwardTransitions, phiStates, psiStates, qualitative);
+            std::vector<ValueType> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, ModelCheckerHint const& hint) {
+                return SparseDtmcPrctlHelper<ValueType>::computeUntilProbabilities(env, std::move(goal), computeProbabilityMatrix(rateMatrix, exitRateVector), backwardTransitions, phiStates, psiStates, qualitative, hint);
             }
 
             template <typename ValueType>
@@ -400,7 +473,7 @@ namespace storm {
             }
             
             template <typename ValueType>
-            std::vector<ValueType> SparseCtmcCslHelper::computeReachabilityTimes(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& targetStates, bool qualitative) {
+            std::vector<ValueType> SparseCtmcCslHelper::computeReachabilityTimes(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& targetStates, bool qualitative, ModelCheckerHint const& hint) {
                 // Compute expected time on CTMC by reduction to DTMC with rewards.
                 storm::storage::SparseMatrix<ValueType> probabilityMatrix = computeProbabilityMatrix(rateMatrix, exitRateVector);
                 
@@ -416,11 +489,11 @@ namespace storm {
                     }
                 }
                 
-                return storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeReachabilityRewards(env, std::move(goal), probabilityMatrix, backwardTransitions, totalRewardVector, targetStates, qualitative);
+                return storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeReachabilityRewards(env, std::move(goal), probabilityMatrix, backwardTransitions, totalRewardVector, targetStates, qualitative, hint);
             }
 
             template <typename ValueType, typename RewardModelType>
-            std::vector<ValueType> SparseCtmcCslHelper::computeReachabilityRewards(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& exitRateVector, RewardModelType const& rewardModel, storm::storage::BitVector const& targetStates, bool qualitative) {
+            std::vector<ValueType> SparseCtmcCslHelper::computeReachabilityRewards(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& exitRateVector, RewardModelType const& rewardModel, storm::storage::BitVector const& targetStates, bool qualitative, ModelCheckerHint const& hint) {
                 STORM_LOG_THROW(!rewardModel.empty(), storm::exceptions::InvalidPropertyException, "Missing reward model for formula. Skipping formula.");
                 
                 storm::storage::SparseMatrix<ValueType> probabilityMatrix = computeProbabilityMatrix(rateMatrix, exitRateVector);
@@ -447,7 +520,7 @@ namespace storm {
                     totalRewardVector = rewardModel.getStateActionRewardVector();
                 }
                 
-                return storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeReachabilityRewards(env, std::move(goal), probabilityMatrix, backwardTransitions, totalRewardVector, targetStates, qualitative);
+                return storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeReachabilityRewards(env, std::move(goal), probabilityMatrix, backwardTransitions, totalRewardVector, targetStates, qualitative, hint);
             }
             
             template <typename ValueType, typename RewardModelType>
@@ -583,6 +656,11 @@ namespace storm {
 
             template<typename ValueType, bool useMixedPoissonProbabilities, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
             std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilities(Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector, ValueType timeBound, ValueType uniformizationRate, std::vector<ValueType> values, ValueType epsilon) {
+                if (!useMixedPoissonProbabilities) {
+                    // Plain transient probabilities are a special case of the computation for multiple time bounds.
+                    return std::move(computeTransientProbabilities(env, uniformizedMatrix, addVector, std::vector<ValueType>({timeBound}), uniformizationRate, std::move(values), epsilon).front());
+                }
+                
                 STORM_LOG_WARN_COND(epsilon > storm::utility::convertNumber<ValueType>(1e-20), "Very low truncation error " << epsilon << " requested. Numerical inaccuracies are possible.");
                 ValueType lambda = timeBound * uniformizationRate;
                 
@@ -596,14 +674,11 @@ namespace storm {
                 STORM_LOG_DEBUG("Fox-Glynn cutoff points: left=" << foxGlynnResult.left << ", right=" << foxGlynnResult.right);
                 // foxGlynnResult.weights do not sum up to one. This is to enhance numerical stability.
                 
-                // If the cumulative reward is to be computed, we need to adjust the weights.
-                if (useMixedPoissonProbabilities) {
-                    ValueType sum = storm::utility::zero<ValueType>();
-                    
-                    for (auto& element : foxGlynnResult.weights) {
-                        sum += element;
-                        element = (foxGlynnResult.totalWeight - sum) / uniformizationRate;
-                    }
+                // Since the cumulative reward is to be computed, we need to adjust the weights.
+                ValueType sum = storm::utility::zero<ValueType>();
+                for (auto& element : foxGlynnResult.weights) {
+                    sum += element;
+                    element = (foxGlynnResult.totalWeight - sum) / uniformizationRate;
                 }
                 
                 STORM_LOG_DEBUG("Starting iterations with " << uniformizedMatrix.getRowCount() << " x " << uniformizedMatrix.getColumnCount() << " matrix.");
@@ -616,20 +691,13 @@ namespace storm {
                     storm::utility::vector::scaleVectorInPlace(result, foxGlynnResult.weights.front());
                     ++startingIteration;
                 } else {
-                    if (useMixedPoissonProbabilities) {
-                        result = std::vector<ValueType>(values.size());
-                        std::function<ValueType (ValueType const&)> scaleWithUniformizationRate = [&uniformizationRate] (ValueType const& a) -> ValueType { return a / uniformizationRate; };
-                        storm::utility::vector::applyPointwise(values, result, scaleWithUniformizationRate);
-                    } else {
-                        result = std::vector<ValueType>(values.size());
-                    }
+                    result = std::vector<ValueType>(values.size());
+                    std::function<ValueType (ValueType const&)> scaleWithUniformizationRate = [&uniformizationRate] (ValueType const& a) -> ValueType { return a / uniformizationRate; };
+                    storm::utility::vector::applyPointwise(values, result, scaleWithUniformizationRate);
                 }
                 
                 auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, uniformizedMatrix);
-                if (!useMixedPoissonProbabilities && foxGlynnResult.left > 1) {
-                    // Perform the matrix-vector multiplications (without adding).
-                    multiplier->repeatedMultiply(env, values, addVector, foxGlynnResult.left - 1);
-                } else if (useMixedPoissonProbabilities) {
+                {
                     std::function<ValueType(ValueType const&, ValueType const&)> addAndScale = [&uniformizationRate] (ValueType const& a, ValueType const& b) { return a + b / uniformizationRate; };
                     
                     // For the iterations below the left truncation point, we need to add and scale the result with the uniformization rate.
@@ -659,6 +727,135 @@ namespace storm {
                 return result;
             }
             
+            template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeTransientProbabilities(Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector, std::vector<ValueType> const& timeBounds, ValueType uniformizationRate, std::vector<ValueType> values, ValueType epsilon) {
+                STORM_LOG_WARN_COND(epsilon > storm::utility::convertNumber<ValueType>(1e-20), "Very low truncation error " << epsilon << " requested. Numerical inaccuracies are possible.");
+                
+                // If we stop early once a steady state is detected, half of the error is reserved for this.
+                bool detectSteadyState = env.solver().timeBounded().isSteadyStateDetectionEnabled();
+                ValueType truncationError = detectSteadyState ? epsilon / storm::utility::convertNumber<ValueType>(2.0) : epsilon;
+                
+                // Use Fox-Glynn to get the truncation points and the weights for each time bound.
+                // Time bounds for which no time can pass are directly given by the current values.
+                std::vector<std::vector<ValueType>> result(timeBounds.size());
+                std::vector<storm::utility::numerical::FoxGlynnResult<ValueType>> foxGlynnResults(timeBounds.size());
+                storm::storage::BitVector remainingTimeBounds(timeBounds.size(), false);
+                uint_fast64_t maxRight = 0;
+                for (uint_fast64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+                    ValueType lambda = timeBounds[boundIndex] * uniformizationRate;
+                    if (storm::utility::isZero(lambda)) {
+                        result[boundIndex] = values;
+                        continue;
+                    }
+                    
+                    auto& foxGlynnResult = foxGlynnResults[boundIndex];
+                    foxGlynnResult = storm::utility::numerical::foxGlynn(lambda, truncationError);
+                    STORM_LOG_DEBUG("Fox-Glynn cutoff points for time bound " << timeBounds[boundIndex] << ": left=" << foxGlynnResult.left << ", right=" << foxGlynnResult.right);
+                    // foxGlynnResult.weights do not sum up to one. This is to enhance numerical stability.
+                    
+                    if (foxGlynnResult.left == 0) {
+                        result[boundIndex] = values;
+                        storm::utility::vector::scaleVectorInPlace(result[boundIndex], foxGlynnResult.weights.front());
+                    } else {
+                        result[boundIndex] = std::vector<ValueType>(values.size(), storm::utility::zero<ValueType>());
+                    }
+                    remainingTimeBounds.set(boundIndex, true);
+                    maxRight = std::max(maxRight, foxGlynnResult.right);
+                }
+                
+                if (remainingTimeBounds.empty()) {
+                    return result;
+                }
+                
+                STORM_LOG_DEBUG("Starting iterations with " << uniformizedMatrix.getRowCount() << " x " << uniformizedMatrix.getColumnCount() << " matrix.");
+                
+                // For the steady-state detection, we need for each time bound and each index i (relative to the left truncation point)
+                // the sum of the weights w_j with j >= i and the sum of the terms w_j * (j - i + 1) with j >= i.
+                std::vector<std::vector<ValueType>> weightSuffixSums(timeBounds.size());
+                std::vector<std::vector<ValueType>> stepWeightSuffixSums(timeBounds.size());
+                if (detectSteadyState) {
+                    for (auto boundIndex : remainingTimeBounds) {
+                        auto const& weights = foxGlynnResults[boundIndex].weights;
+                        auto& suffixSums = weightSuffixSums[boundIndex];
+                        auto& stepSuffixSums = stepWeightSuffixSums[boundIndex];
+                        suffixSums.assign(weights.size() + 1, storm::utility::zero<ValueType>());
+                        stepSuffixSums.assign(weights.size() + 1, storm::utility::zero<ValueType>());
+                        for (uint_fast64_t i = weights.size(); i > 0; --i) {
+                            suffixSums[i - 1] = suffixSums[i] + weights[i - 1];
+                            stepSuffixSums[i - 1] = stepSuffixSums[i] + suffixSums[i - 1];
+                        }
+                    }
+                }
+                // Retrieves the sum of the weights w_j and the sum of the terms w_j * (j - index) over all j > index.
+                auto getWeightsAfter = [&] (uint_fast64_t boundIndex, uint_fast64_t index) -> std::pair<ValueType, ValueType> {
+                    auto const& foxGlynnResult = foxGlynnResults[boundIndex];
+                    if (index >= foxGlynnResult.right) {
+                        return {storm::utility::zero<ValueType>(), storm::utility::zero<ValueType>()};
+                    } else if (index + 1 >= foxGlynnResult.left) {
+                        uint_fast64_t position = index + 1 - foxGlynnResult.left;
+                        return {weightSuffixSums[boundIndex][position], stepWeightSuffixSums[boundIndex][position]};
+                    } else {
+                        ValueType const& weightSum = weightSuffixSums[boundIndex].front();
+                        return {weightSum, stepWeightSuffixSums[boundIndex].front() + storm::utility::convertNumber<ValueType>(foxGlynnResult.left - index - 1) * weightSum};
+                    }
+                };
+                
+                // The matrix-vector products are the same for all time bounds, so we perform them only once (up to the largest right truncation point)
+                // and add the scaled result to all time bounds for which the current index lies between the truncation points.
+                auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, uniformizedMatrix);
+                std::vector<ValueType> nextValues;
+                ValueType weight = storm::utility::zero<ValueType>();
+                std::function<ValueType(ValueType const&, ValueType const&)> addAndScale = [&weight] (ValueType const& a, ValueType const& b) { return a + weight * b; };
+                for (uint_fast64_t index = 1; index <= maxRight; ++index) {
+                    ValueType maxDifference = storm::utility::zero<ValueType>();
+                    if (detectSteadyState) {
+                        nextValues.resize(values.size());
+                        multiplier->multiply(env, values, addVector, nextValues);
+                        maxDifference = storm::utility::vector::maximumElementDiff(values, nextValues);
+                        values.swap(nextValues);
+                    } else {
+                        multiplier->multiply(env, values, addVector, values);
+                    }
+                    
+                    for (auto boundIndex : remainingTimeBounds) {
+                        auto const& foxGlynnResult = foxGlynnResults[boundIndex];
+                        if (index >= foxGlynnResult.left && index <= foxGlynnResult.right) {
+                            weight = foxGlynnResult.weights[index - foxGlynnResult.left];
+                            storm::utility::vector::applyPointwise(result[boundIndex], values, result[boundIndex], addAndScale);
+                        }
+                    }
+                    
+                    if (detectSteadyState && index < maxRight) {
+                        // The uniformized matrix is substochastic, so the difference between two consecutive iterates does not grow in later iterations.
+                        // Hence, the iterate j > index differs from the current one by at most (j - index) * maxDifference. If the current iterate is used
+                        // for all remaining indices, the error is therefore bounded by maxDifference times the sum of the terms w_j * (j - index).
+                        bool steadyStateReached = true;
+                        for (auto boundIndex : remainingTimeBounds) {
+                            if (maxDifference * getWeightsAfter(boundIndex, index).second > truncationError * foxGlynnResults[boundIndex].totalWeight) {
+                                steadyStateReached = false;
+                                break;
+                            }
+                        }
+                        if (steadyStateReached) {
+                            STORM_LOG_INFO("Detected steady state after " << index << " of " << maxRight << " iterations.");
+                            for (auto boundIndex : remainingTimeBounds) {
+                                weight = getWeightsAfter(boundIndex, index).first;
+                                if (!storm::utility::isZero(weight)) {
+                                    storm::utility::vector::applyPointwise(result[boundIndex], values, result[boundIndex], addAndScale);
+                                }
+                            }
+                            break;
+                        }
+                    }
+                }
+                
+                // Finally, divide the results by the total weight
+                for (auto boundIndex : remainingTimeBounds) {
+                    storm::utility::vector::scaleVectorInPlace<ValueType, ValueType>(result[boundIndex], storm::utility::one<ValueType>() / foxGlynnResults[boundIndex].totalWeight);
+                }
+                return result;
+            }
+            
             template <typename ValueType>
             storm::storage::SparseMatrix<ValueType> SparseCtmcCslHelper::computeProbabilityMatrix(storm::storage::SparseMatrix<ValueType> const& rateMatrix, std::vector<ValueType> const& exitRates) {
                 // Turn the rates into probabilities by scaling each row with the exit rate of the state.
@@ -690,7 +887,9 @@ namespace storm {
             
             template std::vector<double> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<double> const& exitRates, bool qualitative, double lowerBound, double upperBound);
             
-            template std::vector<double> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, std::vector<double> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative);
+            template std::vector<std::vector<double>> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<double> const& exitRates, std::vector<double> const& upperBounds);
+            
+            template std::vector<double> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, std::vector<double> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, ModelCheckerHint const& hint);
 
             template std::vector<double> SparseCtmcCslHelper::computeAllUntilProbabilities(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& rateMatrix, std::vector<double> const& exitRateVector, storm::storage::BitVector const& initialStates, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
 
@@ -698,9 +897,9 @@ namespace storm {
             
             template std::vector<double> SparseCtmcCslHelper::computeInstantaneousRewards(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& rateMatrix, std::vector<double> const& exitRateVector, storm::models::sparse::StandardRewardModel<double> const& rewardModel, double timeBound);
             
-            template std::vector<double> SparseCtmcCslHelper::computeReachabilityTimes(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, std::vector<double> const& exitRateVector, storm::storage::BitVector const& targetStates, bool qualitative);
+            template std::vector<double> SparseCtmcCslHelper::computeReachabilityTimes(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, std::vector<double> const& exitRateVector, storm::storage::BitVector const& targetStates, bool qualitative, ModelCheckerHint const& hint);
             
-            template std::vector<double> SparseCtmcCslHelper::computeReachabilityRewards(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, std::vector<double> const& exitRateVector, storm::models::sparse::StandardRewardModel<double> const& rewardModel, storm::storage::BitVector const& targetStates, bool qualitative);
+            template std::vector<double> SparseCtmcCslHelper::computeReachabilityRewards(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, std::vector<double> const& exitRateVector, storm::models::sparse::StandardRewardModel<double> const& rewardModel, storm::storage::BitVector const& targetStates, bool qualitative, ModelCheckerHint const& hint);
             
             template std::vector<double> SparseCtmcCslHelper::computeTotalRewards(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, std::vector<double> const& exitRateVector, storm::models::sparse::StandardRewardModel<double> const& rewardModel, bool qualitative);
             
@@ -711,13 +910,17 @@ namespace storm {
             template storm::storage::SparseMatrix<double> SparseCtmcCslHelper::computeUniformizedMatrix(storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::BitVector const& maybeStates, double uniformizationRate, std::vector<double> const& exitRates);
             
             template std::vector<double> SparseCtmcCslHelper::computeTransientProbabilities(Environment const& env, storm::storage::SparseMatrix<double> const& uniformizedMatrix, std::vector<double> const* addVector, double timeBound, double uniformizationRate, std::vector<double> values, double epsilon);
+            
+            template std::vector<std::vector<double>> SparseCtmcCslHelper::computeTransientProbabilities(Environment const& env, storm::storage::SparseMatrix<double> const& uniformizedMatrix, std::vector<double> const* addVector, std::vector<double> const& timeBounds, double uniformizationRate, std::vector<double> values, double epsilon);
 
 #ifdef STORM_HAVE_CARL
             template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalNumber> const& exitRates, bool qualitative, double lowerBound, double upperBound);
             template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalFunction>&& goal, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalFunction> const& exitRates, bool qualitative, double lowerBound, double upperBound);
+            template std::vector<std::vector<storm::RationalNumber>> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalNumber> const& exitRates, std::vector<double> const& upperBounds);
+            template std::vector<std::vector<storm::RationalFunction>> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalFunction> const& exitRates, std::vector<double> const& upperBounds);
 
-            template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative);
-            template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalFunction>&& goal, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, std::vector<storm::RationalFunction> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative);
+            template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, ModelCheckerHint const& hint);
+            template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalFunction>&& goal, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, std::vector<storm::RationalFunction> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, ModelCheckerHint const& hint);
 
             template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeAllUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, std::vector<storm::RationalNumber> const& exitRateVector, storm::storage::BitVector const& initialStates, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
             template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeAllUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalFunction>&& goal, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, std::vector<storm::RationalFunction> const& exitRateVector, storm::storage::BitVector const& initialStates, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
@@ -728,11 +931,11 @@ namespace storm {
             template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeInstantaneousRewards(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, std::vector<storm::RationalNumber> const& exitRateVector, storm::models::sparse::StandardRewardModel<storm::RationalNumber> const& rewardModel, double timeBound);
             template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeInstantaneousRewards(Environment const& env, storm::solver::SolveGoal<storm::RationalFunction>&& goal, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, std::vector<storm::RationalFunction> const& exitRateVector, storm::models::sparse::StandardRewardModel<storm::RationalFunction> const& rewardModel, double timeBound);
 
-            template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeReachabilityTimes(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& exitRateVector, storm::storage::BitVector const& targetStates, bool qualitative);
-            template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeReachabilityTimes(Environment const& env, storm::solver::SolveGoal<storm::RationalFunction>&& goal, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, std::vector<storm::RationalFunction> const& exitRateVector, storm::storage::BitVector const& targetStates, bool qualitative);
+            template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeReachabilityTimes(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& exitRateVector, storm::storage::BitVector const& targetStates, bool qualitative, ModelCheckerHint const& hint);
+            template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeReachabilityTimes(Environment const& env, storm::solver::SolveGoal<storm::RationalFunction>&& goal, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, std::vector<storm::RationalFunction> const& exitRateVector, storm::storage::BitVector const& targetStates, bool qualitative, ModelCheckerHint const& hint);
 
-            template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeReachabilityRewards(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& exitRateVector, storm::models::sparse::StandardRewardModel<storm::RationalNumber> const& rewardModel, storm::storage::BitVector const& targetStates, bool qualitative);
-            template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeReachabilityRewards(Environment const& env, storm::solver::SolveGoal<storm::RationalFunction>&& goal, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, std::vector<storm::RationalFunction> const& exitRateVector, storm::models::sparse::StandardRewardModel<storm::RationalFunction> const& rewardModel, storm::storage::BitVector const& targetStates, bool qualitative);
+            template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeReachabilityRewards(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& exitRateVector, storm::models::sparse::StandardRewardModel<storm::RationalNumber> const& rewardModel, storm::storage::BitVector const& targetStates, bool qualitative, ModelCheckerHint const& hint);
+            template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeReachabilityRewards(Environment const& env, storm::solver::SolveGoal<storm::RationalFunction>&& goal, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, std::vector<storm::RationalFunction> const& exitRateVector, storm::models::sparse::StandardRewardModel<storm::RationalFunction> const& rewardModel, storm::storage::BitVector const& targetStates, bool qualitative, ModelCheckerHint const& hint);
 
             template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeTotalRewards(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& exitRateVector, storm::models::sparse::StandardRewardModel<storm::RationalNumber> const& rewardModel, bool qualitative);
             template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeTotalRewards(Environment const& env, storm::solver::SolveGoal<storm::RationalFunction>&& goal, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, std::vector<storm::RationalFunction> const& exitRateVector, storm::models::sparse::StandardRewardModel<storm::RationalFunction> const& rewardModel, bool qualitative);
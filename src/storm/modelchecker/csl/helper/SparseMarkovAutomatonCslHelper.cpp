@@ -12,6 +12,7 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/GeneralSettings.h"
+#include "storm/settings/modules/IOSettings.h"
 #include "storm/settings/modules/MinMaxEquationSolverSettings.h"
 #include "storm/solver/Multiplier.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
@@ -25,6 +26,7 @@
 #include "storm/utility/graph.h"
 #include "storm/utility/NumberTraits.h"
 #include "storm/utility/SignalHandler.h"
+#include "storm/io/export.h"
 
 
 
@@ -68,6 +70,17 @@ namespace storm {
                 }
                 
                 std::vector<ValueType> computeBoundedUntilProbabilities(storm::Environment const& env, OptimizationDirection dir, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, ValueType const& upperTimeBound, boost::optional<storm::storage::BitVector> const& relevantStates = boost::none) {
+                    return std::move(computeBoundedUntilProbabilities(env, dir, phiStates, psiStates, std::vector<ValueType>({upperTimeBound}), relevantStates).front());
+                }
+                
+                /*!
+                 * Computes the bounded until probabilities for several upper time bounds.
+                 * The graph analysis and the decomposition of the transitions are only done once. Moreover, the time bounds are processed
+                 * in ascending order such that the uniformization rate that was sufficient for one time bound is the starting point for the next one.
+                 *
+                 * @return For each upper time bound (in the same order), the vector of probabilities.
+                 */
+                std::vector<std::vector<ValueType>> computeBoundedUntilProbabilities(storm::Environment const& env, OptimizationDirection dir, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& upperTimeBounds, boost::optional<storm::storage::BitVector> const& relevantStates = boost::none) {
                     // Since there is no lower time bound, we can treat the psiStates as if they are absorbing.
                     
                     // Compute some important subsets of states
@@ -76,29 +89,37 @@ namespace storm {
                     storm::storage::BitVector probabilisticMaybeStates = ~markovianStates & maybeStates;
                     storm::storage::BitVector markovianStatesModMaybeStates = markovianMaybeStates % maybeStates;
                     storm::storage::BitVector probabilisticStatesModMaybeStates = probabilisticMaybeStates % maybeStates;
-                    // Catch the case where this query can be solved by solving the untimed variant instead.
+                    // Catch the cases where this query can be solved by solving the untimed variant instead.
                     // This is the case if there is no Markovian maybe state (e.g. if the initial state is already a psi state) of if the time bound is infinity.
-                    if (markovianMaybeStates.empty() || storm::utility::isInfinity(upperTimeBound)) {
-                        return SparseMarkovAutomatonCslHelper::computeUntilProbabilities<ValueType>(env, dir, transitionMatrix, transitionMatrix.transpose(true), phiStates, psiStates, false, false).values;
+                    std::vector<std::vector<ValueType>> results(upperTimeBounds.size());
+                    std::vector<ValueType> untimedResult;
+                    std::vector<uint64_t> timeBoundOrder;
+                    for (uint64_t timeBoundIndex = 0; timeBoundIndex < upperTimeBounds.size(); ++timeBoundIndex) {
+                        if (markovianMaybeStates.empty() || storm::utility::isInfinity(upperTimeBounds[timeBoundIndex])) {
+                            if (untimedResult.empty()) {
+                                untimedResult = SparseMarkovAutomatonCslHelper::computeUntilProbabilities<ValueType>(env, dir, transitionMatrix, transitionMatrix.transpose(true), phiStates, psiStates, false, false).values;
+                            }
+                            results[timeBoundIndex] = untimedResult;
+                        } else {
+                            timeBoundOrder.push_back(timeBoundIndex);
+                        }
+                    }
+                    if (timeBoundOrder.empty()) {
+                        return results;
                     }
+                    std::sort(timeBoundOrder.begin(), timeBoundOrder.end(), [&upperTimeBounds] (uint64_t const& lhs, uint64_t const& rhs) { return upperTimeBounds[lhs] < upperTimeBounds[rhs]; });
                     
                     boost::optional<storm::storage::BitVector> relevantMaybeStates;
                     if (relevantStates) {
                         relevantMaybeStates = relevantStates.get() % maybeStates;
                     }
-                    // Store the best solution known so far (useful in cases where the computation gets aborted)
-                    std::vector<ValueType> bestKnownSolution;
-                    if (relevantMaybeStates) {
-                        bestKnownSolution.resize(relevantStates->size());
-                    }
-                    
                     // Get the exit rates restricted to only markovian maybe states.
                     std::vector<ValueType> markovianExitRates = storm::utility::vector::filterVector(exitRateVector, markovianMaybeStates);
                     
                     // Obtain parameters of the algorithm
                     auto two = storm::utility::convertNumber<ValueType>(2.0);
-                    // Truncation error
-                    ValueType kappa = storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getUnifPlusKappa());
+                    // Truncation error (might be decreased for individual time bounds)
+                    ValueType const initialKappa = storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getUnifPlusKappa());
                     // Precision to be achieved
                     ValueType epsilon = two * storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getPrecision());
                     bool relativePrecision = env.solver().timeBounded().getRelativeTerminationCriterion();
@@ -134,183 +155,197 @@ namespace storm {
                     std::vector<ValueType> nextProbabilisticStateValues(probabilisticToProbabilisticTransitions.getRowGroupCount());
                     std::vector<ValueType> eqSysRhs(probabilisticToProbabilisticTransitions.getRowCount());
                     
-                    // Start the outer iterations which increase the uniformization rate until lower and upper bound on the result vector is sufficiently small
-                    storm::utility::ProgressMeasurement progressIterations("iterations");
-                    uint64_t iteration = 0;
-                    progressIterations.startNewMeasurement(iteration);
-                    bool converged = false;
-                    bool abortedInnerIterations = false;
-                    while (!converged) {
-                        // Maximal step size
-                        uint64_t N = storm::utility::ceil(lambda * upperTimeBound * std::exp(2) - storm::utility::log(kappa * epsilon));
-                        // Compute poisson distribution.
-                        // The division by 8 is similar to what is done for CTMCs (probably to reduce numerical impacts?)
-                        auto foxGlynnResult = storm::utility::numerical::foxGlynn(lambda * upperTimeBound, epsilon * kappa / storm::utility::convertNumber<ValueType>(8.0));
-                        // Scale the weights so they sum to one.
-                        //storm::utility::vector::scaleVectorInPlace(foxGlynnResult.weights, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
+                    // Process the time bounds in ascending order.
+                    for (auto const& timeBoundIndex : timeBoundOrder) {
+                        ValueType const& upperTimeBound = upperTimeBounds[timeBoundIndex];
+                        ValueType kappa = initialKappa;
+                        std::fill(maybeStatesValuesUpper.begin(), maybeStatesValuesUpper.end(), storm::utility::zero<ValueType>());
                         
-                        // Set up multiplier
-                        auto markovianToMaybeMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, markovianToMaybeTransitions);
-                        auto probabilisticToMarkovianMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, probabilisticToMarkovianTransitions);
+                        // Store the best solution known so far (useful in cases where the computation gets aborted)
+                        std::vector<ValueType> bestKnownSolution;
+                        if (relevantMaybeStates) {
+                            bestKnownSolution.resize(relevantStates->size());
+                        }
                         
-                        //Perform inner iterations first for upper, then for lower bound
-                        STORM_LOG_ASSERT(!storm::utility::vector::hasNonZeroEntry(maybeStatesValuesUpper), "Current values need to be initialized with zero.");
-                        for (bool computeLowerBound : {false, true}) {
-                            auto& maybeStatesValues = computeLowerBound ? maybeStatesValuesLower : maybeStatesValuesWeightedUpper;
-                            ValueType targetValue = computeLowerBound ? storm::utility::zero<ValueType>() : storm::utility::one<ValueType>();
-                            storm::utility::ProgressMeasurement progressSteps("steps in iteration " + std::to_string(iteration) + " for " + std::string(computeLowerBound ? "lower" : "upper") + " bounds.");
-                            progressSteps.setMaxCount(N);
-                            progressSteps.startNewMeasurement(0);
-                            bool firstIteration = true; // The first iterations can be irrelevant, because they will only produce zeroes anyway.
-                            int64_t k = N;
-                            // Iteration k = N is always non-relevant
-                            for (--k; k >= 0; --k) {
+                        // Start the outer iterations which increase the uniformization rate until lower and upper bound on the result vector is sufficiently small
+                        storm::utility::ProgressMeasurement progressIterations("iterations");
+                        uint64_t iteration = 0;
+                        progressIterations.startNewMeasurement(iteration);
+                        bool converged = false;
+                        bool abortedInnerIterations = false;
+                        while (!converged) {
+                            // Maximal step size
+                            uint64_t N = storm::utility::ceil(lambda * upperTimeBound * std::exp(2) - storm::utility::log(kappa * epsilon));
+                            // Compute poisson distribution.
+                            // The division by 8 is similar to what is done for CTMCs (probably to reduce numerical impacts?)
+                            auto foxGlynnResult = storm::utility::numerical::foxGlynn(lambda * upperTimeBound, epsilon * kappa / storm::utility::convertNumber<ValueType>(8.0));
+                            // Scale the weights so they sum to one.
+                            //storm::utility::vector::scaleVectorInPlace(foxGlynnResult.weights, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
+                        
+                            // Set up multiplier
+                            auto markovianToMaybeMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, markovianToMaybeTransitions);
+                            auto probabilisticToMarkovianMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, probabilisticToMarkovianTransitions);
+                        
+                            //Perform inner iterations first for upper, then for lower bound
+                            STORM_LOG_ASSERT(!storm::utility::vector::hasNonZeroEntry(maybeStatesValuesUpper), "Current values need to be initialized with zero.");
+                            for (bool computeLowerBound : {false, true}) {
+                                auto& maybeStatesValues = computeLowerBound ? maybeStatesValuesLower : maybeStatesValuesWeightedUpper;
+                                ValueType targetValue = computeLowerBound ? storm::utility::zero<ValueType>() : storm::utility::one<ValueType>();
+                                storm::utility::ProgressMeasurement progressSteps("steps in iteration " + std::to_string(iteration) + " for " + std::string(computeLowerBound ? "lower" : "upper") + " bounds.");
+                                progressSteps.setMaxCount(N);
+                                progressSteps.startNewMeasurement(0);
+                                bool firstIteration = true; // The first iterations can be irrelevant, because they will only produce zeroes anyway.
+                                int64_t k = N;
+                                // Iteration k = N is always non-relevant
+                                for (--k; k >= 0; --k) {
                                 
-                                // Check whether the iteration is relevant, that is, whether it will contribute non-zero values to the overall result
-                                if (computeLowerBound) {
-                                    // Check whether the value for visiting a target state will be zero.
-                                    if (static_cast<uint64_t>(k) > foxGlynnResult.right) {
-                                        // Reaching this point means that we are in one of the earlier iterations where fox glynn told us to cut off
-                                        continue;
-                                    }
-                                } else {
-                                    uint64_t i = N-1-k;
-                                    if (i > foxGlynnResult.right) {
-                                        // Reaching this point means that we are in a later iteration which will not contribute to the upper bound
-                                        // Since i will only get larger in subsequent iterations, we can directly break here.
-                                        break;
+                                    // Check whether the iteration is relevant, that is, whether it will contribute non-zero values to the overall result
+                                    if (computeLowerBound) {
+                                        // Check whether the value for visiting a target state will be zero.
+                                        if (static_cast<uint64_t>(k) > foxGlynnResult.right) {
+                                            // Reaching this point means that we are in one of the earlier iterations where fox glynn told us to cut off
+                                            continue;
+                                        }
+                                    } else {
+                                        uint64_t i = N-1-k;
+                                        if (i > foxGlynnResult.right) {
+                                            // Reaching this point means that we are in a later iteration which will not contribute to the upper bound
+                                            // Since i will only get larger in subsequent iterations, we can directly break here.
+                                            break;
+                                        }
                                     }
-                                }
                                 
-                                // Compute the values at Markovian maybe states.
-                                if (firstIteration) {
-                                    firstIteration = false;
-                                    // Reaching this point means that this is the very first relevant iteration.
-                                    // If we are in the very first relevant iteration, we know that all states from the previous iteration have value zero.
-                                    // It is therefore valid (and necessary) to just set the values of Markovian states to zero.
-                                    std::fill(nextMarkovianStateValues.begin(), nextMarkovianStateValues.end(), storm::utility::zero<ValueType>());
-                                } else {
                                     // Compute the values at Markovian maybe states.
-                                    markovianToMaybeMultiplier->multiply(env, maybeStatesValues, nullptr, nextMarkovianStateValues);
-                                    for (auto const& oneStepProb : markovianToPsiProbabilities) {
-                                        nextMarkovianStateValues[oneStepProb.first] += oneStepProb.second * targetValue;
+                                    if (firstIteration) {
+                                        firstIteration = false;
+                                        // Reaching this point means that this is the very first relevant iteration.
+                                        // If we are in the very first relevant iteration, we know that all states from the previous iteration have value zero.
+                                        // It is therefore valid (and necessary) to just set the values of Markovian states to zero.
+                                        std::fill(nextMarkovianStateValues.begin(), nextMarkovianStateValues.end(), storm::utility::zero<ValueType>());
+                                    } else {
+                                        // Compute the values at Markovian maybe states.
+                                        markovianToMaybeMultiplier->multiply(env, maybeStatesValues, nullptr, nextMarkovianStateValues);
+                                        for (auto const& oneStepProb : markovianToPsiProbabilities) {
+                                            nextMarkovianStateValues[oneStepProb.first] += oneStepProb.second * targetValue;
+                                        }
                                     }
-                                }
 
-                                // Update the value when reaching a psi state.
-                                // This has to be done after updating the Markovian state values since we needed the 'old' target value above.
-                                if (computeLowerBound && static_cast<uint64_t>(k) >= foxGlynnResult.left) {
-                                    assert(static_cast<uint64_t>(k) <= foxGlynnResult.right); // has to hold since this iteration is relevant
-                                    targetValue += foxGlynnResult.weights[k - foxGlynnResult.left];
-                                }
+                                    // Update the value when reaching a psi state.
+                                    // This has to be done after updating the Markovian state values since we needed the 'old' target value above.
+                                    if (computeLowerBound && static_cast<uint64_t>(k) >= foxGlynnResult.left) {
+                                        assert(static_cast<uint64_t>(k) <= foxGlynnResult.right); // has to hold since this iteration is relevant
+                                        targetValue += foxGlynnResult.weights[k - foxGlynnResult.left];
+                                    }
                                 
-                                // Compute the values at probabilistic states.
-                                probabilisticToMarkovianMultiplier->multiply(env, nextMarkovianStateValues, nullptr, eqSysRhs);
-                                for (auto const& oneStepProb : probabilisticToPsiProbabilities) {
-                                    eqSysRhs[oneStepProb.first] += oneStepProb.second * targetValue;
-                                }
-                                if (solver) {
-                                    solver->solveEquations(solverEnv, dir, nextProbabilisticStateValues, eqSysRhs);
-                                } else {
-                                    storm::utility::vector::reduceVectorMinOrMax(dir, eqSysRhs, nextProbabilisticStateValues, probabilisticToProbabilisticTransitions.getRowGroupIndices());
-                                }
+                                    // Compute the values at probabilistic states.
+                                    probabilisticToMarkovianMultiplier->multiply(env, nextMarkovianStateValues, nullptr, eqSysRhs);
+                                    for (auto const& oneStepProb : probabilisticToPsiProbabilities) {
+                                        eqSysRhs[oneStepProb.first] += oneStepProb.second * targetValue;
+                                    }
+                                    if (solver) {
+                                        solver->solveEquations(solverEnv, dir, nextProbabilisticStateValues, eqSysRhs);
+                                    } else {
+                                        storm::utility::vector::reduceVectorMinOrMax(dir, eqSysRhs, nextProbabilisticStateValues, probabilisticToProbabilisticTransitions.getRowGroupIndices());
+                                    }
                                 
-                                // Create the new values for the maybestates
-                                // Fuse the results together
-                                storm::utility::vector::setVectorValues(maybeStatesValues, markovianStatesModMaybeStates, nextMarkovianStateValues);
-                                storm::utility::vector::setVectorValues(maybeStatesValues, probabilisticStatesModMaybeStates, nextProbabilisticStateValues);
-                                if (!computeLowerBound) {
-                                    // Add the scaled values to the actual result vector
-                                    uint64_t i = N-1-k;
-                                    if (i >= foxGlynnResult.left) {
-                                        assert(i <= foxGlynnResult.right); // has to hold since this iteration is considered relevant.
-                                        ValueType const& weight = foxGlynnResult.weights[i - foxGlynnResult.left];
-                                        storm::utility::vector::addScaledVector(maybeStatesValuesUpper, maybeStatesValuesWeightedUpper, weight);
+                                    // Create the new values for the maybestates
+                                    // Fuse the results together
+                                    storm::utility::vector::setVectorValues(maybeStatesValues, markovianStatesModMaybeStates, nextMarkovianStateValues);
+                                    storm::utility::vector::setVectorValues(maybeStatesValues, probabilisticStatesModMaybeStates, nextProbabilisticStateValues);
+                                    if (!computeLowerBound) {
+                                        // Add the scaled values to the actual result vector
+                                        uint64_t i = N-1-k;
+                                        if (i >= foxGlynnResult.left) {
+                                            assert(i <= foxGlynnResult.right); // has to hold since this iteration is considered relevant.
+                                            ValueType const& weight = foxGlynnResult.weights[i - foxGlynnResult.left];
+                                            storm::utility::vector::addScaledVector(maybeStatesValuesUpper, maybeStatesValuesWeightedUpper, weight);
+                                        }
                                     }
-                                }
 
-                                progressSteps.updateProgress(N-k);
-                                if (storm::utility::resources::isTerminate()) {
-                                    abortedInnerIterations = true;
-                                    break;
+                                    progressSteps.updateProgress(N-k);
+                                    if (storm::utility::resources::isTerminate()) {
+                                        abortedInnerIterations = true;
+                                        break;
+                                    }
                                 }
-                            }
 
-                            if (computeLowerBound) {
-                                storm::utility::vector::scaleVectorInPlace(maybeStatesValuesLower, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
-                            } else {
-                                storm::utility::vector::scaleVectorInPlace(maybeStatesValuesUpper, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
-                            }
+                                if (computeLowerBound) {
+                                    storm::utility::vector::scaleVectorInPlace(maybeStatesValuesLower, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
+                                } else {
+                                    storm::utility::vector::scaleVectorInPlace(maybeStatesValuesUpper, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
+                                }
                             
-                            if (abortedInnerIterations || storm::utility::resources::isTerminate()) {
-                                break;
-                            }
+                                if (abortedInnerIterations || storm::utility::resources::isTerminate()) {
+                                    break;
+                                }
                             
-                            // Check if the lower and upper bound are sufficiently close to each other
-                            converged = checkConvergence(maybeStatesValuesLower, maybeStatesValuesUpper, relevantMaybeStates, epsilon, relativePrecision, kappa);
-                            if (converged) {
-                                break;
-                            }
+                                // Check if the lower and upper bound are sufficiently close to each other
+                                converged = checkConvergence(maybeStatesValuesLower, maybeStatesValuesUpper, relevantMaybeStates, epsilon, relativePrecision, kappa);
+                                if (converged) {
+                                    break;
+                                }
                             
-                            // Store the best solution we have found so far.
-                            if (relevantMaybeStates) {
-                                auto currentSolIt = bestKnownSolution.begin();
-                                for (auto state : relevantMaybeStates.get()) {
-                                    // We take the average of the lower and upper bounds
-                                    *currentSolIt = (maybeStatesValuesLower[state] + maybeStatesValuesUpper[state]) / two;
-                                    ++currentSolIt;
+                                // Store the best solution we have found so far.
+                                if (relevantMaybeStates) {
+                                    auto currentSolIt = bestKnownSolution.begin();
+                                    for (auto state : relevantMaybeStates.get()) {
+                                        // We take the average of the lower and upper bounds
+                                        *currentSolIt = (maybeStatesValuesLower[state] + maybeStatesValuesUpper[state]) / two;
+                                        ++currentSolIt;
+                                    }
                                 }
                             }
-                        }
                         
-                        if (!converged) {
-                            // Increase the uniformization rate and prepare the next run
+                            if (!converged) {
+                                // Increase the uniformization rate and prepare the next run
                             
-                            // Double lambda.
-                            ValueType oldLambda = lambda;
-                            lambda *= two;
-                            STORM_LOG_DEBUG("Increased lambda to " << lambda << ".");
+                                // Double lambda.
+                                ValueType oldLambda = lambda;
+                                lambda *= two;
+                                STORM_LOG_DEBUG("Increased lambda to " << lambda << ".");
                             
-                            if (relativePrecision) {
-                                // Reduce kappa a bit
-                                ValueType minValue;
-                                if (relevantMaybeStates) {
-                                    minValue = storm::utility::vector::min_if(maybeStatesValuesUpper, relevantMaybeStates.get());
-                                } else {
-                                    minValue = *std::min_element(maybeStatesValuesUpper.begin(), maybeStatesValuesUpper.end());
+                                if (relativePrecision) {
+                                    // Reduce kappa a bit
+                                    ValueType minValue;
+                                    if (relevantMaybeStates) {
+                                        minValue = storm::utility::vector::min_if(maybeStatesValuesUpper, relevantMaybeStates.get());
+                                    } else {
+                                        minValue = *std::min_element(maybeStatesValuesUpper.begin(), maybeStatesValuesUpper.end());
+                                    }
+                                    minValue *= storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getUnifPlusKappa());
+                                    kappa = std::min(kappa, minValue);
+                                    STORM_LOG_DEBUG("Decreased kappa to " << kappa << ".");
                                 }
-                                minValue *= storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getUnifPlusKappa());
-                                kappa = std::min(kappa, minValue);
-                                STORM_LOG_DEBUG("Decreased kappa to " << kappa << ".");
-                            }
                             
-                            // Apply uniformization with new rate
-                            uniformize(markovianToMaybeTransitions, markovianToPsiProbabilities, oldLambda, lambda, markovianStatesModMaybeStates);
+                                // Apply uniformization with new rate
+                                uniformize(markovianToMaybeTransitions, markovianToPsiProbabilities, oldLambda, lambda, markovianStatesModMaybeStates);
                             
-                            // Reset the values of the maybe states to zero.
-                            std::fill(maybeStatesValuesUpper.begin(), maybeStatesValuesUpper.end(), storm::utility::zero<ValueType>());
-                        }
-                        progressIterations.updateProgress(++iteration);
-                        if (storm::utility::resources::isTerminate()) {
-                            STORM_LOG_WARN("Aborted unif+ in iteration " << iteration << ".");
-                            break;
+                                // Reset the values of the maybe states to zero.
+                                std::fill(maybeStatesValuesUpper.begin(), maybeStatesValuesUpper.end(), storm::utility::zero<ValueType>());
+                            }
+                            progressIterations.updateProgress(++iteration);
+                            if (storm::utility::resources::isTerminate()) {
+                                STORM_LOG_WARN("Aborted unif+ in iteration " << iteration << ".");
+                                break;
+                            }
                         }
-                    }
 
-                    // Prepare the result vector
-                    std::vector<ValueType> result(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
-                    storm::utility::vector::setVectorValues(result, psiStates, storm::utility::one<ValueType>());
+                        // Prepare the result vector
+                        std::vector<ValueType>& result = results[timeBoundIndex];
+                        result.assign(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+                        storm::utility::vector::setVectorValues(result, psiStates, storm::utility::one<ValueType>());
                     
-                    if (abortedInnerIterations && iteration > 1 && relevantMaybeStates && relevantStates) {
-                        // We should take the stored solution instead of the current (probably more incorrect) lower/upper values
-                        storm::utility::vector::setVectorValues(result, maybeStates & relevantStates.get(), bestKnownSolution);
-                    } else {
-                        // We take the average of the lower and upper bounds
-                        storm::utility::vector::applyPointwise<ValueType, ValueType, ValueType>(maybeStatesValuesLower, maybeStatesValuesUpper, maybeStatesValuesLower, [&two] (ValueType const& a, ValueType const& b) -> ValueType { return (a + b) / two; });
+                        if (abortedInnerIterations && iteration > 1 && relevantMaybeStates && relevantStates) {
+                            // We should take the stored solution instead of the current (probably more incorrect) lower/upper values
+                            storm::utility::vector::setVectorValues(result, maybeStates & relevantStates.get(), bestKnownSolution);
+                        } else {
+                            // We take the average of the lower and upper bounds
+                            storm::utility::vector::applyPointwise<ValueType, ValueType, ValueType>(maybeStatesValuesLower, maybeStatesValuesUpper, maybeStatesValuesLower, [&two] (ValueType const& a, ValueType const& b) -> ValueType { return (a + b) / two; });
     
-                        storm::utility::vector::setVectorValues(result, maybeStates, maybeStatesValuesLower);
+                            storm::utility::vector::setVectorValues(result, maybeStates, maybeStatesValuesLower);
+                        }
                     }
-                    return result;
+                    return results;
                 }
 
             private:
@@ -675,14 +710,70 @@ namespace storm {
                         if (goal.hasRelevantValues()) {
                             relevantValues = std::move(goal.relevantValues());
                         }
+                        auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
+                        if (ioSettings.isExportCdfSet() && relevantValues && !storm::utility::isInfinity(boundsPair.second)) {
+                            // Evaluate the cdf at equidistant time points. The last time point is the actual time bound.
+                            uint64_t numberOfTimePoints = ioSettings.getExportCdfNumberOfTimePoints();
+                            std::vector<ValueType> timePoints;
+                            for (uint64_t i = 1; i <= numberOfTimePoints; ++i) {
+                                timePoints.push_back(storm::utility::convertNumber<ValueType>(boundsPair.second) * storm::utility::convertNumber<ValueType>(i) / storm::utility::convertNumber<ValueType>(numberOfTimePoints));
+                            }
+                            std::vector<std::vector<ValueType>> cdfResults = helper.computeBoundedUntilProbabilities(env, goal.direction(), phiStates, psiStates, timePoints, relevantValues);
+                            
+                            std::vector<std::vector<ValueType>> cdfData;
+                            for (uint64_t i = 0; i < timePoints.size(); ++i) {
+                                std::vector<ValueType> cdfEntry = {timePoints[i]};
+                                for (auto state : relevantValues.get()) {
+                                    cdfEntry.push_back(cdfResults[i][state]);
+                                }
+                                cdfData.push_back(std::move(cdfEntry));
+                            }
+                            std::vector<std::string> headers = {"Time"};
+                            for (auto state : relevantValues.get()) {
+                                headers.push_back("Result (state " + std::to_string(state) + ")");
+                            }
+                            storm::utility::exportDataToCSVFile<ValueType, std::string, std::string>(ioSettings.getExportCdfDirectory() + "cdf.csv", cdfData, headers);
+                            return std::move(cdfResults.back());
+                        }
                         return helper.computeBoundedUntilProbabilities(env, goal.direction(), phiStates, psiStates, boundsPair.second, relevantValues);
                 }
             }
+            
+            template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<std::vector<ValueType>> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<double> const& upperBounds) {
+                STORM_LOG_THROW(!env.solver().isForceExact(), storm::exceptions::InvalidOperationException, "Exact computations not possible for bounded until probabilities.");
+                
+                if (env.solver().timeBounded().getMaMethod() == storm::solver::MaBoundedReachabilityMethod::Imca && phiStates.full()) {
+                    // IMCA does not share any work among the time bounds, so we just check them one after another.
+                    std::vector<std::vector<ValueType>> result;
+                    for (auto const& upperBound : upperBounds) {
+                        result.push_back(computeBoundedUntilProbabilitiesImca(env, goal.direction(), transitionMatrix, exitRateVector, markovianStates, psiStates, std::make_pair(0.0, upperBound)));
+                    }
+                    return result;
+                }
+                
+                UnifPlusHelper<ValueType> helper(transitionMatrix, exitRateVector, markovianStates);
+                boost::optional<storm::storage::BitVector> relevantValues;
+                if (goal.hasRelevantValues()) {
+                    relevantValues = std::move(goal.relevantValues());
+                }
+                std::vector<ValueType> timeBounds;
+                timeBounds.reserve(upperBounds.size());
+                for (auto const& upperBound : upperBounds) {
+                    timeBounds.push_back(storm::utility::convertNumber<ValueType>(upperBound));
+                }
+                return helper.computeBoundedUntilProbabilities(env, goal.direction(), phiStates, psiStates, timeBounds, relevantValues);
+            }
               
             template <typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
             std::vector<ValueType> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::pair<double, double> const& boundsPair) {
                 STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
             }
+            
+            template <typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<std::vector<ValueType>> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilities(Environment const&, storm::solver::SolveGoal<ValueType>&&, storm::storage::SparseMatrix<ValueType> const&, std::vector<ValueType> const&, storm::storage::BitVector const&, storm::storage::BitVector const&, storm::storage::BitVector const&, std::vector<double> const&) {
+                STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
+            }
 
             template<typename ValueType>
             MDPSparseModelCheckingHelperReturnType<ValueType> SparseMarkovAutomatonCslHelper::computeUntilProbabilities(Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler) {
@@ -731,6 +822,8 @@ namespace storm {
             }
 
             template std::vector<double> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& transitionMatrix, std::vector<double> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::pair<double, double> const& boundsPair);
+            
+            template std::vector<std::vector<double>> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& transitionMatrix, std::vector<double> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<double> const& upperBounds);
                 
             template MDPSparseModelCheckingHelperReturnType<double> SparseMarkovAutomatonCslHelper::computeUntilProbabilities(Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler);
                 
@@ -741,6 +834,8 @@ namespace storm {
             template MDPSparseModelCheckingHelperReturnType<double> SparseMarkovAutomatonCslHelper::computeReachabilityTimes(Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, std::vector<double> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates, bool produceScheduler);
             
             template std::vector<storm::RationalNumber> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, std::vector<storm::RationalNumber> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::pair<double, double> const& boundsPair);
+            
+            template std::vector<std::vector<storm::RationalNumber>> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, std::vector<storm::RationalNumber> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<double> const& upperBounds);
                 
             template MDPSparseModelCheckingHelperReturnType<storm::RationalNumber> SparseMarkovAutomatonCslHelper::computeUntilProbabilities(Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler);
                 
@@ -0,0 +1,30 @@
+#include "storm/modelchecker/prctl/helper/QualitativeStateSetsCache.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace helper {
+
+            std::pair<storm::storage::BitVector, storm::storage::BitVector> const& QualitativeStateSetsCache::getStatesWithProbability01(QualitativeAnalysis analysis, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::function<std::pair<storm::storage::BitVector, storm::storage::BitVector>()> const& computeStateSets) {
+                auto key = std::make_tuple(analysis, phiStates, psiStates);
+                auto findIt = statesWithProbability01.find(key);
+                if (findIt != statesWithProbability01.end()) {
+                    STORM_LOG_INFO("Reusing states with probability 0 and 1 computed for a previous property.");
+                    ++numberOfHits;
+                    return findIt->second;
+                }
+                return statesWithProbability01.emplace(std::move(key), computeStateSets()).first->second;
+            }
+
+            uint64_t QualitativeStateSetsCache::getNumberOfHits() const {
+                return numberOfHits;
+            }
+
+            uint64_t QualitativeStateSetsCache::getNumberOfEntries() const {
+                return statesWithProbability01.size();
+            }
+
+        }
+    }
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <utility>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace storage {
+        template <typename ValueType>
+        class SparseMatrix;
+    }
+
+    namespace modelchecker {
+        namespace helper {
+
+            // The qualitative analyses whose results are stored in the cache.
+            enum class QualitativeAnalysis { Prob01, Prob01Min, Prob01Max };
+
+            /*!
+             * Stores the results of qualitative analyses (states with probability 0 and 1) performed on the transition
+             * matrix of a sparse model, such that they can be shared among several properties checked on the same model.
+             * As these analyses only depend on the graph of the model, the cache is independent of the value type.
+             *
+             * The cache is bound to the transition matrix of the model it was created for. It only keeps a weak reference
+             * to the model, such that it is not applicable anymore once the model is destroyed (even if another matrix is
+             * later created at the same address). The transition matrix must not be modified while the cache is in use.
+             *
+             * The cache is not thread-safe, i.e., it must not be used by several threads at the same time.
+             */
+            class QualitativeStateSetsCache {
+            public:
+                template <typename ModelType>
+                QualitativeStateSetsCache(std::shared_ptr<ModelType> const& model) : model(model), transitionMatrix(&model->getTransitionMatrix()), numberOfHits(0) {
+                    // Intentionally left empty.
+                }
+
+                /*!
+                 * Retrieves whether the cache holds results for the given transition matrix, i.e., whether the model
+                 * the cache was created for still exists and the given matrix is its transition matrix.
+                 */
+                template <typename ValueType>
+                bool isApplicable(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) const {
+                    return !this->model.expired() && static_cast<void const*>(&transitionMatrix) == this->transitionMatrix;
+                }
+
+                /*!
+                 * Retrieves the states with probability 0 and 1 of satisfying phi until psi obtained by the given
+                 * analysis. If these are not yet known, they are obtained from the given function and stored.
+                 *
+                 * @param analysis The performed analysis.
+                 * @param phiStates The states satisfying phi.
+                 * @param psiStates The states satisfying psi.
+                 * @param computeStateSets A function computing the states with probability 0 and 1.
+                 * @return The states with probability 0 and 1.
+                 */
+                std::pair<storm::storage::BitVector, storm::storage::BitVector> const& getStatesWithProbability01(QualitativeAnalysis analysis, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::function<std::pair<storm::storage::BitVector, storm::storage::BitVector>()> const& computeStateSets);
+
+                /*!
+                 * Retrieves the number of requests that were answered from the cache.
+                 */
+                uint64_t getNumberOfHits() const;
+
+                /*!
+                 * Retrieves the number of stored results.
+                 */
+                uint64_t getNumberOfEntries() const;
+
+            private:
+                // The model for which the results are stored.
+                std::weak_ptr<void const> model;
+
+                // The transition matrix of the model. It is only compared with other matrices if the model still exists.
+                void const* transitionMatrix;
+
+                // The stored results indexed by the analysis and the phi and psi states.
+                std::map<std::tuple<QualitativeAnalysis, storm::storage::BitVector, storm::storage::BitVector>, std::pair<storm::storage::BitVector, storm::storage::BitVector>> statesWithProbability01;
+
+                // The number of requests that were answered from the cache.
+                uint64_t numberOfHits;
+            };
+
+        }
+    }
+}
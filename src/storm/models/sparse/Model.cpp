@@ -94,8 +94,18 @@ namespace storm {
             }
             
             template<typename ValueType, typename RewardModelType>
-            storm::storage::SparseMatrix<ValueType> Model<ValueType, RewardModelType>::getBackwardTransitions() const {
-                return this->getTransitionMatrix().transpose(true);
+            storm::storage::SparseMatrix<ValueType> const& Model<ValueType, RewardModelType>::getBackwardTransitions() const {
+                std::lock_guard<std::mutex> lock(*backwardTransitionsMutex);
+                if (!backwardTransitions) {
+                    backwardTransitions = std::make_shared<storm::storage::SparseMatrix<ValueType> const>(this->getTransitionMatrix().transpose(true));
+                }
+                return *backwardTransitions;
+            }
+            
+            template<typename ValueType, typename RewardModelType>
+            void Model<ValueType, RewardModelType>::invalidateBackwardTransitions() {
+                std::lock_guard<std::mutex> lock(*backwardTransitionsMutex);
+                backwardTransitions.reset();
             }
             
             template<typename ValueType, typename RewardModelType>
@@ -445,11 +455,13 @@ namespace storm {
             template<typename ValueType, typename RewardModelType>
             void Model<ValueType, RewardModelType>::setTransitionMatrix(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
                 this->transitionMatrix = transitionMatrix;
+                invalidateBackwardTransitions();
             }
             
             template<typename ValueType, typename RewardModelType>
             void Model<ValueType, RewardModelType>::setTransitionMatrix(storm::storage::SparseMatrix<ValueType>&& transitionMatrix) {
                 this->transitionMatrix = std::move(transitionMatrix);
+                invalidateBackwardTransitions();
             }
 
             template<typename ValueType, typename RewardModelType>
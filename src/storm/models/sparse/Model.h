@@ -1,6 +1,8 @@
 #ifndef STORM_MODELS_SPARSE_MODEL_H_
 #define STORM_MODELS_SPARSE_MODEL_H_
 
+#include <memory>
+#include <mutex>
 #include <vector>
 #include <unordered_map>
 #include <boost/optional.hpp>
@@ -49,11 +51,19 @@ namespace storm {
                
                 /*!
                  * Retrieves the backward transition relation of the model, i.e. a set of transitions between states
-                 * that correspond to the reversed transition relation of this model.
+                 * that correspond to the reversed transition relation of this model. The backward transitions are
+                 * computed upon the first call and then kept until the transition matrix is replaced or
+                 * invalidateBackwardTransitions is called. This function may be called concurrently.
                  *
                  * @return A sparse matrix that represents the backward transitions of this model.
                  */
-                storm::storage::SparseMatrix<ValueType> getBackwardTransitions() const;
+                storm::storage::SparseMatrix<ValueType> const& getBackwardTransitions() const;
+                
+                /*!
+                 * Discards the stored backward transitions, such that they are recomputed upon the next request. This
+                 * needs to be called after modifying the transition matrix in place.
+                 */
+                void invalidateBackwardTransitions();
                 
                 /*!
                  * Returns an object representing the matrix rows associated with the given state.
@@ -115,7 +125,8 @@ namespace storm {
                 storm::storage::SparseMatrix<ValueType> const& getTransitionMatrix() const;
                 
                 /*!
-                 * Retrieves the matrix representing the transitions of the model.
+                 * Retrieves the matrix representing the transitions of the model. If the matrix is modified, the stored
+                 * backward transitions have to be discarded using invalidateBackwardTransitions.
                  *
                  * @return A matrix representing the transitions of the model.
                  */
@@ -414,6 +425,13 @@ namespace storm {
                 //  A matrix representing transition relation.
                 storm::storage::SparseMatrix<ValueType> transitionMatrix;
                 
+                // If already computed, the transposed transition matrix. The matrix is shared among copies of the model
+                // and never modified, such that copies remain consistent.
+                mutable std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> backwardTransitions;
+                
+                // Guards the computation of the backward transitions.
+                std::shared_ptr<std::mutex> backwardTransitionsMutex = std::make_shared<std::mutex>();
+                
                 // The labeling of the states.
                 storm::models::sparse::StateLabeling stateLabeling;
                 
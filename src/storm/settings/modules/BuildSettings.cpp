@@ -37,6 +37,9 @@ namespace storm {
             const std::string buildOverlappingGuardsLabelOptionName = "build-overlapping-guards-label";
             const std::string noSimplifyOptionName = "no-simplify";
             const std::string bitsForUnboundedVariablesOptionName = "int-bits";
+            const std::string ddVariableOrderOptionName = "dd-var-order";
+            const std::string ddVariableOrderFileOptionName = "dd-var-order-file";
+            const std::string modelCacheOptionName = "model-cache";
 
             BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
 
@@ -59,6 +62,13 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, noSimplifyOptionName, false, "If set, simplification PRISM input is disabled.").setIsAdvanced().build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, bitsForUnboundedVariablesOptionName, false, "Sets the number of bits that is used for unbounded integer variables.").setIsAdvanced()
                                         .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "The number of bits.").addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedRangeValidatorExcluding(0,63)).setDefaultValueUnsignedInteger(32).build()).build());
+                std::vector<std::string> ddVariableOrderHeuristics = {"declaration", "force"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, ddVariableOrderOptionName, false, "Sets the heuristic that orders the variables of symbolic models.").setIsAdvanced()
+                                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the heuristic. 'declaration' uses the order of declaration, 'force' groups variables that interact.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(ddVariableOrderHeuristics)).setDefaultValueString("declaration").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, ddVariableOrderFileOptionName, false, "If set, the variable order of symbolic models is read from the given file if it matches the model. Otherwise, the computed order is written to the file.").setIsAdvanced()
+                                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file.").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, modelCacheOptionName, false, "If set, sparse models built from symbolic input are stored in and reused from the given directory.").setIsAdvanced()
+                                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("directory", "The cache directory.").build()).build());
             }
 
             bool BuildSettings::isExplorationOrderSet() const {
@@ -135,6 +145,32 @@ namespace storm {
                 return this->getOption(bitsForUnboundedVariablesOptionName).getArgumentByName("number").getValueAsUnsignedInteger();
             }
 
+            storm::builder::DdVariableOrderHeuristic BuildSettings::getDdVariableOrderHeuristic() const {
+                std::string heuristicAsString = this->getOption(ddVariableOrderOptionName).getArgumentByName("name").getValueAsString();
+                if (heuristicAsString == "declaration") {
+                    return storm::builder::DdVariableOrderHeuristic::Declaration;
+                } else if (heuristicAsString == "force") {
+                    return storm::builder::DdVariableOrderHeuristic::Force;
+                }
+                STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown variable order heuristic '" << heuristicAsString << "'.");
+            }
+
+            bool BuildSettings::isDdVariableOrderFileSet() const {
+                return this->getOption(ddVariableOrderFileOptionName).getHasOptionBeenSet();
+            }
+
+            std::string BuildSettings::getDdVariableOrderFilename() const {
+                return this->getOption(ddVariableOrderFileOptionName).getArgumentByName("filename").getValueAsString();
+            }
+
+            bool BuildSettings::isModelCacheSet() const {
+                return this->getOption(modelCacheOptionName).getHasOptionBeenSet();
+            }
+
+            std::string BuildSettings::getModelCacheDirectory() const {
+                return this->getOption(modelCacheOptionName).getArgumentByName("directory").getValueAsString();
+            }
+
         }
 
 
@@ -4,6 +4,7 @@
 #include "storm-config.h"
 #include "storm/settings/modules/ModuleSettings.h"
 #include "storm/builder/ExplorationOrder.h"
+#include "storm/builder/DdVariableOrder.h"
 
 namespace storm {
     namespace settings {
@@ -121,6 +122,33 @@ namespace storm {
                  */
                  bool isNoSimplifySet() const;
 
+                /*!
+                 * Retrieves the heuristic that orders the variables of symbolic models.
+                 *
+                 * @return The chosen heuristic.
+                 */
+                storm::builder::DdVariableOrderHeuristic getDdVariableOrderHeuristic() const;
+
+                /*!
+                 * Retrieves whether a file for the variable order of symbolic models was set.
+                 */
+                bool isDdVariableOrderFileSet() const;
+
+                /*!
+                 * Retrieves the name of the file for the variable order of symbolic models.
+                 */
+                std::string getDdVariableOrderFilename() const;
+
+                /*!
+                 * Retrieves whether a directory for caching built models was set.
+                 */
+                bool isModelCacheSet() const;
+
+                /*!
+                 * Retrieves the directory for caching built models.
+                 */
+                std::string getModelCacheDirectory() const;
+
                 // The name of the module.
                 static const std::string moduleName;
             };
@@ -28,6 +28,9 @@ namespace storm {
             const std::string CoreSettings::engineOptionName = "engine";
             const std::string CoreSettings::engineOptionShortName = "e";
             const std::string CoreSettings::ddLibraryOptionName = "ddlib";
+            const std::string CoreSettings::ddConversionThreadsOptionName = "dd-conversion-threads";
+            const std::string CoreSettings::ddRoundingOptionName = "dd-rounding";
+            const std::string CoreSettings::ddRoundingIntervalOptionName = "dd-rounding-interval";
             const std::string CoreSettings::cudaOptionName = "cuda";
             const std::string CoreSettings::intelTbbOptionName = "enable-tbb";
             const std::string CoreSettings::intelTbbOptionShortName = "tbb";
@@ -49,6 +52,12 @@ namespace storm {
                 std::vector<std::string> ddLibraries = {"cudd", "sylvan"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, ddLibraryOptionName, false, "Sets which library is preferred for decision-diagram operations.")
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the library to prefer.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(ddLibraries)).setDefaultValueString("sylvan").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, ddConversionThreadsOptionName, false, "Sets the number of threads used to convert decision diagrams into explicit matrices and vectors.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads.").setDefaultValueUnsignedInteger(1).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterEqualValidator(1)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, ddRoundingOptionName, false, "If set, symbolic iterative solvers round the values of the iterated decision diagrams to keep them small. The overall error introduced by rounding is bounded by the precision of the solver.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("precision", "The precision to round to. It is decreased to the next power of two.").addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, ddRoundingIntervalOptionName, false, "Sets the number of iterations after which symbolic iterative solvers round the values (if rounding is enabled).").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("iterations", "The number of iterations.").setDefaultValueUnsignedInteger(10).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterEqualValidator(1)).build()).build());
                 
                 std::vector<std::string> lpSolvers = {"gurobi", "glpk", "z3"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, lpSolverOptionName, false, "Sets which LP solver is preferred.")
@@ -128,6 +137,22 @@ namespace storm {
                 return !this->getOption(ddLibraryOptionName).getArgumentByName("name").getHasBeenSet() || this->getOption(ddLibraryOptionName).getArgumentByName("name").wasSetFromDefaultValue();
             }
             
+            uint_fast64_t CoreSettings::getNumberOfDdConversionThreads() const {
+                return this->getOption(ddConversionThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
+            bool CoreSettings::isDdRoundingSet() const {
+                return this->getOption(ddRoundingOptionName).getHasOptionBeenSet();
+            }
+            
+            double CoreSettings::getDdRoundingPrecision() const {
+                return this->getOption(ddRoundingOptionName).getArgumentByName("precision").getValueAsDouble();
+            }
+            
+            uint_fast64_t CoreSettings::getDdRoundingInterval() const {
+                return this->getOption(ddRoundingIntervalOptionName).getArgumentByName("iterations").getValueAsUnsignedInteger();
+            }
+            
             bool CoreSettings::isShowStatisticsSet() const {
                 return this->getOption(statisticsOptionName).getHasOptionBeenSet();
             }
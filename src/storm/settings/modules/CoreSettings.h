@@ -96,6 +96,34 @@ namespace storm {
                  */
                 bool isShowStatisticsSet() const;
 
+                /*!
+                 * Retrieves the number of threads used to convert decision diagrams into explicit matrices and vectors.
+                 *
+                 * @return The number of threads.
+                 */
+                uint_fast64_t getNumberOfDdConversionThreads() const;
+
+                /*!
+                 * Retrieves whether symbolic iterative solvers are to round the values of the iterated decision diagrams.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isDdRoundingSet() const;
+
+                /*!
+                 * Retrieves the precision to which symbolic iterative solvers round the values of the iterated decision diagrams.
+                 *
+                 * @return The rounding precision.
+                 */
+                double getDdRoundingPrecision() const;
+
+                /*!
+                 * Retrieves the number of iterations after which symbolic iterative solvers round the values.
+                 *
+                 * @return The number of iterations.
+                 */
+                uint_fast64_t getDdRoundingInterval() const;
+
                 /*!
                  * Retrieves whether the option to use Intel TBB is set.
                  *
@@ -140,6 +168,9 @@ namespace storm {
                 static const std::string engineOptionName;
                 static const std::string engineOptionShortName;
                 static const std::string ddLibraryOptionName;
+                static const std::string ddConversionThreadsOptionName;
+                static const std::string ddRoundingOptionName;
+                static const std::string ddRoundingIntervalOptionName;
                 static const std::string intelTbbOptionName;
                 static const std::string intelTbbOptionShortName;
                 static const std::string cudaOptionName;
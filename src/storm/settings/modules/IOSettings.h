@@ -96,6 +96,11 @@ namespace storm {
                  */
                  std::string getExportCdfDirectory() const;
                 
+                /*!
+                 * Retrieves the number of (equidistant) time points at which the cumulative density function of time bounded properties is evaluated
+                 */
+                uint64_t getExportCdfNumberOfTimePoints() const;
+                
                 /*!
                  * Retrieves whether an optimal scheduler is to be exported
                  */
@@ -364,6 +369,7 @@ namespace storm {
                 static const std::string exportDdOptionName;
                 static const std::string exportCdfOptionName;
                 static const std::string exportCdfOptionShortName;
+                static const std::string exportCdfTimePointsOptionName;
                 static const std::string exportSchedulerOptionName;
                 static const std::string exportCheckResultOptionName;
                 static const std::string explicitOptionName;
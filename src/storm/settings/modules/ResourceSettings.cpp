@@ -16,6 +16,7 @@ namespace storm {
             const std::string ResourceSettings::printTimeAndMemoryOptionName = "timemem";
             const std::string ResourceSettings::printTimeAndMemoryOptionShortName = "tm";
             const std::string ResourceSettings::signalWaitingTimeOptionName = "signal-timeout";
+            const std::string ResourceSettings::matrixThreadsOptionName = "matrix-threads";
 
             ResourceSettings::ResourceSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, timeoutOptionName, false, "If given, computation will abort after the timeout has been reached.").setIsAdvanced().setShortName(timeoutOptionShortName)
@@ -23,6 +24,8 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, printTimeAndMemoryOptionName, false, "Prints CPU time and memory consumption at the end.").setShortName(printTimeAndMemoryOptionShortName).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, signalWaitingTimeOptionName, false, "Specifies how much time can pass until termination when receiving a termination signal.").setIsAdvanced()
                                         .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("time", "Seconds after which to exit the program.").setDefaultValueUnsignedInteger(3).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, matrixThreadsOptionName, false, "Sets the number of threads used to transpose sparse matrices and to extract submatrices from them.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads.").setDefaultValueUnsignedInteger(1).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterEqualValidator(1)).build()).build());
             }
             
             bool ResourceSettings::isTimeoutSet() const {
@@ -40,6 +43,10 @@ namespace storm {
             uint_fast64_t ResourceSettings::getSignalWaitingTimeInSeconds() const {
                 return this->getOption(signalWaitingTimeOptionName).getArgumentByName("time").getValueAsUnsignedInteger();
             }
+            
+            uint_fast64_t ResourceSettings::getNumberOfMatrixThreads() const {
+                return this->getOption(matrixThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
 
         }
     }
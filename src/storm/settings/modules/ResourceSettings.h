@@ -47,6 +47,13 @@ namespace storm {
                  * @return The number of seconds after which to exit the program.
                  */
                 uint_fast64_t getSignalWaitingTimeInSeconds() const;
+                
+                /*!
+                 * Retrieves the number of threads used to transpose sparse matrices and to extract submatrices from them.
+                 *
+                 * @return The number of threads.
+                 */
+                uint_fast64_t getNumberOfMatrixThreads() const;
 
                 // The name of the module.
                 static const std::string moduleName;
@@ -58,6 +65,7 @@ namespace storm {
                 static const std::string printTimeAndMemoryOptionName;
                 static const std::string printTimeAndMemoryOptionShortName;
                 static const std::string signalWaitingTimeOptionName;
+                static const std::string matrixThreadsOptionName;
             };
         }
     }
@@ -16,6 +16,7 @@ namespace storm {
             const std::string TimeBoundedSolverSettings::precisionOptionName = "precision";
             const std::string TimeBoundedSolverSettings::absoluteOptionName = "absolute";
             const std::string TimeBoundedSolverSettings::unifPlusKappaOptionName = "kappa";
+            const std::string TimeBoundedSolverSettings::steadyStateDetectionOptionName = "ssdetect";
             
             TimeBoundedSolverSettings::TimeBoundedSolverSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> maMethods = {"imca", "unifplus"};
@@ -27,6 +28,7 @@ namespace storm {
 
                 this->addOption(storm::settings::OptionBuilder(moduleName, unifPlusKappaOptionName, false, "Controls which amount of the approximation error is due to truncation.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("kappa", "The factor").setDefaultValueDouble(0.05).addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0)).build()).build());
                 
+                this->addOption(storm::settings::OptionBuilder(moduleName, steadyStateDetectionOptionName, false, "If set, transient analysis via uniformization stops as soon as the remaining iterations can not change the result by more than half of the truncation error.").setIsAdvanced().build());
             }
             
             bool TimeBoundedSolverSettings::isPrecisionSet() const {
@@ -56,6 +58,10 @@ namespace storm {
             double TimeBoundedSolverSettings::getUnifPlusKappa() const {
                 return this->getOption(unifPlusKappaOptionName).getArgumentByName("kappa").getValueAsDouble();
             }
+            
+            bool TimeBoundedSolverSettings::isSteadyStateDetectionSet() const {
+                return this->getOption(steadyStateDetectionOptionName).getHasOptionBeenSet();
+            }
 
         }
     }
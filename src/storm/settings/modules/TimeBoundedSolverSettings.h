@@ -51,6 +51,11 @@ namespace storm {
                  */
                 double getUnifPlusKappa() const;
                 
+                /*!
+                 * Retrieves whether steady-state detection is enabled for transient analysis.
+                 */
+                bool isSteadyStateDetectionSet() const;
+                
                 // The name of the module.
                 static const std::string moduleName;
                 
@@ -59,6 +64,7 @@ namespace storm {
                 static const std::string precisionOptionName;
                 static const std::string absoluteOptionName;
                 static const std::string unifPlusKappaOptionName;
+                static const std::string steadyStateDetectionOptionName;
             };
             
         }
@@ -91,6 +91,20 @@ namespace storm {
             return result;
         }
 
+        template<typename ValueType>
+        bool IterativeMinMaxLinearEquationSolver<ValueType>::internalSolveMultipleEquations(Environment const& env, OptimizationDirection dir, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const {
+            // Only plain value iteration processes all right-hand sides simultaneously. Initial schedulers, custom
+            // termination conditions and tracked schedulers refer to a single equation system, so we have to solve the
+            // systems separately in these cases.
+            bool solveSimultaneously = x.size() > 1 && !this->hasInitialScheduler() && !this->hasCustomTerminationCondition() && !this->isTrackSchedulerSet();
+            solveSimultaneously &= getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact()) == MinMaxMethod::ValueIteration;
+            solveSimultaneously &= env.solver().minMax().getMultiplicationStyle() == storm::solver::MultiplicationStyle::Regular;
+            if (solveSimultaneously) {
+                return solveMultipleEquationsValueIteration(env, dir, x, b);
+            }
+            return StandardMinMaxLinearEquationSolver<ValueType>::internalSolveMultipleEquations(env, dir, x, b);
+        }
+        
         template<typename ValueType>
         bool IterativeMinMaxLinearEquationSolver<ValueType>::solveInducedEquationSystem(Environment const& env, std::unique_ptr<LinearEquationSolver<ValueType>>& linearEquationSolver, std::vector<uint64_t> const& scheduler, std::vector<ValueType>& x, std::vector<ValueType>& subB, std::vector<ValueType> const& originalB) const {
             assert(subB.size() == x.size());
@@ -504,6 +518,67 @@ namespace storm {
             return result.status == SolverStatus::Converged || result.status == SolverStatus::TerminatedEarly;
         }
         
+        template<typename ValueType>
+        bool IterativeMinMaxLinearEquationSolver<ValueType>::solveMultipleEquationsValueIteration(Environment const& env, OptimizationDirection dir, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const {
+            uint64_t const blockSize = x.size();
+            if (!this->multiplierA) {
+                this->multiplierA = storm::solver::MultiplierFactory<ValueType>().create(env, *this->A);
+            }
+            
+            // Without a unique solution, we need to start from the appropriate bound (as in the single-vector case).
+            if (!this->hasUniqueSolution()) {
+                for (auto& xj : x) {
+                    if (maximize(dir)) {
+                        this->createLowerBoundsVector(xj);
+                    } else {
+                        this->createUpperBoundsVector(xj);
+                    }
+                }
+            }
+            
+            // Prepare the block vectors in which the entries of all systems belonging to the same row (group) are stored consecutively.
+            std::vector<ValueType> currentXBlock, bBlock;
+            storm::utility::vector::interleaveVectors(x, currentXBlock);
+            storm::utility::vector::interleaveVectors(b, bBlock);
+            std::vector<ValueType> newXBlock(currentXBlock.size());
+            std::vector<ValueType>* currentX = &currentXBlock;
+            std::vector<ValueType>* newX = &newXBlock;
+            
+            ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
+            bool relative = env.solver().minMax().getRelativeTerminationCriterion();
+            uint64_t maximalNumberOfIterations = env.solver().minMax().getMaximalNumberOfIterations();
+            
+            this->startMeasureProgress();
+            uint64_t iterations = 0;
+            SolverStatus status = SolverStatus::InProgress;
+            while (status == SolverStatus::InProgress) {
+                // Compute X' = min/max(A*X + B) for all vectors of the block at once.
+                this->multiplierA->multiplyAndReduceBlock(env, dir, *currentX, &bBlock, *newX, blockSize);
+                
+                // The block converged if all of its systems converged.
+                if (storm::utility::vector::equalModuloPrecision<ValueType>(*currentX, *newX, precision, relative)) {
+                    status = SolverStatus::Converged;
+                }
+                
+                std::swap(currentX, newX);
+                ++iterations;
+                status = this->updateStatus(status, false, iterations, maximalNumberOfIterations);
+                
+                // Potentially show progress.
+                this->showProgressIterative(iterations);
+            }
+            
+            storm::utility::vector::deinterleaveVector(*currentX, x);
+            
+            this->reportStatus(status, iterations);
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
+        }
+        
         template<typename ValueType>
         void preserveOldRelevantValues(std::vector<ValueType> const& allValues, storm::storage::BitVector const& relevantValues, std::vector<ValueType>& oldValues) {
             storm::utility::vector::selectVectorValues(oldValues, relevantValues, allValues);
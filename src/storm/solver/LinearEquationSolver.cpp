@@ -17,6 +17,7 @@
 #include "storm/utility/macros.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
+#include "storm/exceptions/IllegalArgumentException.h"
 
 namespace storm {
     namespace solver {
@@ -31,6 +32,21 @@ namespace storm {
             return this->internalSolveEquations(env, x, b);
         }
         
+        template<typename ValueType>
+        bool LinearEquationSolver<ValueType>::solveEquations(Environment const& env, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const {
+            STORM_LOG_THROW(x.size() == b.size(), storm::exceptions::IllegalArgumentException, "The number of solution vectors (" << x.size() << ") does not match the number of right-hand sides (" << b.size() << ").");
+            return this->internalSolveMultipleEquations(env, x, b);
+        }
+        
+        template<typename ValueType>
+        bool LinearEquationSolver<ValueType>::internalSolveMultipleEquations(Environment const& env, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const {
+            bool result = true;
+            for (uint64_t j = 0; j < x.size(); ++j) {
+                result &= this->internalSolveEquations(env, x[j], b[j]);
+            }
+            return result;
+        }
+        
         template<typename ValueType>
         LinearEquationSolverRequirements LinearEquationSolver<ValueType>::getRequirements(Environment const&) const {
             return LinearEquationSolverRequirements();
@@ -47,6 +47,20 @@ namespace storm {
              * @return true
              */
             bool solveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            
+            /*!
+             * Solves the equation systems for several right-hand sides b_j that share the same matrix A (see the other
+             * variant of <code>solveEquations</code> for the format). Depending on the solution method, the vectors
+             * are solved simultaneously, which means that the matrix is only traversed once per iteration for all of
+             * them. Note that lower and upper bounds that are set for this solver need to be valid for all equation
+             * systems.
+             *
+             * @param x The solution vectors x_j. Their lengths must be equal to the number of rows of A.
+             * @param b The vectors b_j. There must be as many b vectors as solution vectors.
+             *
+             * @return true iff all equation systems could be solved.
+             */
+            bool solveEquations(Environment const& env, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const;
 
             /*!
              * Retrieves the format in which this solver expects to solve equations. If the solver expects the equation
@@ -78,6 +92,12 @@ namespace storm {
             
         protected:
             virtual bool internalSolveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const = 0;
+            
+            /*!
+             * Solves the equation systems for several right-hand sides. By default, the equation systems are solved
+             * one after another. Solvers that can handle several right-hand sides simultaneously may override this.
+             */
+            virtual bool internalSolveMultipleEquations(Environment const& env, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const;
                         
             // auxiliary storage. If set, this vector has getMatrixRowCount() entries.
             mutable std::unique_ptr<std::vector<ValueType>> cachedRowVector;
@@ -15,6 +15,7 @@
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/exceptions/InvalidSettingsException.h"
 #include "storm/exceptions/IllegalFunctionCallException.h"
+#include "storm/exceptions/IllegalArgumentException.h"
 
 namespace storm {
     namespace solver {
@@ -41,6 +42,22 @@ namespace storm {
             solveEquations(env, convert(this->direction), x, b);
         }
 
+        template<typename ValueType>
+        bool MinMaxLinearEquationSolver<ValueType>::solveEquations(Environment const& env, OptimizationDirection d, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const {
+            STORM_LOG_WARN_COND_DEBUG(this->isRequirementsCheckedSet(), "The requirements of the solver have not been marked as checked. Please provide the appropriate check or mark the requirements as checked (if applicable).");
+            STORM_LOG_THROW(x.size() == b.size(), storm::exceptions::IllegalArgumentException, "The number of solution vectors (" << x.size() << ") does not match the number of right-hand sides (" << b.size() << ").");
+            return internalSolveMultipleEquations(env, d, x, b);
+        }
+        
+        template<typename ValueType>
+        bool MinMaxLinearEquationSolver<ValueType>::internalSolveMultipleEquations(Environment const& env, OptimizationDirection d, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const {
+            bool result = true;
+            for (uint64_t j = 0; j < x.size(); ++j) {
+                result &= internalSolveEquations(env, d, x[j], b[j]);
+            }
+            return result;
+        }
+        
         template<typename ValueType>
         void MinMaxLinearEquationSolver<ValueType>::setOptimizationDirection(OptimizationDirection d) {
             direction = convert(d);
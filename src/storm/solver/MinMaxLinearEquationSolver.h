@@ -60,6 +60,22 @@ namespace storm {
              */
             void solveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             
+            /*!
+             * Solves the equation systems x_j = min/max(A*x_j + b_j) for several right-hand sides b_j that share the
+             * same matrix A. Depending on the solution method, the vectors are solved simultaneously, which means that
+             * the matrix is only traversed once per iteration for all of them.
+             * Note that lower and upper bounds that are set for this solver need to be valid for all equation systems.
+             * If a scheduler is tracked, the stored scheduler refers to the last equation system.
+             *
+             * @param d The optimization direction.
+             * @param x The solution vectors x_j. The initial values represent a guess of the real values to the
+             * solver, but may be ignored.
+             * @param b The vectors b_j to add after matrix-vector multiplication. There must be as many b vectors as
+             * solution vectors.
+             * @return True iff all equation systems could be solved.
+             */
+            bool solveEquations(Environment const& env, OptimizationDirection d, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const;
+            
             /*!
              * Sets an optimization direction to use for calls to methods that do not explicitly provide one.
              */
@@ -183,6 +199,12 @@ namespace storm {
             
         protected:
             virtual bool internalSolveEquations(Environment const& env, OptimizationDirection d, std::vector<ValueType>& x, std::vector<ValueType> const& b) const = 0;
+            
+            /*!
+             * Solves the equation systems for several right-hand sides. By default, the equation systems are solved
+             * one after another. Solvers that can handle several right-hand sides simultaneously may override this.
+             */
+            virtual bool internalSolveMultipleEquations(Environment const& env, OptimizationDirection d, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const;
                         
             /// The optimization direction to use for calls to functions that do not provide it explicitly. Can also be unset.
             OptimizationDirectionSetting direction;
@@ -8,6 +8,7 @@
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/solver/NativeMultiplier.h"
 #include "storm/solver/GmmxxMultiplier.h"
@@ -39,6 +40,43 @@ namespace storm {
             multiplyAndReduceGaussSeidel(env, dir, this->matrix.getRowGroupIndices(), x, b, choices, backwards);
         }
     
+        template<typename ValueType>
+        void Multiplier<ValueType>::multiplyBlock(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, uint64_t blockSize) const {
+            // By default, we split the block into its vectors and multiply them one after another.
+            std::vector<std::vector<ValueType>> xVectors(blockSize);
+            storm::utility::vector::deinterleaveVector(x, xVectors);
+            std::vector<std::vector<ValueType>> bVectors(b ? blockSize : 0);
+            if (b) {
+                storm::utility::vector::deinterleaveVector(*b, bVectors);
+            }
+            std::vector<std::vector<ValueType>> resultVectors(blockSize, std::vector<ValueType>(this->matrix.getRowCount()));
+            for (uint64_t j = 0; j < blockSize; ++j) {
+                multiply(env, xVectors[j], b ? &bVectors[j] : nullptr, resultVectors[j]);
+            }
+            storm::utility::vector::interleaveVectors(resultVectors, result);
+        }
+        
+        template<typename ValueType>
+        void Multiplier<ValueType>::multiplyAndReduceBlock(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, uint64_t blockSize) const {
+            multiplyAndReduceBlock(env, dir, this->matrix.getRowGroupIndices(), x, b, result, blockSize);
+        }
+        
+        template<typename ValueType>
+        void Multiplier<ValueType>::multiplyAndReduceBlock(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, uint64_t blockSize) const {
+            // By default, we split the block into its vectors and multiply them one after another.
+            std::vector<std::vector<ValueType>> xVectors(blockSize);
+            storm::utility::vector::deinterleaveVector(x, xVectors);
+            std::vector<std::vector<ValueType>> bVectors(b ? blockSize : 0);
+            if (b) {
+                storm::utility::vector::deinterleaveVector(*b, bVectors);
+            }
+            std::vector<std::vector<ValueType>> resultVectors(blockSize, std::vector<ValueType>(rowGroupIndices.size() - 1));
+            for (uint64_t j = 0; j < blockSize; ++j) {
+                multiplyAndReduce(env, dir, rowGroupIndices, xVectors[j], b ? &bVectors[j] : nullptr, resultVectors[j]);
+            }
+            storm::utility::vector::interleaveVectors(resultVectors, result);
+        }
+    
         template<typename ValueType>
         void Multiplier<ValueType>::repeatedMultiply(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, uint64_t n) const {
             storm::utility::ProgressMeasurement progress("multiplications");
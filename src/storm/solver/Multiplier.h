@@ -88,6 +88,39 @@ namespace storm {
             void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr, bool backwards = true) const;
             virtual void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr, bool backwards = true) const = 0;
             
+            /*!
+             * Performs a matrix-block multiplication X' = A*X + B, where X and B consist of several vectors that are
+             * stored in a single block vector. The entries of all vectors belonging to the same index are stored
+             * consecutively, i.e., the i-th entry of the j-th vector is stored at position i * blockSize + j (see
+             * storm::utility::vector::interleaveVectors). Compared to multiplying the vectors one after another, the
+             * matrix only has to be traversed once.
+             *
+             * @param x The input block vector with which to multiply the matrix. Its length must be equal to the number
+             * of columns of A times the block size.
+             * @param b If non-null, this block vector is added after the multiplication. If given, its length must be
+             * equal to the number of rows of A times the block size.
+             * @param result The target block vector into which to write the multiplication result. Its length must be
+             * equal to the number of rows of A times the block size. Can be the same as the x vector.
+             * @param blockSize The number of vectors stored in the block vectors.
+             */
+            virtual void multiplyBlock(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, uint64_t blockSize) const;
+            
+            /*!
+             * Performs a matrix-block multiplication X' = A*X + B (see multiplyBlock) and then minimizes/maximizes over
+             * the row groups for each of the vectors independently, so that the resulting block vector has the size of
+             * the number of row groups of A times the block size.
+             *
+             * @param dir The direction for the reduction step.
+             * @param rowGroupIndices A vector storing the row groups over which to reduce.
+             * @param x The input block vector with which to multiply the matrix.
+             * @param b If non-null, this block vector is added after the multiplication.
+             * @param result The target block vector into which to write the multiplication result. Can be the same as
+             * the x vector.
+             * @param blockSize The number of vectors stored in the block vectors.
+             */
+            void multiplyAndReduceBlock(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, uint64_t blockSize) const;
+            virtual void multiplyAndReduceBlock(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, uint64_t blockSize) const;
+            
             /*!
              * Performs repeated matrix-vector multiplication, using x[0] = x and x[i + 1] = A*x[i] + b. After
              * performing the necessary multiplications, the result is written to the input vector x. Note that the
@@ -385,6 +385,58 @@ namespace storm {
             return result.status == SolverStatus::Converged || result.status == SolverStatus::TerminatedEarly;
         }
         
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::solveMultipleEquationsPower(Environment const& env, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const {
+            uint64_t const blockSize = x.size();
+            STORM_LOG_INFO("Solving " << blockSize << " linear equation systems (" << getMatrixRowCount() << " rows) with NativeLinearEquationSolver (Power)");
+            
+            if (!this->multiplier) {
+                this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *A);
+            }
+            
+            // Prepare the block vectors in which the entries of all systems belonging to the same row are stored consecutively.
+            std::vector<ValueType> currentXBlock, bBlock;
+            storm::utility::vector::interleaveVectors(x, currentXBlock);
+            storm::utility::vector::interleaveVectors(b, bBlock);
+            std::vector<ValueType> newXBlock(currentXBlock.size());
+            std::vector<ValueType>* currentX = &currentXBlock;
+            std::vector<ValueType>* newX = &newXBlock;
+            
+            ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
+            bool relative = env.solver().native().getRelativeTerminationCriterion();
+            uint64_t maxIterations = env.solver().native().getMaximalNumberOfIterations();
+            
+            this->startMeasureProgress();
+            uint64_t iterations = 0;
+            SolverStatus status = SolverStatus::InProgress;
+            while (status == SolverStatus::InProgress && iterations < maxIterations) {
+                this->multiplier->multiplyBlock(env, *currentX, &bBlock, *newX, blockSize);
+                
+                // The block converged if all of its systems converged.
+                if (storm::utility::vector::equalModuloPrecision<ValueType>(*currentX, *newX, precision, relative)) {
+                    status = SolverStatus::Converged;
+                }
+                
+                std::swap(currentX, newX);
+                ++iterations;
+                
+                status = this->updateStatus(status, false, iterations, maxIterations);
+                
+                // Potentially show progress.
+                this->showProgressIterative(iterations);
+            }
+            
+            storm::utility::vector::deinterleaveVector(*currentX, x);
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            this->logIterations(status == SolverStatus::Converged, status == SolverStatus::TerminatedEarly, iterations);
+            
+            return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
+        }
+        
         template<typename ValueType>
         void preserveOldRelevantValues(std::vector<ValueType> const& allValues, storm::storage::BitVector const& relevantValues, std::vector<ValueType>& oldValues) {
             storm::utility::vector::selectVectorValues(oldValues, relevantValues, allValues);
@@ -999,6 +1051,19 @@ namespace storm {
             return false;
         }
         
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::internalSolveMultipleEquations(Environment const& env, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const {
+            // Only the power method with regular multiplications processes all right-hand sides simultaneously.
+            // Custom termination conditions refer to a single solution vector, so we have to solve the systems separately then.
+            bool solveSimultaneously = x.size() > 1 && !this->hasCustomTerminationCondition();
+            solveSimultaneously &= getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact()) == NativeLinearEquationSolverMethod::Power;
+            solveSimultaneously &= env.solver().native().getPowerMethodMultiplicationStyle() == storm::solver::MultiplicationStyle::Regular;
+            if (solveSimultaneously) {
+                return this->solveMultipleEquationsPower(env, x, b);
+            }
+            return LinearEquationSolver<ValueType>::internalSolveMultipleEquations(env, x, b);
+        }
+        
         template<typename ValueType>
         LinearEquationSolverProblemFormat NativeLinearEquationSolver<ValueType>::getEquationProblemFormat(Environment const& env) const {
             auto method = getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact());
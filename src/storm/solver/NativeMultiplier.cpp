@@ -91,6 +91,40 @@ namespace storm {
             }
         }
         
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::multiplyBlock(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, uint64_t blockSize) const {
+            std::vector<ValueType>* target = &result;
+            if (&x == &result) {
+                if (this->cachedVector) {
+                    this->cachedVector->resize(this->matrix.getRowCount() * blockSize);
+                } else {
+                    this->cachedVector = std::make_unique<std::vector<ValueType>>(this->matrix.getRowCount() * blockSize);
+                }
+                target = this->cachedVector.get();
+            }
+            this->matrix.multiplyWithBlockVector(x, *target, b, blockSize);
+            if (&x == &result) {
+                std::swap(result, *this->cachedVector);
+            }
+        }
+        
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::multiplyAndReduceBlock(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, uint64_t blockSize) const {
+            std::vector<ValueType>* target = &result;
+            if (&x == &result) {
+                if (this->cachedVector) {
+                    this->cachedVector->resize((rowGroupIndices.size() - 1) * blockSize);
+                } else {
+                    this->cachedVector = std::make_unique<std::vector<ValueType>>((rowGroupIndices.size() - 1) * blockSize);
+                }
+                target = this->cachedVector.get();
+            }
+            this->matrix.multiplyAndReduceBlockVector(dir, rowGroupIndices, x, b, *target, blockSize);
+            if (&x == &result) {
+                std::swap(result, *this->cachedVector);
+            }
+        }
+        
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const {
             for (auto const& entry : this->matrix.getRow(rowIndex)) {
@@ -8,6 +8,7 @@
 #include "storm/utility/constants.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/utility/dd.h"
 #include "storm/utility/macros.h"
@@ -70,7 +71,7 @@ namespace storm {
         }
         
         template<storm::dd::DdType DdType, typename ValueType>
-        typename SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::ValueIterationResult SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::performValueIteration(storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations) const {
+        typename SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::ValueIterationResult SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::performValueIteration(storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations, helper::SymbolicRoundingHelper<DdType, ValueType>* roundingHelper) const {
 
             // Set up local variables.
             storm::dd::Add<DdType, ValueType> localX = x;
@@ -94,6 +95,9 @@ namespace storm {
                 // Now check if the process already converged within our precision.
                 if (localX.equalModuloPrecision(tmp, precision, relativeTerminationCriterion)) {
                     status = SolverStatus::Converged;
+                } else if (roundingHelper) {
+                    // Only round values that are iterated further, such that rounding cannot cause the convergence.
+                    roundingHelper->process(iterations + 1, tmp);
                 }
 
                 // Set up next iteration.
@@ -280,7 +284,9 @@ namespace storm {
             }
             
             ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
-            ValueIterationResult viResult = performValueIteration(dir, localX, b, precision, env.solver().minMax().getRelativeTerminationCriterion(), env.solver().minMax().getMaximalNumberOfIterations());
+            helper::SymbolicRoundingHelper<DdType, ValueType> roundingHelper(env, precision, env.solver().minMax().getRelativeTerminationCriterion());
+            ValueIterationResult viResult = performValueIteration(dir, localX, b, precision, env.solver().minMax().getRelativeTerminationCriterion(), env.solver().minMax().getMaximalNumberOfIterations(), &roundingHelper);
+            roundingHelper.logSummary();
             
             if (viResult.status == SolverStatus::Converged) {
                 STORM_LOG_INFO("Iterative solver (value iteration) converged in " << viResult.iterations << " iterations.");
@@ -11,6 +11,7 @@
 #include "storm/solver/SymbolicLinearEquationSolver.h"
 #include "storm/solver/MinMaxLinearEquationSolverRequirements.h"
 #include "storm/solver/SolverStatus.h"
+#include "storm/solver/helper/SymbolicRoundingHelper.h"
 
 #include "storm/utility/NumberTraits.h"
 
@@ -167,7 +168,7 @@ namespace storm {
                 storm::dd::Add<DdType, ValueType> values;
             };
             
-            ValueIterationResult performValueIteration(storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations) const;
+            ValueIterationResult performValueIteration(storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations, helper::SymbolicRoundingHelper<DdType, ValueType>* roundingHelper = nullptr) const;
             
         protected:
             // The matrix defining the coefficients of the linear equation system.
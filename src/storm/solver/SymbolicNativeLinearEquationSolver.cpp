@@ -1,6 +1,7 @@
 #include "storm/solver/SymbolicNativeLinearEquationSolver.h"
 
 #include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/PrecisionExceededException.h"
 #include "storm/storage/dd/DdManager.h"
@@ -118,7 +119,7 @@ namespace storm {
         }
         
         template<storm::dd::DdType DdType, typename ValueType>
-        typename SymbolicNativeLinearEquationSolver<DdType, ValueType>::PowerIterationResult SymbolicNativeLinearEquationSolver<DdType, ValueType>::performPowerIteration(storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations) const {
+        typename SymbolicNativeLinearEquationSolver<DdType, ValueType>::PowerIterationResult SymbolicNativeLinearEquationSolver<DdType, ValueType>::performPowerIteration(storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations, helper::SymbolicRoundingHelper<DdType, ValueType>* roundingHelper) const {
             
             // Set up additional environment variables.
             storm::dd::Add<DdType, ValueType> currentX = x;
@@ -132,6 +133,9 @@ namespace storm {
                 // Now check if the process already converged within our precision.
                 if (tmp.equalModuloPrecision(currentX, precision, relativeTerminationCriterion)) {
                     status = SolverStatus::Converged;
+                } else if (roundingHelper) {
+                    // Only round values that are iterated further, such that rounding cannot cause the convergence.
+                    roundingHelper->process(iterations + 1, tmp);
                 }
                 
                 // Set up next iteration.
@@ -146,7 +150,9 @@ namespace storm {
         storm::dd::Add<DdType, ValueType> SymbolicNativeLinearEquationSolver<DdType, ValueType>::solveEquationsPower(Environment const& env, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b) const {
             STORM_LOG_INFO("Solving symbolic linear equation system with NativeLinearEquationSolver (power)");
             ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
-            PowerIterationResult result = performPowerIteration(x, b, precision, env.solver().native().getRelativeTerminationCriterion(), env.solver().native().getMaximalNumberOfIterations());
+            helper::SymbolicRoundingHelper<DdType, ValueType> roundingHelper(env, precision, env.solver().native().getRelativeTerminationCriterion());
+            PowerIterationResult result = performPowerIteration(x, b, precision, env.solver().native().getRelativeTerminationCriterion(), env.solver().native().getMaximalNumberOfIterations(), &roundingHelper);
+            roundingHelper.logSummary();
             
             if (result.status == SolverStatus::Converged) {
                 STORM_LOG_INFO("Iterative solver (power iteration) converged in " << result.iterations << " iterations.");
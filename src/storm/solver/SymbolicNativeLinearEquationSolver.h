@@ -3,6 +3,7 @@
 #include "storm/solver/SymbolicLinearEquationSolver.h"
 #include "storm/solver/SolverStatus.h"
 #include "storm/solver/SolverSelectionOptions.h"
+#include "storm/solver/helper/SymbolicRoundingHelper.h"
 
 #include "storm/utility/NumberTraits.h"
 
@@ -101,7 +102,7 @@ namespace storm {
                 storm::dd::Add<DdType, ValueType> values;
             };
             
-            PowerIterationResult performPowerIteration(storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations) const;
+            PowerIterationResult performPowerIteration(storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations, helper::SymbolicRoundingHelper<DdType, ValueType>* roundingHelper = nullptr) const;
 
         };
         
@@ -0,0 +1,105 @@
+#include "storm/solver/helper/SymbolicRoundingHelper.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/storage/dd/Add.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/dd.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/NumberTraits.h"
+
+namespace storm {
+    namespace solver {
+        namespace helper {
+
+            template<storm::dd::DdType DdType, typename ValueType>
+            SymbolicRoundingHelper<DdType, ValueType>::SymbolicRoundingHelper(Environment const& env, ValueType const& maximalError, bool relativeTerminationCriterion) : enabled(false), precision(storm::utility::zero<ValueType>()), interval(env.solver().getDdRoundingInterval()), maximalError(maximalError), accumulatedError(storm::utility::zero<ValueType>()), numberOfRoundings(0), maximalNodeCount(0) {
+                if (env.solver().isDdRoundingSet()) {
+                    if (storm::NumberTraits<ValueType>::IsExact) {
+                        STORM_LOG_WARN("Rounding of decision diagrams is ignored for exact values.");
+                    } else if (relativeTerminationCriterion) {
+                        STORM_LOG_WARN("Rounding of decision diagrams is ignored as the solver uses a relative termination criterion. Consider using an absolute one.");
+                    } else {
+                        // Every rounding deviates by at most half of the precision. Lower the precision such that
+                        // sufficiently many roundings fit into the error bound.
+                        double givenPrecision = storm::utility::convertNumber<double>(env.solver().getDdRoundingPrecision());
+                        double precisionForErrorBound = 2.0 * storm::utility::convertNumber<double>(maximalError) / minimalNumberOfRoundings;
+                        if (precisionForErrorBound < givenPrecision) {
+                            STORM_LOG_INFO("Lowering the precision for rounding decision diagrams from " << givenPrecision << " to " << precisionForErrorBound << " to respect the precision of the solver.");
+                            givenPrecision = precisionForErrorBound;
+                        }
+                        
+                        if (givenPrecision > 0.0) {
+                            // Round to a power of two, such that the rounding itself does not introduce further errors.
+                            precision = storm::utility::convertNumber<ValueType>(std::exp2(std::floor(std::log2(givenPrecision))));
+                            enabled = true;
+                            STORM_LOG_INFO("Rounding values of decision diagrams to multiples of " << precision << " every " << interval << " iterations.");
+                        }
+                    }
+                }
+            }
+
+            template<storm::dd::DdType DdType, typename ValueType>
+            void SymbolicRoundingHelper<DdType, ValueType>::process(uint64_t iteration, storm::dd::Add<DdType, ValueType>& values) {
+                if (!enabled) {
+                    STORM_LOG_TRACE("Values of iteration " << iteration << " have " << values.getNodeCount() << " nodes.");
+                    return;
+                }
+
+                if (iteration % interval == 0) {
+                    ValueType deviation;
+                    storm::dd::Add<DdType, ValueType> roundedValues = storm::utility::dd::roundToPrecision(values, precision, deviation);
+                    if (accumulatedError + deviation <= maximalError) {
+                        values = roundedValues;
+                        accumulatedError += deviation;
+                        ++numberOfRoundings;
+                    } else {
+                        STORM_LOG_INFO("Stopped rounding values of decision diagrams after " << iteration << " iterations as the rounding error would exceed " << maximalError << ".");
+                        enabled = false;
+                    }
+                }
+
+                uint64_t nodeCount = values.getNodeCount();
+                maximalNodeCount = std::max(maximalNodeCount, nodeCount);
+                STORM_LOG_TRACE("Values of iteration " << iteration << " have " << nodeCount << " nodes (accumulated rounding error " << accumulatedError << ").");
+            }
+
+            template<storm::dd::DdType DdType, typename ValueType>
+            bool SymbolicRoundingHelper<DdType, ValueType>::isEnabled() const {
+                return enabled;
+            }
+
+            template<storm::dd::DdType DdType, typename ValueType>
+            ValueType const& SymbolicRoundingHelper<DdType, ValueType>::getPrecision() const {
+                return precision;
+            }
+
+            template<storm::dd::DdType DdType, typename ValueType>
+            uint64_t SymbolicRoundingHelper<DdType, ValueType>::getNumberOfRoundings() const {
+                return numberOfRoundings;
+            }
+
+            template<storm::dd::DdType DdType, typename ValueType>
+            ValueType const& SymbolicRoundingHelper<DdType, ValueType>::getAccumulatedError() const {
+                return accumulatedError;
+            }
+
+            template<storm::dd::DdType DdType, typename ValueType>
+            void SymbolicRoundingHelper<DdType, ValueType>::logSummary() const {
+                if (numberOfRoundings > 0) {
+                    STORM_LOG_INFO("Rounded values of decision diagrams " << numberOfRoundings << " times with an accumulated error of at most " << accumulatedError << ". The values had at most " << maximalNodeCount << " nodes.");
+                }
+            }
+
+            template class SymbolicRoundingHelper<storm::dd::DdType::CUDD, double>;
+            template class SymbolicRoundingHelper<storm::dd::DdType::Sylvan, double>;
+
+#ifdef STORM_HAVE_CARL
+            template class SymbolicRoundingHelper<storm::dd::DdType::CUDD, storm::RationalNumber>;
+            template class SymbolicRoundingHelper<storm::dd::DdType::Sylvan, storm::RationalNumber>;
+#endif
+        }
+    }
+}
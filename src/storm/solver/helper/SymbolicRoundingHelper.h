@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstdint>
+
+#include "storm/storage/dd/DdType.h"
+
+namespace storm {
+
+    class Environment;
+
+    namespace dd {
+        template<storm::dd::DdType Type, typename ValueType>
+        class Add;
+    }
+
+    namespace solver {
+        namespace helper {
+
+            /*!
+             * Keeps the ADDs of symbolic iterative solvers small by periodically rounding their values (if enabled in
+             * the environment). The rounding stops as soon as the accumulated rounding error would exceed the given
+             * bound. Since the iteration operators of value and power iteration do not increase the distance of two
+             * vectors, the final values deviate by at most the accumulated rounding error from the values obtained
+             * without rounding.
+             *
+             * As this only bounds the absolute error, rounding is disabled for solvers using a relative termination
+             * criterion: rounding small values to zero would introduce a relative error of one.
+             */
+            template<storm::dd::DdType DdType, typename ValueType>
+            class SymbolicRoundingHelper {
+            public:
+
+                /*!
+                 * Creates a new helper.
+                 *
+                 * @param env The environment specifying the rounding precision and interval.
+                 * @param maximalError The bound on the accumulated (absolute) rounding error.
+                 * @param relativeTerminationCriterion Whether the solver uses a relative termination criterion. If so,
+                 * rounding is disabled.
+                 */
+                SymbolicRoundingHelper(Environment const& env, ValueType const& maximalError, bool relativeTerminationCriterion);
+
+                /*!
+                 * Rounds the given values if this is due in the given iteration and reports the number of nodes. Values
+                 * must only be rounded after the convergence check, such that rounding cannot cause convergence.
+                 *
+                 * @param iteration The number of the current iteration.
+                 * @param values The values of the current iteration. They are replaced by the rounded values.
+                 */
+                void process(uint64_t iteration, storm::dd::Add<DdType, ValueType>& values);
+
+                /*!
+                 * Retrieves whether rounding is enabled.
+                 */
+                bool isEnabled() const;
+
+                /*!
+                 * Retrieves the precision the values are rounded to.
+                 */
+                ValueType const& getPrecision() const;
+
+                /*!
+                 * Retrieves the number of times the values were rounded.
+                 */
+                uint64_t getNumberOfRoundings() const;
+
+                /*!
+                 * Retrieves the accumulated rounding error.
+                 */
+                ValueType const& getAccumulatedError() const;
+
+                /*!
+                 * Reports the accumulated rounding error and the node counts (if rounding is enabled).
+                 */
+                void logSummary() const;
+
+            private:
+                // Whether rounding is enabled.
+                bool enabled;
+
+                // The minimal number of roundings that need to fit into the error bound. The precision is lowered
+                // accordingly, as otherwise the first rounding would already exceed the bound.
+                static const uint64_t minimalNumberOfRoundings = 16;
+
+                // The precision to round to. This is a power of two, such that the rounding itself is exact.
+                ValueType precision;
+
+                // The number of iterations after which the values are rounded.
+                uint64_t interval;
+
+                // The bound on the accumulated rounding error.
+                ValueType maximalError;
+
+                // The accumulated rounding error.
+                ValueType accumulatedError;
+
+                // The number of times the values were rounded.
+                uint64_t numberOfRoundings;
+
+                // The maximal number of nodes of the processed values.
+                uint64_t maximalNodeCount;
+            };
+        }
+    }
+}
@@ -0,0 +1,101 @@
+#include "storm/solver/stateelimination/ArithmeticCache.h"
+
+#include <boost/functional/hash.hpp>
+
+#include "storm/utility/constants.h"
+
+namespace storm {
+    namespace solver {
+        namespace stateelimination {
+            
+            template<typename ValueType>
+            ArithmeticCache<ValueType>::ArithmeticCache(uint64_t) {
+                // Intentionally left empty.
+            }
+            
+            template<typename ValueType>
+            ValueType ArithmeticCache<ValueType>::multiply(ValueType const& factor1, ValueType const& factor2) {
+                return storm::utility::simplify((ValueType) (factor1 * factor2));
+            }
+            
+            template<typename ValueType>
+            ValueType ArithmeticCache<ValueType>::add(ValueType const& summand1, ValueType const& summand2) {
+                return storm::utility::simplify((ValueType) (summand1 + summand2));
+            }
+            
+            template<typename ValueType>
+            uint64_t ArithmeticCache<ValueType>::getNumberOfHits() const {
+                return 0;
+            }
+            
+            template<typename ValueType>
+            uint64_t ArithmeticCache<ValueType>::getNumberOfMisses() const {
+                return 0;
+            }
+            
+            template class ArithmeticCache<double>;
+            
+#ifdef STORM_HAVE_CARL
+            template class ArithmeticCache<storm::RationalNumber>;
+            
+            std::size_t ArithmeticCache<storm::RationalFunction>::OperandsHash::operator()(OperandsType const& operands) const {
+                std::size_t seed = 0;
+                boost::hash_combine(seed, operands.first);
+                boost::hash_combine(seed, operands.second);
+                return seed;
+            }
+            
+            ArithmeticCache<storm::RationalFunction>::ArithmeticCache(uint64_t maximalSize) : maximalSize(maximalSize), hits(0), misses(0) {
+                // Intentionally left empty.
+            }
+            
+            template<typename OperationType>
+            storm::RationalFunction ArithmeticCache<storm::RationalFunction>::getOrCompute(ResultMapType& results, storm::RationalFunction const& operand1, storm::RationalFunction const& operand2, OperationType const& operation) {
+                std::hash<storm::RationalFunction> hasher;
+                OperandsType operands = hasher(operand1) <= hasher(operand2) ? std::make_pair(operand1, operand2) : std::make_pair(operand2, operand1);
+                
+                auto findIt = results.find(operands);
+                if (findIt != results.end()) {
+                    ++hits;
+                    return findIt->second;
+                }
+                
+                ++misses;
+                storm::RationalFunction result = operation(operands.first, operands.second);
+                if (maximalSize > 0 && results.size() >= maximalSize) {
+                    results.clear();
+                }
+                results.emplace(std::move(operands), result);
+                return result;
+            }
+            
+            storm::RationalFunction ArithmeticCache<storm::RationalFunction>::multiply(storm::RationalFunction const& factor1, storm::RationalFunction const& factor2) {
+                // Products with constants are cheap, so there is no need to store them.
+                if (factor1.isConstant() || factor2.isConstant()) {
+                    return storm::utility::simplify((storm::RationalFunction) (factor1 * factor2));
+                }
+                return getOrCompute(products, factor1, factor2, [] (storm::RationalFunction const& first, storm::RationalFunction const& second) { return storm::utility::simplify((storm::RationalFunction) (first * second)); });
+            }
+            
+            storm::RationalFunction ArithmeticCache<storm::RationalFunction>::add(storm::RationalFunction const& summand1, storm::RationalFunction const& summand2) {
+                if (storm::utility::isZero(summand1)) {
+                    return summand2;
+                } else if (storm::utility::isZero(summand2)) {
+                    return summand1;
+                } else if (summand1.isConstant() && summand2.isConstant()) {
+                    return storm::utility::simplify((storm::RationalFunction) (summand1 + summand2));
+                }
+                return getOrCompute(sums, summand1, summand2, [] (storm::RationalFunction const& first, storm::RationalFunction const& second) { return storm::utility::simplify((storm::RationalFunction) (first + second)); });
+            }
+            
+            uint64_t ArithmeticCache<storm::RationalFunction>::getNumberOfHits() const {
+                return hits;
+            }
+            
+            uint64_t ArithmeticCache<storm::RationalFunction>::getNumberOfMisses() const {
+                return misses;
+            }
+#endif
+        }
+    }
+}
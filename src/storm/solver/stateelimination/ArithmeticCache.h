@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+namespace storm {
+    namespace solver {
+        namespace stateelimination {
+            
+            /*!
+             * Performs the arithmetic operations of state elimination. For most value types, the operations are simply
+             * carried out. See the specialization for rational functions.
+             */
+            template<typename ValueType>
+            class ArithmeticCache {
+            public:
+                ArithmeticCache(uint64_t maximalSize = 0);
+                
+                /*!
+                 * Computes the (simplified) product of the given values.
+                 */
+                ValueType multiply(ValueType const& factor1, ValueType const& factor2);
+                
+                /*!
+                 * Computes the (simplified) sum of the given values.
+                 */
+                ValueType add(ValueType const& summand1, ValueType const& summand2);
+                
+                /*!
+                 * Retrieves the number of operations whose result was already known. As nothing is stored, this is zero.
+                 */
+                uint64_t getNumberOfHits() const;
+                
+                /*!
+                 * Retrieves the number of operations that had to be computed. As nothing is stored, this is zero.
+                 */
+                uint64_t getNumberOfMisses() const;
+            };
+            
+#ifdef STORM_HAVE_CARL
+            /*!
+             * For rational functions, every operation needs an expensive cancellation of common factors. As models often
+             * have many structurally similar transitions, the same operations are performed over and over again. Hence,
+             * the results of products and sums are memoised. The polynomials themselves are already shared via the
+             * polynomial cache, so the stored operands and results only hold references to them.
+             */
+            template<>
+            class ArithmeticCache<storm::RationalFunction> {
+            public:
+                /*!
+                 * Creates a cache.
+                 *
+                 * @param maximalSize The maximal number of stored results per operation. If this number is exceeded, all
+                 * stored results of the operation are discarded. Zero means no limit.
+                 */
+                ArithmeticCache(uint64_t maximalSize = 1ull << 20);
+                
+                /*!
+                 * Computes the (simplified) product of the given values.
+                 */
+                storm::RationalFunction multiply(storm::RationalFunction const& factor1, storm::RationalFunction const& factor2);
+                
+                /*!
+                 * Computes the (simplified) sum of the given values.
+                 */
+                storm::RationalFunction add(storm::RationalFunction const& summand1, storm::RationalFunction const& summand2);
+                
+                /*!
+                 * Retrieves the number of operations whose result was already known.
+                 */
+                uint64_t getNumberOfHits() const;
+                
+                /*!
+                 * Retrieves the number of operations that had to be computed.
+                 */
+                uint64_t getNumberOfMisses() const;
+                
+            private:
+                typedef std::pair<storm::RationalFunction, storm::RationalFunction> OperandsType;
+                
+                struct OperandsHash {
+                    std::size_t operator()(OperandsType const& operands) const;
+                };
+                
+                typedef std::unordered_map<OperandsType, storm::RationalFunction, OperandsHash> ResultMapType;
+                
+                /*!
+                 * Retrieves the result of the operation for the given operands from the given map or computes it.
+                 * As both operations are commutative, the operands are ordered before the lookup.
+                 */
+                template<typename OperationType>
+                storm::RationalFunction getOrCompute(ResultMapType& results, storm::RationalFunction const& operand1, storm::RationalFunction const& operand2, OperationType const& operation);
+                
+                uint64_t maximalSize;
+                
+                ResultMapType products;
+                ResultMapType sums;
+                
+                uint64_t hits;
+                uint64_t misses;
+            };
+#endif
+            
+        } // namespace stateelimination
+    } // namespace storage
+} // namespace storm
@@ -1,5 +1,8 @@
 #include "storm/solver/stateelimination/EliminatorBase.h"
 
+#include <algorithm>
+#include <iterator>
+
 #include "storm/utility/stateelimination.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/constants.h"
@@ -17,6 +20,12 @@ namespace storm {
                 // Intentionally left empty.
             }
             
+            template<typename ValueType, ScalingMode Mode>
+            EliminatorBase<ValueType, Mode>::~EliminatorBase() {
+                uint64_t storedOperations = arithmeticCache.getNumberOfHits() + arithmeticCache.getNumberOfMisses();
+                STORM_LOG_INFO_COND(storedOperations == 0, "State elimination looked up " << storedOperations << " operations in the arithmetic cache, " << arithmeticCache.getNumberOfHits() << " of which were already known.");
+            }
+            
             template<typename ValueType, ScalingMode Mode>
             void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, bool clearRow) {
                 // Start by finding the entry in the given column.
@@ -58,7 +67,7 @@ namespace storm {
                     for (auto entryIt = entriesInRow.begin(), entryIte = entriesInRow.end(); entryIt != entryIte; ++entryIt) {
                         // Only scale the entries in a different column.
                         if (entryIt->getColumn() != column) {
-                            entryIt->setValue(storm::utility::simplify((ValueType) (entryIt->getValue() * columnValue)));
+                            entryIt->setValue(arithmeticCache.multiply(entryIt->getValue(), columnValue));
                         }
                     }
                     updateValue(row, columnValue);
@@ -72,10 +81,13 @@ namespace storm {
                 FlexibleRowType rowsKeepingEntryInColumnEqualRow;
                 
                 // For each entry in the row d, we need to build a list of other rows that will contain an element in the
-                // column d.
-                std::vector<FlexibleRowType> newBackwardEntries(entriesInRow.size());
-                for (auto& backwardEntry : newBackwardEntries) {
-                    backwardEntry.reserve(elementsWithEntryInColumnEqualRow.size());
+                // column d. The lists are kept between eliminations to reuse their memory.
+                if (newBackwardEntries.size() < entriesInRow.size()) {
+                    newBackwardEntries.resize(entriesInRow.size());
+                }
+                for (uint64_t index = 0; index < entriesInRow.size(); ++index) {
+                    newBackwardEntries[index].clear();
+                    newBackwardEntries[index].reserve(elementsWithEntryInColumnEqualRow.size());
                 }
                 
                 // Now go through the rows with an entry in the column corresponding to the current row and substitute
@@ -101,7 +113,7 @@ namespace storm {
                     // First, find the probability with which the predecessor can move to the current state, because
                     // the forward probabilities of the state to be eliminated need to be scaled with this factor.
                     FlexibleRowType& predecessorForwardTransitions = matrix.getRow(predecessor);
-                    FlexibleRowIterator multiplyElement = std::find_if(predecessorForwardTransitions.begin(), predecessorForwardTransitions.end(), [&](storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type> const& a) { return a.getColumn() == column; });
+                    FlexibleRowIterator multiplyElement = findColumn(predecessorForwardTransitions, column);
                     
                     // Make sure we have found the probability and set it to zero.
                     STORM_LOG_THROW(multiplyElement != predecessorForwardTransitions.end(), storm::exceptions::InvalidStateException, "No probability for successor found.");
@@ -114,9 +126,9 @@ namespace storm {
                     FlexibleRowIterator first2 = entriesInRow.begin();
                     FlexibleRowIterator last2 = entriesInRow.end();
                     
-                    FlexibleRowType newSuccessors;
-                    newSuccessors.reserve((last1 - first1) + (last2 - first2));
-                    std::insert_iterator<FlexibleRowType> result(newSuccessors, newSuccessors.end());
+                    mergeBuffer.clear();
+                    mergeBuffer.reserve((last1 - first1) + (last2 - first2));
+                    std::back_insert_iterator<FlexibleRowType> result(mergeBuffer);
                     
                     uint_fast64_t successorOffsetInNewBackwardTransitions = 0;
                     // Now we merge the two successor lists. (Code taken from std::set_union and modified to suit our needs).
@@ -137,18 +149,16 @@ namespace storm {
                             break;
                         }
                         if (first2->getColumn() < first1->getColumn()) {
-                            auto successorEntry = storm::utility::simplify(std::move(*first2 * multiplyFactor));
-                            *result = successorEntry;
-                            newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, successorEntry.getValue());
+                            ValueType probability = arithmeticCache.multiply(first2->getValue(), multiplyFactor);
+                            *result = storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type>(first2->getColumn(), probability);
+                            newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, probability);
                             ++first2;
                             ++successorOffsetInNewBackwardTransitions;
                         } else if (first1->getColumn() < first2->getColumn()) {
                             *result = *first1;
                             ++first1;
                         } else {
-                            ValueType sprod = multiplyFactor * first2->getValue();
-                            ValueType sum = first1->getValue() + storm::utility::simplify(sprod);
-                            auto probability = storm::utility::simplify(sum);
+                            ValueType probability = arithmeticCache.add(first1->getValue(), arithmeticCache.multiply(multiplyFactor, first2->getValue()));
                             *result = storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type>(first1->getColumn(), probability);
                             newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, probability);
                             ++first1;
@@ -158,15 +168,15 @@ namespace storm {
                     }
                     for (; first2 != last2; ++first2) {
                         if (first2->getColumn() != column) {
-                            auto stateProbability = storm::utility::simplify(std::move(*first2 * multiplyFactor));
-                            *result = stateProbability;
-                            newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, stateProbability.getValue());
+                            ValueType probability = arithmeticCache.multiply(first2->getValue(), multiplyFactor);
+                            *result = storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type>(first2->getColumn(), probability);
+                            newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, probability);
                             ++successorOffsetInNewBackwardTransitions;
                         }
                     }
                     
-                    // Now move the new transitions in place.
-                    predecessorForwardTransitions = std::move(newSuccessors);
+                    // Now move the new transitions in place and keep the memory of the old ones for the next merge.
+                    predecessorForwardTransitions.swap(mergeBuffer);
                     STORM_LOG_TRACE("Fixed new next-state probabilities of predecessor state " << predecessor << ".");
                     
                     updatePredecessor(predecessor, multiplyFactor, row);
@@ -187,7 +197,7 @@ namespace storm {
                     // Delete the current state as a predecessor of the successor state only if we are going to remove the
                     // current state's forward transitions.
                     if (clearRow) {
-                        FlexibleRowIterator elimIt = std::find_if(successorBackwardTransitions.begin(), successorBackwardTransitions.end(), [&](storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type> const& a) { return a.getColumn() == row; });
+                        FlexibleRowIterator elimIt = findColumn(successorBackwardTransitions, row);
                         STORM_LOG_ASSERT(elimIt != successorBackwardTransitions.end(), "Expected a proper backward transition from " << successorEntry.getColumn() << " to " << column << ", but found none.");
                         successorBackwardTransitions.erase(elimIt);
                     }
@@ -197,9 +207,9 @@ namespace storm {
                     FlexibleRowIterator first2 = newBackwardEntries[successorOffsetInNewBackwardTransitions].begin();
                     FlexibleRowIterator last2 = newBackwardEntries[successorOffsetInNewBackwardTransitions].end();
                     
-                    FlexibleRowType newPredecessors;
-                    newPredecessors.reserve((last1 - first1) + (last2 - first2));
-                    std::insert_iterator<FlexibleRowType> result(newPredecessors, newPredecessors.end());
+                    mergeBuffer.clear();
+                    mergeBuffer.reserve((last1 - first1) + (last2 - first2));
+                    std::back_insert_iterator<FlexibleRowType> result(mergeBuffer);
                     
                     for (; first1 != last1; ++result) {
                         if (first2 == last2) {
@@ -229,8 +239,8 @@ namespace storm {
                     } else {
                         std::copy_if(first2, last2, result, [&] (storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type> const& a) { return a.getColumn() != row; });
                     }
-                    // Now move the new predecessors in place.
-                    successorBackwardTransitions = std::move(newPredecessors);
+                    // Now move the new predecessors in place and keep the memory of the old ones for the next merge.
+                    successorBackwardTransitions.swap(mergeBuffer);
                     ++successorOffsetInNewBackwardTransitions;
                 }
                 STORM_LOG_TRACE("Fixed predecessor lists of successor states.");
@@ -282,7 +292,7 @@ namespace storm {
                     for (auto entryIt = entriesInRow.begin(), entryIte = entriesInRow.end(); entryIt != entryIte; ++entryIt) {
                         // Scale the entries in a different column, set state transition probability to 0.
                         if (entryIt->getColumn() != state) {
-                            entryIt->setValue(storm::utility::simplify((ValueType) (entryIt->getValue() * columnValue)));
+                            entryIt->setValue(arithmeticCache.multiply(entryIt->getValue(), columnValue));
                         } else {
                             entryIt->setValue(storm::utility::zero<ValueType>());
                         }
@@ -290,6 +300,16 @@ namespace storm {
                 }
             }
 
+            template<typename ValueType, ScalingMode Mode>
+            typename EliminatorBase<ValueType, Mode>::FlexibleRowIterator EliminatorBase<ValueType, Mode>::findColumn(FlexibleRowType& row, uint64_t column) {
+                // Rows are sorted by column, so we can use binary search.
+                FlexibleRowIterator it = std::lower_bound(row.begin(), row.end(), column, [] (typename FlexibleRowType::value_type const& entry, uint64_t const& column) { return entry.getColumn() < column; });
+                if (it != row.end() && it->getColumn() != column) {
+                    return row.end();
+                }
+                return it;
+            }
+
             template<typename ValueType, ScalingMode Mode>
             void EliminatorBase<ValueType, Mode>::updateValue(storm::storage::sparse::state_type const&, ValueType const&) {
                 // Intentionally left empty.
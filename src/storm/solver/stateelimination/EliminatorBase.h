@@ -4,6 +4,8 @@
 
 #include "storm/storage/FlexibleSparseMatrix.h"
 
+#include "storm/solver/stateelimination/ArithmeticCache.h"
+
 namespace storm {
     namespace solver {
         namespace stateelimination {
@@ -19,7 +21,7 @@ namespace storm {
                 typedef typename FlexibleRowType::iterator FlexibleRowIterator;
                 
                 EliminatorBase(storm::storage::FlexibleSparseMatrix<ValueType>& matrix, storm::storage::FlexibleSparseMatrix<ValueType>& transposedMatrix);
-                virtual ~EliminatorBase() = default;
+                virtual ~EliminatorBase();
 
                 void eliminate(uint64_t row, uint64_t column, bool clearRow);
 
@@ -35,6 +37,24 @@ namespace storm {
             protected:
                 storm::storage::FlexibleSparseMatrix<ValueType>& matrix;
                 storm::storage::FlexibleSparseMatrix<ValueType>& transposedMatrix;
+                
+                // Performs (and for rational functions memoises) the arithmetic operations of the elimination.
+                ArithmeticCache<ValueType> arithmeticCache;
+                
+            private:
+                /*!
+                 * Finds the entry with the given column in the given (sorted) row.
+                 *
+                 * @return An iterator to the entry or the end of the row if there is no such entry.
+                 */
+                static FlexibleRowIterator findColumn(FlexibleRowType& row, uint64_t column);
+                
+                // Buffer used for merging rows. After a merge, it is swapped with the merged row such that the memory
+                // of the old row is reused for the next merge instead of allocating a new row each time.
+                FlexibleRowType mergeBuffer;
+                
+                // Buffers for the new backward entries of the successors of the eliminated state. Reused over eliminations.
+                std::vector<FlexibleRowType> newBackwardEntries;
             };
             
         } // namespace stateelimination
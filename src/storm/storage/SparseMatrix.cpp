@@ -16,12 +16,80 @@
 #include "storm/exceptions/OutOfRangeException.h"
 
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 #include <iterator>
+#include <type_traits>
 
 namespace storm {
     namespace storage {
         
+        namespace {
+            // Matrices with fewer entries are always processed by a single thread.
+            uint64_t const minimalNumberOfEntriesForParallelization = 1ull << 16;
+            
+            /*!
+             * Retrieves the number of threads used to process a matrix with the given number of entries. Only matrices
+             * over primitive types are processed concurrently, as copying numbers whose representation is shared
+             * (like rational functions) is not thread-safe.
+             */
+            template<typename ValueType>
+            uint64_t getNumberOfThreads(uint64_t numberOfEntries) {
+                if (!std::is_arithmetic<ValueType>::value || numberOfEntries < minimalNumberOfEntriesForParallelization) {
+                    return 1;
+                }
+                return storm::utility::parallel::getNumberOfMatrixThreads();
+            }
+            
+            /*!
+             * Calls the given function for consecutive blocks of the items from 0 to the given number of items
+             * (exclusive) using the given number of threads.
+             */
+            template<typename Function>
+            void forEachBlock(uint64_t numberOfItems, uint64_t numberOfThreads, Function const& function) {
+                if (numberOfThreads <= 1) {
+                    function(0, numberOfItems);
+                    return;
+                }
+                // Create several blocks per thread to balance the load.
+                uint64_t numberOfBlocks = std::min(numberOfItems, 8 * numberOfThreads);
+                storm::utility::parallel::parallelFor(numberOfBlocks, numberOfThreads, [&] (uint64_t block) {
+                    function(block * numberOfItems / numberOfBlocks, (block + 1) * numberOfItems / numberOfBlocks);
+                });
+            }
+            
+            /*!
+             * Creates the row indications and entries of a matrix in compressed row storage without an intermediate
+             * builder. First, the entries of every row are counted. Then, the entries of every row are written to their
+             * final position. Both passes process blocks of rows concurrently.
+             *
+             * @param rowCount The number of rows of the matrix.
+             * @param numberOfThreads The number of threads to use.
+             * @param countEntries Retrieves the number of entries of the given row.
+             * @param fillRow Writes the entries of the given row starting at the given position.
+             * @param rowIndications Is set to the row indications of the matrix.
+             * @param columnsAndValues Is set to the entries of the matrix.
+             */
+            template<typename IndexType, typename ValueType, typename CountEntries, typename FillRow>
+            void createRows(IndexType rowCount, uint64_t numberOfThreads, CountEntries const& countEntries, FillRow const& fillRow, std::vector<IndexType>& rowIndications, std::vector<MatrixEntry<IndexType, ValueType>>& columnsAndValues) {
+                rowIndications.assign(rowCount + 1, 0);
+                forEachBlock(rowCount, numberOfThreads, [&] (uint64_t begin, uint64_t end) {
+                    for (uint64_t row = begin; row < end; ++row) {
+                        rowIndications[row + 1] = countEntries(row);
+                    }
+                });
+                for (IndexType row = 1; row <= rowCount; ++row) {
+                    rowIndications[row] += rowIndications[row - 1];
+                }
+                columnsAndValues.resize(rowIndications.back());
+                forEachBlock(rowCount, numberOfThreads, [&] (uint64_t begin, uint64_t end) {
+                    for (uint64_t row = begin; row < end; ++row) {
+                        fillRow(row, columnsAndValues.begin() + rowIndications[row]);
+                    }
+                });
+            }
+        }
+        
         template<typename IndexType, typename ValueType>
         MatrixEntry<IndexType, ValueType>::MatrixEntry(IndexType column, ValueType value) : entry(column, value) {
             // Intentionally left empty.
@@ -1044,74 +1112,70 @@ namespace storm {
             // Start by creating a temporary vector that stores for each index whose bit is set to true the number of
             // bits that were set before that particular index.
             std::vector<index_type> columnBitsSetBeforeIndex = columnConstraint.getNumberOfSetBitsBeforeIndices();
-            std::unique_ptr<std::vector<index_type>> tmp;
-            if (rowGroupConstraint != columnConstraint) {
-                tmp = std::make_unique<std::vector<index_type>>(rowGroupConstraint.getNumberOfSetBitsBeforeIndices());
-            }
-            std::vector<index_type> const& rowBitsSetBeforeIndex = tmp ? *tmp : columnBitsSetBeforeIndex;
             
-            // Then, we need to determine the number of entries and the number of rows of the submatrix.
-            index_type subEntries = 0;
-            index_type subRows = 0;
-            index_type rowGroupCount = 0;
+            // Then, we determine the row groups of the submatrix as well as the original row and the (new) row group
+            // of every row of the submatrix. The diagonal of a row is given by the index of its row group.
+            std::vector<index_type> subRowGroupIndices(1, 0);
+            std::vector<index_type> originalRows;
+            std::vector<index_type> subRowGroups;
             for (auto index : rowGroupConstraint) {
-                subRows += rowGroupIndices[index + 1] - rowGroupIndices[index];
-                for (index_type i = rowGroupIndices[index]; i < rowGroupIndices[index + 1]; ++i) {
-                    bool foundDiagonalElement = false;
-                    
-                    for (const_iterator it = this->begin(i), ite = this->end(i); it != ite; ++it) {
-                        if (columnConstraint.get(it->getColumn()) && (makeZeroColumns.size() == 0 || !makeZeroColumns.get(it->getColumn())) ) {
-                            ++subEntries;
-                            
-                            if (columnBitsSetBeforeIndex[it->getColumn()] == rowBitsSetBeforeIndex[index]) {
-                                foundDiagonalElement = true;
-                            }
-                        }
-                    }
-                    
-                    // If requested, we need to reserve one entry more for inserting the diagonal zero entry.
-                    if (insertDiagonalEntries && !foundDiagonalElement && rowGroupCount < submatrixColumnCount) {
-                        ++subEntries;
-                    }
+                for (index_type row = rowGroupIndices[index]; row < rowGroupIndices[index + 1]; ++row) {
+                    originalRows.push_back(row);
+                    subRowGroups.push_back(subRowGroupIndices.size() - 1);
                 }
-                ++rowGroupCount;
+                subRowGroupIndices.push_back(originalRows.size());
             }
             
-            // Create and initialize resulting matrix.
-            SparseMatrixBuilder<ValueType> matrixBuilder(subRows, submatrixColumnCount, subEntries, true, !this->hasTrivialRowGrouping());
-            
-            // Copy over selected entries.
-            rowGroupCount = 0;
-            index_type rowCount = 0;
-            subEntries = 0;
-            for (auto index : rowGroupConstraint) {
-                if (!this->hasTrivialRowGrouping()) {
-                    matrixBuilder.newRowGroup(rowCount);
-                }
-                for (index_type i = rowGroupIndices[index]; i < rowGroupIndices[index + 1]; ++i) {
-                    bool insertedDiagonalElement = false;
-                    
-                    for (const_iterator it = this->begin(i), ite = this->end(i); it != ite; ++it) {
-                        if (columnConstraint.get(it->getColumn())  &&  (makeZeroColumns.size() == 0 || !makeZeroColumns.get(it->getColumn()))) {
-                            if (columnBitsSetBeforeIndex[it->getColumn()] == rowBitsSetBeforeIndex[index]) {
-                                insertedDiagonalElement = true;
-                            } else if (insertDiagonalEntries && !insertedDiagonalElement && columnBitsSetBeforeIndex[it->getColumn()] > rowBitsSetBeforeIndex[index]) {
-                                matrixBuilder.addNextValue(rowCount, rowGroupCount, storm::utility::zero<ValueType>());
-                                insertedDiagonalElement = true;
-                            }
-                            ++subEntries;
-                            matrixBuilder.addNextValue(rowCount, columnBitsSetBeforeIndex[it->getColumn()], it->getValue());
+            auto isColumnSelected = [&] (index_type column) {
+                return columnConstraint.get(column) && (makeZeroColumns.size() == 0 || !makeZeroColumns.get(column));
+            };
+            auto countEntries = [&] (index_type subRow) {
+                index_type diagonal = subRowGroups[subRow];
+                index_type subEntries = 0;
+                bool foundDiagonalElement = false;
+                for (auto const& entry : this->getRow(originalRows[subRow])) {
+                    if (isColumnSelected(entry.getColumn())) {
+                        ++subEntries;
+                        if (columnBitsSetBeforeIndex[entry.getColumn()] == diagonal) {
+                            foundDiagonalElement = true;
                         }
                     }
-                    if (insertDiagonalEntries && !insertedDiagonalElement && rowGroupCount < submatrixColumnCount) {
-                        matrixBuilder.addNextValue(rowCount, rowGroupCount, storm::utility::zero<ValueType>());
+                }
+                
+                // If requested, we need to reserve one entry more for inserting the diagonal zero entry.
+                if (insertDiagonalEntries && !foundDiagonalElement && diagonal < submatrixColumnCount) {
+                    ++subEntries;
+                }
+                return subEntries;
+            };
+            auto fillRow = [&] (index_type subRow, iterator position) {
+                index_type diagonal = subRowGroups[subRow];
+                bool insertedDiagonalElement = false;
+                for (auto const& entry : this->getRow(originalRows[subRow])) {
+                    if (isColumnSelected(entry.getColumn())) {
+                        if (columnBitsSetBeforeIndex[entry.getColumn()] == diagonal) {
+                            insertedDiagonalElement = true;
+                        } else if (insertDiagonalEntries && !insertedDiagonalElement && columnBitsSetBeforeIndex[entry.getColumn()] > diagonal) {
+                            *position++ = MatrixEntry<index_type, ValueType>(diagonal, storm::utility::zero<ValueType>());
+                            insertedDiagonalElement = true;
+                        }
+                        *position++ = MatrixEntry<index_type, ValueType>(columnBitsSetBeforeIndex[entry.getColumn()], entry.getValue());
                     }
-                    ++rowCount;
                 }
-                ++rowGroupCount;
-            }
+                if (insertDiagonalEntries && !insertedDiagonalElement && diagonal < submatrixColumnCount) {
+                    *position = MatrixEntry<index_type, ValueType>(diagonal, storm::utility::zero<ValueType>());
+                }
+            };
             
-            return matrixBuilder.build();
+            std::vector<index_type> subRowIndications;
+            std::vector<MatrixEntry<index_type, ValueType>> subColumnsAndValues;
+            createRows(static_cast<index_type>(originalRows.size()), getNumberOfThreads<ValueType>(this->getEntryCount()), countEntries, fillRow, subRowIndications, subColumnsAndValues);
+            
+            boost::optional<std::vector<index_type>> subRowGrouping;
+            if (!this->hasTrivialRowGrouping()) {
+                subRowGrouping = std::move(subRowGroupIndices);
+            }
+            return SparseMatrix<ValueType>(submatrixColumnCount, std::move(subRowIndications), std::move(subColumnsAndValues), std::move(subRowGrouping));
         }
         
         template<typename ValueType>
@@ -1158,26 +1222,19 @@ namespace storm {
         
         template<typename ValueType>
         SparseMatrix<ValueType> SparseMatrix<ValueType>::filterEntries(storm::storage::BitVector const& rowFilter) const {
-            // Count the number of entries in the resulting matrix.
-            index_type entryCount = 0;
-            for (auto row : rowFilter) {
-                entryCount += getRow(row).getNumberOfEntries();
-            }
-            
-            // Build the resulting matrix.
-            SparseMatrixBuilder<ValueType> builder(getRowCount(), getColumnCount(), entryCount);
-            for (auto row : rowFilter) {
-                for (auto const& entry : getRow(row)) {
-                    builder.addNextValue(row, entry.getColumn(), entry.getValue());
+            // Copy the entries of the selected rows, all other rows remain empty.
+            std::vector<index_type> newRowIndications;
+            std::vector<MatrixEntry<index_type, ValueType>> newColumnsAndValues;
+            createRows(getRowCount(), getNumberOfThreads<ValueType>(getEntryCount()), [&] (index_type row) {
+                return rowFilter.get(row) ? getRow(row).getNumberOfEntries() : 0;
+            }, [&] (index_type row, iterator position) {
+                if (rowFilter.get(row)) {
+                    std::copy(begin(row), end(row), position);
                 }
-            }
-            SparseMatrix<ValueType> result = builder.build();
+            }, newRowIndications, newColumnsAndValues);
             
             // Add a row grouping if necessary.
-            if (!hasTrivialRowGrouping()) {
-                result.setRowGroupIndices(getRowGroupIndices());
-            }
-            return result;
+            return SparseMatrix<ValueType>(getColumnCount(), std::move(newRowIndications), std::move(newColumnsAndValues), hasTrivialRowGrouping() ? boost::none : boost::optional<std::vector<index_type>>(getRowGroupIndices()));
         }
         
         template<typename ValueType>
@@ -1203,53 +1260,40 @@ namespace storm {
         
         template<typename ValueType>
         SparseMatrix<ValueType> SparseMatrix<ValueType>::selectRowsFromRowGroups(std::vector<index_type> const& rowGroupToRowIndexMapping, bool insertDiagonalEntries) const {
-            // First, we need to count how many non-zero entries the resulting matrix will have and reserve space for
-            // diagonal entries if requested.
-            index_type subEntries = 0;
-            for (index_type rowGroupIndex = 0, rowGroupIndexEnd = rowGroupToRowIndexMapping.size(); rowGroupIndex < rowGroupIndexEnd; ++rowGroupIndex) {
+            STORM_LOG_ASSERT(rowGroupToRowIndexMapping.size() == this->getRowGroupCount(), "Dimensions mismatch.");
+            
+            // Count the entries of the selected row of each row group and reserve space for diagonal entries if
+            // requested. Then copy the entries. This also inserts a zero element on the diagonal if there is no entry yet.
+            auto countEntries = [&] (index_type rowGroupIndex) {
                 // Determine which row we need to select from the current row group.
                 index_type rowToCopy = this->getRowGroupIndices()[rowGroupIndex] + rowGroupToRowIndexMapping[rowGroupIndex];
-                
-                // Iterate through that row and count the number of slots we have to reserve for copying.
-                bool foundDiagonalElement = false;
-                for (const_iterator it = this->begin(rowToCopy), ite = this->end(rowToCopy); it != ite; ++it) {
-                    if (it->getColumn() == rowGroupIndex) {
-                        foundDiagonalElement = true;
-                    }
-                    ++subEntries;
-                }
-                if (insertDiagonalEntries && !foundDiagonalElement) {
+                index_type subEntries = this->getRow(rowToCopy).getNumberOfEntries();
+                if (insertDiagonalEntries && std::none_of(this->begin(rowToCopy), this->end(rowToCopy), [&] (MatrixEntry<index_type, ValueType> const& entry) { return entry.getColumn() == rowGroupIndex; })) {
                     ++subEntries;
                 }
-            }
-            
-            // Now create the matrix to be returned with the appropriate size.
-            SparseMatrixBuilder<ValueType> matrixBuilder(rowGroupIndices.get().size() - 1, columnCount, subEntries);
-            
-            // Copy over the selected lines from the source matrix.
-            for (index_type rowGroupIndex = 0, rowGroupIndexEnd = rowGroupToRowIndexMapping.size(); rowGroupIndex < rowGroupIndexEnd; ++rowGroupIndex) {
-                // Determine which row we need to select from the current row group.
+                return subEntries;
+            };
+            auto fillRow = [&] (index_type rowGroupIndex, iterator position) {
                 index_type rowToCopy = this->getRowGroupIndices()[rowGroupIndex] + rowGroupToRowIndexMapping[rowGroupIndex];
-                
-                // Iterate through that row and copy the entries. This also inserts a zero element on the diagonal if
-                // there is no entry yet.
                 bool insertedDiagonalElement = false;
                 for (const_iterator it = this->begin(rowToCopy), ite = this->end(rowToCopy); it != ite; ++it) {
                     if (it->getColumn() == rowGroupIndex) {
                         insertedDiagonalElement = true;
                     } else if (insertDiagonalEntries && !insertedDiagonalElement && it->getColumn() > rowGroupIndex) {
-                        matrixBuilder.addNextValue(rowGroupIndex, rowGroupIndex, storm::utility::zero<ValueType>());
+                        *position++ = MatrixEntry<index_type, ValueType>(rowGroupIndex, storm::utility::zero<ValueType>());
                         insertedDiagonalElement = true;
                     }
-                    matrixBuilder.addNextValue(rowGroupIndex, it->getColumn(), it->getValue());
+                    *position++ = *it;
                 }
                 if (insertDiagonalEntries && !insertedDiagonalElement) {
-                    matrixBuilder.addNextValue(rowGroupIndex, rowGroupIndex, storm::utility::zero<ValueType>());
+                    *position = MatrixEntry<index_type, ValueType>(rowGroupIndex, storm::utility::zero<ValueType>());
                 }
-            }
+            };
             
-            // Finalize created matrix and return result.
-            return matrixBuilder.build();
+            std::vector<index_type> newRowIndications;
+            std::vector<MatrixEntry<index_type, ValueType>> newColumnsAndValues;
+            createRows(this->getRowGroupCount(), getNumberOfThreads<ValueType>(this->getEntryCount()), countEntries, fillRow, newRowIndications, newColumnsAndValues);
+            return SparseMatrix<ValueType>(columnCount, std::move(newRowIndications), std::move(newColumnsAndValues), boost::none);
         }
 
         template<typename ValueType>
@@ -1333,6 +1377,69 @@ namespace storm {
             std::vector<index_type> rowIndications(rowCount + 1);
             std::vector<MatrixEntry<index_type, ValueType>> columnsAndValues(entryCount);
             
+            uint64_t numberOfThreads = getNumberOfThreads<ValueType>(this->getEntryCount());
+            if (numberOfThreads > 1) {
+                // Split the rows (or row groups) of this matrix into consecutive chunks, one per thread. Every chunk
+                // counts the entries of each column separately, such that the chunks can later write their entries to
+                // disjoint positions that preserve the ordering of the entries within the rows.
+                numberOfThreads = std::min<uint64_t>(numberOfThreads, std::max<uint64_t>(columnCount, 1));
+                std::vector<index_type> chunkBegin(numberOfThreads + 1);
+                for (uint64_t chunk = 0; chunk <= numberOfThreads; ++chunk) {
+                    chunkBegin[chunk] = chunk * columnCount / numberOfThreads;
+                }
+                std::vector<std::vector<index_type>> chunkPositions(numberOfThreads);
+                storm::utility::parallel::parallelFor(numberOfThreads, numberOfThreads, [&] (uint64_t chunk) {
+                    std::vector<index_type>& counts = chunkPositions[chunk];
+                    counts.assign(rowCount, 0);
+                    for (index_type group = chunkBegin[chunk]; group < chunkBegin[chunk + 1]; ++group) {
+                        for (auto const& transition : joinGroups ? this->getRowGroup(group) : this->getRow(group)) {
+                            if (transition.getValue() != storm::utility::zero<ValueType>() || keepZeros) {
+                                ++counts[transition.getColumn()];
+                            }
+                        }
+                    }
+                });
+                
+                // Sum up the counts of all chunks and compute the accumulated offsets.
+                forEachBlock(rowCount, numberOfThreads, [&] (uint64_t begin, uint64_t end) {
+                    for (uint64_t row = begin; row < end; ++row) {
+                        for (auto const& counts : chunkPositions) {
+                            rowIndications[row + 1] += counts[row];
+                        }
+                    }
+                });
+                for (index_type i = 1; i < rowCount + 1; ++i) {
+                    rowIndications[i] = rowIndications[i - 1] + rowIndications[i];
+                }
+                
+                // Turn the counts of each chunk into the position at which the chunk writes its next entry.
+                forEachBlock(rowCount, numberOfThreads, [&] (uint64_t begin, uint64_t end) {
+                    for (uint64_t row = begin; row < end; ++row) {
+                        index_type position = rowIndications[row];
+                        for (auto& positions : chunkPositions) {
+                            index_type count = positions[row];
+                            positions[row] = position;
+                            position += count;
+                        }
+                    }
+                });
+                
+                // Now every chunk fills in its values of the transposed matrix.
+                storm::utility::parallel::parallelFor(numberOfThreads, numberOfThreads, [&] (uint64_t chunk) {
+                    std::vector<index_type>& nextIndices = chunkPositions[chunk];
+                    for (index_type group = chunkBegin[chunk]; group < chunkBegin[chunk + 1]; ++group) {
+                        for (auto const& transition : joinGroups ? this->getRowGroup(group) : this->getRow(group)) {
+                            if (transition.getValue() != storm::utility::zero<ValueType>() || keepZeros) {
+                                columnsAndValues[nextIndices[transition.getColumn()]] = MatrixEntry<index_type, ValueType>(group, transition.getValue());
+                                nextIndices[transition.getColumn()]++;
+                            }
+                        }
+                    }
+                });
+                
+                return storm::storage::SparseMatrix<ValueType>(columnCount, std::move(rowIndications), std::move(columnsAndValues), boost::none);
+            }
+            
             // First, we need to count how many entries each column has.
             for (index_type group = 0; group < columnCount; ++group) {
                 for (auto const& transition : joinGroups ? this->getRowGroup(group) : this->getRow(group)) {
@@ -1674,6 +1781,108 @@ namespace storm {
         }
 #endif
         
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::multiplyWithBlockVector(std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<value_type> const* summand, uint64_t blockSize) const {
+            STORM_LOG_ASSERT(&vector != &result, "Vectors must not be aliased.");
+            STORM_LOG_ASSERT(vector.size() == this->getColumnCount() * blockSize, "Size of input block vector does not match.");
+            STORM_LOG_ASSERT(result.size() == this->getRowCount() * blockSize, "Size of result block vector does not match.");
+            
+            auto elementIt = this->begin();
+            auto resultIt = result.begin();
+            typename std::vector<ValueType>::const_iterator summandIt;
+            if (summand) {
+                summandIt = summand->begin();
+            }
+            
+            for (auto rowIt = rowIndications.begin(), rowIte = rowIndications.end() - 1; rowIt != rowIte; ++rowIt) {
+                // Initialize the values of the current row for all vectors of the block.
+                if (summand) {
+                    std::copy(summandIt, summandIt + blockSize, resultIt);
+                    summandIt += blockSize;
+                } else {
+                    std::fill(resultIt, resultIt + blockSize, storm::utility::zero<ValueType>());
+                }
+                
+                // Each matrix entry is loaded once and applied to all vectors of the block.
+                for (auto elementIte = this->begin() + *(rowIt + 1); elementIt != elementIte; ++elementIt) {
+                    ValueType const& value = elementIt->getValue();
+                    auto vectorIt = vector.begin() + elementIt->getColumn() * blockSize;
+                    auto targetIt = resultIt;
+                    for (uint64_t j = 0; j < blockSize; ++j, ++vectorIt, ++targetIt) {
+                        *targetIt += value * *vectorIt;
+                    }
+                }
+                resultIt += blockSize;
+            }
+        }
+        
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::multiplyAndReduceBlockVector(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, uint64_t blockSize) const {
+            if (dir == OptimizationDirection::Minimize) {
+                multiplyAndReduceBlockVector<storm::utility::ElementLess<ValueType>>(rowGroupIndices, vector, summand, result, blockSize);
+            } else {
+                multiplyAndReduceBlockVector<storm::utility::ElementGreater<ValueType>>(rowGroupIndices, vector, summand, result, blockSize);
+            }
+        }
+        
+        template<typename ValueType>
+        template<typename Compare>
+        void SparseMatrix<ValueType>::multiplyAndReduceBlockVector(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, uint64_t blockSize) const {
+            STORM_LOG_ASSERT(&vector != &result, "Vectors must not be aliased.");
+            STORM_LOG_ASSERT(result.size() == (rowGroupIndices.size() - 1) * blockSize, "Size of result block vector does not match.");
+            Compare compare;
+            
+            // Scratch space for the values of the row that is currently processed.
+            std::vector<ValueType> rowValues(blockSize);
+            
+            auto resultIt = result.begin();
+            for (auto rowGroupIt = rowGroupIndices.begin(), rowGroupIte = rowGroupIndices.end() - 1; rowGroupIt != rowGroupIte; ++rowGroupIt, resultIt += blockSize) {
+                uint64_t currentRow = *rowGroupIt;
+                uint64_t const groupEnd = *(rowGroupIt + 1);
+                
+                // Only multiply and reduce if there is at least one row in the group.
+                if (currentRow == groupEnd) {
+                    std::fill(resultIt, resultIt + blockSize, storm::utility::zero<ValueType>());
+                    continue;
+                }
+                
+                for (bool firstRow = true; currentRow < groupEnd; ++currentRow, firstRow = false) {
+                    if (summand) {
+                        std::copy(summand->begin() + currentRow * blockSize, summand->begin() + (currentRow + 1) * blockSize, rowValues.begin());
+                    } else {
+                        std::fill(rowValues.begin(), rowValues.end(), storm::utility::zero<ValueType>());
+                    }
+                    for (auto elementIt = this->begin() + rowIndications[currentRow], elementIte = this->begin() + rowIndications[currentRow + 1]; elementIt != elementIte; ++elementIt) {
+                        ValueType const& value = elementIt->getValue();
+                        auto vectorIt = vector.begin() + elementIt->getColumn() * blockSize;
+                        for (auto& rowValue : rowValues) {
+                            rowValue += value * *vectorIt;
+                            ++vectorIt;
+                        }
+                    }
+                    
+                    if (firstRow) {
+                        std::copy(rowValues.begin(), rowValues.end(), resultIt);
+                    } else {
+                        auto targetIt = resultIt;
+                        for (auto const& rowValue : rowValues) {
+                            if (compare(rowValue, *targetIt)) {
+                                *targetIt = rowValue;
+                            }
+                            ++targetIt;
+                        }
+                    }
+                }
+            }
+        }
+        
+#ifdef STORM_HAVE_CARL
+        template<>
+        void SparseMatrix<storm::RationalFunction>::multiplyAndReduceBlockVector(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<storm::RationalFunction> const& vector, std::vector<storm::RationalFunction> const* summand, std::vector<storm::RationalFunction>& result, uint64_t blockSize) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+#endif
+        
         template<typename ValueType>
         ValueType SparseMatrix<ValueType>::multiplyRowWithVector(index_type row, std::vector<ValueType> const& vector) const {
             ValueType result = storm::utility::zero<ValueType>();
@@ -922,6 +922,35 @@ namespace storm {
             void multiplyAndReduceParallel(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const;
 #endif
 
+            /*!
+             * Multiplies the matrix with the given block vector and writes the result to the given result block vector.
+             * A block vector stores several vectors such that the i-th entry of the j-th vector is located at position
+             * i * blockSize + j. The matrix is only traversed once for all vectors in the block.
+             *
+             * @param vector The block vector with which to multiply the matrix.
+             * @param result The block vector that is supposed to hold the result of the multiplication after the
+             * operation. Must not be the same as the input vector.
+             * @param summand If given, this block vector will be added to the result of the multiplication.
+             * @param blockSize The number of vectors stored in the block vectors.
+             */
+            void multiplyWithBlockVector(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand, uint64_t blockSize) const;
+            
+            /*!
+             * Multiplies the matrix with the given block vector (see multiplyWithBlockVector) and reduces each of the
+             * vectors in the block independently according to the given direction.
+             *
+             * @param dir The optimization direction for the reduction.
+             * @param rowGroupIndices The row groups for the reduction
+             * @param vector The block vector with which to multiply the matrix.
+             * @param summand If given, this block vector will be added to the result of the multiplication.
+             * @param result The block vector that is supposed to hold the result of the multiplication after the
+             * operation. Must not be the same as the input vector.
+             * @param blockSize The number of vectors stored in the block vectors.
+             */
+            void multiplyAndReduceBlockVector(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, uint64_t blockSize) const;
+            template<typename Compare>
+            void multiplyAndReduceBlockVector(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, uint64_t blockSize) const;
+
             /*!
              * Multiplies a single row of the matrix with the given vector and returns the result
              *
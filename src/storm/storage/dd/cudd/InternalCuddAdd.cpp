@@ -10,6 +10,7 @@
 
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/exceptions/NotSupportedException.h"
 
@@ -503,7 +504,54 @@ namespace storm {
         
         template<typename ValueType>
         void InternalAdd<DdType::CUDD, ValueType>::composeWithExplicitVector(storm::dd::Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<ValueType>& targetVector, std::function<ValueType (ValueType const&, ValueType const&)> const& function) const {
-            forEachRec(this->getCuddDdNode(), 0, ddVariableIndices.size(), 0, odd, ddVariableIndices, [&function, &targetVector] (uint64_t const& offset, ValueType const& value) { targetVector[offset] = function(targetVector[offset], value); });
+            std::function<void (uint64_t const&, ValueType const&)> composeFunction = [&function, &targetVector] (uint64_t const& offset, ValueType const& value) { targetVector[offset] = function(targetVector[offset], value); };
+            
+            uint_fast64_t splitLevel = getConversionSplitLevel(ddVariableIndices.size());
+            if (splitLevel == 0) {
+                forEachRec(this->getCuddDdNode(), 0, ddVariableIndices.size(), 0, odd, ddVariableIndices, composeFunction);
+                return;
+            }
+            
+            // The tasks cover disjoint parts of the target vector, so they can be processed in parallel.
+            std::vector<ConversionTask> tasks;
+            collectVectorConversionTasksRec(this->getCuddDdNode(), 0, splitLevel, 0, odd, ddVariableIndices, tasks);
+            storm::utility::parallel::parallelFor(tasks.size(), ddManager->getNumberOfConversionThreads(), [&] (uint64_t taskIndex) {
+                ConversionTask const& task = tasks[taskIndex];
+                forEachRec(task.dd, splitLevel, ddVariableIndices.size(), task.rowOffset, *task.rowOdd, ddVariableIndices, composeFunction);
+            });
+        }
+        
+        template<typename ValueType>
+        uint_fast64_t InternalAdd<DdType::CUDD, ValueType>::getConversionSplitLevel(uint_fast64_t numberOfLevels) const {
+            uint_fast64_t numberOfThreads = ddManager->getNumberOfConversionThreads();
+            if (numberOfThreads <= 1) {
+                return 0;
+            }
+            
+            // Create (at least) 16 times as many tasks as there are threads to balance the load.
+            uint_fast64_t splitLevel = 4;
+            while ((1ull << (splitLevel - 4)) < numberOfThreads) {
+                ++splitLevel;
+            }
+            return std::min(splitLevel, numberOfLevels);
+        }
+        
+        template<typename ValueType>
+        void InternalAdd<DdType::CUDD, ValueType>::collectVectorConversionTasksRec(DdNode const* dd, uint_fast64_t currentLevel, uint_fast64_t splitLevel, uint_fast64_t currentOffset, Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<ConversionTask>& tasks) const {
+            // For the empty DD, we do not need to add any entries.
+            if (dd == Cudd_ReadZero(ddManager->getCuddManager().getManager())) {
+                return;
+            }
+            
+            if (currentLevel == splitLevel) {
+                tasks.push_back({dd, &odd, nullptr, currentOffset, 0});
+            } else if (ddVariableIndices[currentLevel] < Cudd_NodeReadIndex(dd)) {
+                collectVectorConversionTasksRec(dd, currentLevel + 1, splitLevel, currentOffset, odd.getElseSuccessor(), ddVariableIndices, tasks);
+                collectVectorConversionTasksRec(dd, currentLevel + 1, splitLevel, currentOffset + odd.getElseOffset(), odd.getThenSuccessor(), ddVariableIndices, tasks);
+            } else {
+                collectVectorConversionTasksRec(Cudd_E_const(dd), currentLevel + 1, splitLevel, currentOffset, odd.getElseSuccessor(), ddVariableIndices, tasks);
+                collectVectorConversionTasksRec(Cudd_T_const(dd), currentLevel + 1, splitLevel, currentOffset + odd.getElseOffset(), odd.getThenSuccessor(), ddVariableIndices, tasks);
+            }
         }
         
         template<typename ValueType>
@@ -690,7 +738,68 @@ namespace storm {
         
         template<typename ValueType>
         void InternalAdd<DdType::CUDD, ValueType>::toMatrixComponents(std::vector<uint_fast64_t> const& rowGroupIndices, std::vector<uint_fast64_t>& rowIndications, std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const {
-            return toMatrixComponentsRec(this->getCuddDdNode(), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+            uint_fast64_t maxLevel = ddRowVariableIndices.size() + ddColumnVariableIndices.size();
+            uint_fast64_t splitLevel = getConversionSplitLevel(ddRowVariableIndices.size());
+            if (splitLevel == 0) {
+                toMatrixComponentsRec(this->getCuddDdNode(), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, maxLevel, 0, 0, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+                return;
+            }
+            
+            // The task lists cover disjoint sets of rows, so they can be processed in parallel. The tasks within one
+            // list, however, share rows and need to be processed sequentially to keep the entries sorted by column.
+            std::vector<std::vector<ConversionTask>> taskLists(1ull << splitLevel);
+            collectMatrixConversionTasksRec(this->getCuddDdNode(), rowOdd, columnOdd, 0, splitLevel, 0, 0, 0, ddRowVariableIndices, ddColumnVariableIndices, taskLists);
+            storm::utility::parallel::parallelFor(taskLists.size(), ddManager->getNumberOfConversionThreads(), [&] (uint64_t listIndex) {
+                for (auto const& task : taskLists[listIndex]) {
+                    toMatrixComponentsRec(task.dd, rowGroupIndices, rowIndications, columnsAndValues, *task.rowOdd, *task.columnOdd, splitLevel, splitLevel, maxLevel, task.rowOffset, task.columnOffset, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+                }
+            });
+        }
+        
+        template<typename ValueType>
+        void InternalAdd<DdType::CUDD, ValueType>::collectMatrixConversionTasksRec(DdNode const* dd, Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentLevel, uint_fast64_t splitLevel, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset, uint_fast64_t rowPrefix, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, std::vector<std::vector<ConversionTask>>& taskLists) const {
+            // For the empty DD, we do not need to add any entries.
+            if (dd == Cudd_ReadZero(ddManager->getCuddManager().getManager())) {
+                return;
+            }
+            
+            if (currentLevel == splitLevel) {
+                taskLists[rowPrefix].push_back({dd, &rowOdd, &columnOdd, currentRowOffset, currentColumnOffset});
+            } else {
+                DdNode const* elseElse;
+                DdNode const* elseThen;
+                DdNode const* thenElse;
+                DdNode const* thenThen;
+                
+                if (ddColumnVariableIndices[currentLevel] < Cudd_NodeReadIndex(dd)) {
+                    elseElse = elseThen = thenElse = thenThen = dd;
+                } else if (ddRowVariableIndices[currentLevel] < Cudd_NodeReadIndex(dd)) {
+                    elseElse = thenElse = Cudd_E_const(dd);
+                    elseThen = thenThen = Cudd_T_const(dd);
+                } else {
+                    DdNode const* elseNode = Cudd_E_const(dd);
+                    if (ddColumnVariableIndices[currentLevel] < Cudd_NodeReadIndex(elseNode)) {
+                        elseElse = elseThen = elseNode;
+                    } else {
+                        elseElse = Cudd_E_const(elseNode);
+                        elseThen = Cudd_T_const(elseNode);
+                    }
+                    
+                    DdNode const* thenNode = Cudd_T_const(dd);
+                    if (ddColumnVariableIndices[currentLevel] < Cudd_NodeReadIndex(thenNode)) {
+                        thenElse = thenThen = thenNode;
+                    } else {
+                        thenElse = Cudd_E_const(thenNode);
+                        thenThen = Cudd_T_const(thenNode);
+                    }
+                }
+                
+                // Visit the successors in the same order as the sequential conversion.
+                collectMatrixConversionTasksRec(elseElse, rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(), currentLevel + 1, splitLevel, currentRowOffset, currentColumnOffset, rowPrefix << 1, ddRowVariableIndices, ddColumnVariableIndices, taskLists);
+                collectMatrixConversionTasksRec(elseThen, rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(), currentLevel + 1, splitLevel, currentRowOffset, currentColumnOffset + columnOdd.getElseOffset(), rowPrefix << 1, ddRowVariableIndices, ddColumnVariableIndices, taskLists);
+                collectMatrixConversionTasksRec(thenElse, rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(), currentLevel + 1, splitLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset, (rowPrefix << 1) | 1, ddRowVariableIndices, ddColumnVariableIndices, taskLists);
+                collectMatrixConversionTasksRec(thenThen, rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(), currentLevel + 1, splitLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset + columnOdd.getElseOffset(), (rowPrefix << 1) | 1, ddRowVariableIndices, ddColumnVariableIndices, taskLists);
+            }
         }
 
         template<typename ValueType>
@@ -2,13 +2,14 @@
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CuddSettings.h"
+#include "storm/settings/modules/CoreSettings.h"
 
 #include "storm/exceptions/NotSupportedException.h"
 
 namespace storm {
     namespace dd {
         
-        InternalDdManager<DdType::CUDD>::InternalDdManager() : cuddManager(), reorderingTechnique(CUDD_REORDER_NONE), numberOfDdVariables(0) {
+        InternalDdManager<DdType::CUDD>::InternalDdManager() : cuddManager(), reorderingTechnique(CUDD_REORDER_NONE), numberOfDdVariables(0), numberOfConversionThreads(storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfDdConversionThreads()) {
             this->cuddManager.SetMaxMemory(static_cast<unsigned long>(storm::settings::getModule<storm::settings::modules::CuddSettings>().getMaximalMemory() * 1024ul * 1024ul));
             
             auto const& settings = storm::settings::getModule<storm::settings::modules::CuddSettings>();
@@ -168,6 +169,14 @@ namespace storm {
         uint_fast64_t InternalDdManager<DdType::CUDD>::getNumberOfDdVariables() const {
             return numberOfDdVariables;
         }
+        
+        uint_fast64_t InternalDdManager<DdType::CUDD>::getNumberOfConversionThreads() const {
+            return numberOfConversionThreads;
+        }
+        
+        void InternalDdManager<DdType::CUDD>::setNumberOfConversionThreads(uint_fast64_t numberOfThreads) {
+            numberOfConversionThreads = numberOfThreads;
+        }
 
         template InternalAdd<DdType::CUDD, double> InternalDdManager<DdType::CUDD>::getAddOne() const;
         template InternalAdd<DdType::CUDD, uint_fast64_t> InternalDdManager<DdType::CUDD>::getAddOne() const;
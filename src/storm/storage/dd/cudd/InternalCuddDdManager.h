@@ -137,6 +137,20 @@ namespace storm {
              * @return The number of managed variables.
              */
             uint_fast64_t getNumberOfDdVariables() const;
+            
+            /*!
+             * Retrieves the number of threads used to convert DDs into explicit matrices and vectors.
+             *
+             * @return The number of threads.
+             */
+            uint_fast64_t getNumberOfConversionThreads() const;
+            
+            /*!
+             * Sets the number of threads used to convert DDs into explicit matrices and vectors.
+             *
+             * @param numberOfThreads The number of threads.
+             */
+            void setNumberOfConversionThreads(uint_fast64_t numberOfThreads);
 
             /*!
              * Retrieves the underlying CUDD manager.
@@ -164,6 +178,9 @@ namespace storm {
             
             // Keeps track of the number of registered DD variables.
             uint_fast64_t numberOfDdVariables;
+            
+            // The number of threads used to convert DDs into explicit matrices and vectors.
+            uint_fast64_t numberOfConversionThreads;
         };        
     }
 }
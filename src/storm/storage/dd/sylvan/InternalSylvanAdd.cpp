@@ -9,6 +9,7 @@
 
 #include "storm/utility/macros.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/NotSupportedException.h"
@@ -902,7 +903,55 @@ namespace storm {
 
         template<typename ValueType>
         void InternalAdd<DdType::Sylvan, ValueType>::composeWithExplicitVector(storm::dd::Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<ValueType>& targetVector, std::function<ValueType (ValueType const&, ValueType const&)> const& function) const {
-            forEachRec(this->getSylvanMtbdd().GetMTBDD(), 0, ddVariableIndices.size(), 0, odd, ddVariableIndices, [&function, &targetVector] (uint64_t const& offset, ValueType const& value) { targetVector[offset] = function(targetVector[offset], value); });
+            std::function<void (uint64_t const&, ValueType const&)> composeFunction = [&function, &targetVector] (uint64_t const& offset, ValueType const& value) { targetVector[offset] = function(targetVector[offset], value); };
+
+            uint_fast64_t splitLevel = getConversionSplitLevel(ddVariableIndices.size());
+            if (splitLevel == 0) {
+                forEachRec(this->getSylvanMtbdd().GetMTBDD(), 0, ddVariableIndices.size(), 0, odd, ddVariableIndices, composeFunction);
+                return;
+            }
+
+            // The tasks cover disjoint parts of the target vector, so they can be processed in parallel.
+            std::vector<ConversionTask> tasks;
+            collectVectorConversionTasksRec(this->getSylvanMtbdd().GetMTBDD(), 0, splitLevel, 0, odd, ddVariableIndices, tasks);
+            storm::utility::parallel::parallelFor(tasks.size(), ddManager->getNumberOfConversionThreads(), [&] (uint64_t taskIndex) {
+                ConversionTask const& task = tasks[taskIndex];
+                forEachRec(task.dd, splitLevel, ddVariableIndices.size(), task.rowOffset, *task.rowOdd, ddVariableIndices, composeFunction);
+            });
+        }
+
+        template<typename ValueType>
+        uint_fast64_t InternalAdd<DdType::Sylvan, ValueType>::getConversionSplitLevel(uint_fast64_t numberOfLevels) const {
+            uint_fast64_t numberOfThreads = ddManager->getNumberOfConversionThreads();
+            // Copying exact values is not safe to do concurrently.
+            if (numberOfThreads <= 1 || !std::is_arithmetic<ValueType>::value) {
+                return 0;
+            }
+
+            // Create (at least) 16 times as many tasks as there are threads to balance the load.
+            uint_fast64_t splitLevel = 4;
+            while ((1ull << (splitLevel - 4)) < numberOfThreads) {
+                ++splitLevel;
+            }
+            return std::min(splitLevel, numberOfLevels);
+        }
+
+        template<typename ValueType>
+        void InternalAdd<DdType::Sylvan, ValueType>::collectVectorConversionTasksRec(MTBDD dd, uint_fast64_t currentLevel, uint_fast64_t splitLevel, uint_fast64_t currentOffset, Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<ConversionTask>& tasks) const {
+            // For the empty DD, we do not need to add any entries.
+            if (mtbdd_isleaf(dd) && mtbdd_iszero(dd)) {
+                return;
+            }
+
+            if (currentLevel == splitLevel) {
+                tasks.push_back({dd, false, &odd, nullptr, currentOffset, 0});
+            } else if (mtbdd_isleaf(dd) || ddVariableIndices[currentLevel] < mtbdd_getvar(dd)) {
+                collectVectorConversionTasksRec(dd, currentLevel + 1, splitLevel, currentOffset, odd.getElseSuccessor(), ddVariableIndices, tasks);
+                collectVectorConversionTasksRec(dd, currentLevel + 1, splitLevel, currentOffset + odd.getElseOffset(), odd.getThenSuccessor(), ddVariableIndices, tasks);
+            } else {
+                collectVectorConversionTasksRec(mtbdd_getlow(dd), currentLevel + 1, splitLevel, currentOffset, odd.getElseSuccessor(), ddVariableIndices, tasks);
+                collectVectorConversionTasksRec(mtbdd_gethigh(dd), currentLevel + 1, splitLevel, currentOffset + odd.getElseOffset(), odd.getThenSuccessor(), ddVariableIndices, tasks);
+            }
         }
 
         template<typename ValueType>
@@ -1135,7 +1184,68 @@ namespace storm {
 
         template<typename ValueType>
         void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponents(std::vector<uint_fast64_t> const& rowGroupIndices, std::vector<uint_fast64_t>& rowIndications, std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const {
-            return toMatrixComponentsRec(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), mtbdd_hascomp(this->getSylvanMtbdd().GetMTBDD()), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+            uint_fast64_t maxLevel = ddRowVariableIndices.size() + ddColumnVariableIndices.size();
+            uint_fast64_t splitLevel = getConversionSplitLevel(ddRowVariableIndices.size());
+            if (splitLevel == 0) {
+                toMatrixComponentsRec(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), mtbdd_hascomp(this->getSylvanMtbdd().GetMTBDD()), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, maxLevel, 0, 0, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+                return;
+            }
+
+            // The task lists cover disjoint sets of rows, so they can be processed in parallel. The tasks within one
+            // list, however, share rows and need to be processed sequentially to keep the entries sorted by column.
+            std::vector<std::vector<ConversionTask>> taskLists(1ull << splitLevel);
+            collectMatrixConversionTasksRec(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), mtbdd_hascomp(this->getSylvanMtbdd().GetMTBDD()), rowOdd, columnOdd, 0, splitLevel, 0, 0, 0, ddRowVariableIndices, ddColumnVariableIndices, taskLists);
+            storm::utility::parallel::parallelFor(taskLists.size(), ddManager->getNumberOfConversionThreads(), [&] (uint64_t listIndex) {
+                for (auto const& task : taskLists[listIndex]) {
+                    toMatrixComponentsRec(task.dd, task.negated, rowGroupIndices, rowIndications, columnsAndValues, *task.rowOdd, *task.columnOdd, splitLevel, splitLevel, maxLevel, task.rowOffset, task.columnOffset, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+                }
+            });
+        }
+
+        template<typename ValueType>
+        void InternalAdd<DdType::Sylvan, ValueType>::collectMatrixConversionTasksRec(MTBDD dd, bool negated, Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentLevel, uint_fast64_t splitLevel, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset, uint_fast64_t rowPrefix, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, std::vector<std::vector<ConversionTask>>& taskLists) const {
+            // For the empty DD, we do not need to add any entries.
+            if (mtbdd_isleaf(dd) && mtbdd_iszero(dd)) {
+                return;
+            }
+
+            if (currentLevel == splitLevel) {
+                taskLists[rowPrefix].push_back({dd, negated, &rowOdd, &columnOdd, currentRowOffset, currentColumnOffset});
+            } else {
+                MTBDD elseElse;
+                MTBDD elseThen;
+                MTBDD thenElse;
+                MTBDD thenThen;
+
+                if (mtbdd_isleaf(dd) || ddColumnVariableIndices[currentLevel] < mtbdd_getvar(dd)) {
+                    elseElse = elseThen = thenElse = thenThen = dd;
+                } else if (ddRowVariableIndices[currentLevel] < mtbdd_getvar(dd)) {
+                    elseElse = thenElse = mtbdd_getlow(dd);
+                    elseThen = thenThen = mtbdd_gethigh(dd);
+                } else {
+                    MTBDD elseNode = mtbdd_getlow(dd);
+                    if (mtbdd_isleaf(elseNode) || ddColumnVariableIndices[currentLevel] < mtbdd_getvar(elseNode)) {
+                        elseElse = elseThen = elseNode;
+                    } else {
+                        elseElse = mtbdd_getlow(elseNode);
+                        elseThen = mtbdd_gethigh(elseNode);
+                    }
+
+                    MTBDD thenNode = mtbdd_gethigh(dd);
+                    if (mtbdd_isleaf(thenNode) || ddColumnVariableIndices[currentLevel] < mtbdd_getvar(thenNode)) {
+                        thenElse = thenThen = thenNode;
+                    } else {
+                        thenElse = mtbdd_getlow(thenNode);
+                        thenThen = mtbdd_gethigh(thenNode);
+                    }
+                }
+
+                // Visit the successors in the same order as the sequential conversion.
+                collectMatrixConversionTasksRec(mtbdd_regular(elseElse), mtbdd_hascomp(elseElse) ^ negated, rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(), currentLevel + 1, splitLevel, currentRowOffset, currentColumnOffset, rowPrefix << 1, ddRowVariableIndices, ddColumnVariableIndices, taskLists);
+                collectMatrixConversionTasksRec(mtbdd_regular(elseThen), mtbdd_hascomp(elseThen) ^ negated, rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(), currentLevel + 1, splitLevel, currentRowOffset, currentColumnOffset + columnOdd.getElseOffset(), rowPrefix << 1, ddRowVariableIndices, ddColumnVariableIndices, taskLists);
+                collectMatrixConversionTasksRec(mtbdd_regular(thenElse), mtbdd_hascomp(thenElse) ^ negated, rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(), currentLevel + 1, splitLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset, (rowPrefix << 1) | 1, ddRowVariableIndices, ddColumnVariableIndices, taskLists);
+                collectMatrixConversionTasksRec(mtbdd_regular(thenThen), mtbdd_hascomp(thenThen) ^ negated, rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(), currentLevel + 1, splitLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset + columnOdd.getElseOffset(), (rowPrefix << 1) | 1, ddRowVariableIndices, ddColumnVariableIndices, taskLists);
+            }
         }
 
         template<typename ValueType>
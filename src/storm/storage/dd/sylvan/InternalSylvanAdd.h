@@ -676,6 +676,71 @@ namespace storm {
              */
             static std::shared_ptr<Odd> createOddRec(BDD dd, uint_fast64_t currentLevel, uint_fast64_t maxLevel, std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<std::unordered_map<BDD, std::shared_ptr<Odd>>>& uniqueTableForLevels);
             
+            /*!
+             * A part of the conversion of the DD into explicit data structures that can be processed independently.
+             */
+            struct ConversionTask {
+                // The sub-DD to convert.
+                MTBDD dd;
+                
+                // A flag indicating whether the sub-DD is to be interpreted as negated.
+                bool negated;
+                
+                // The ODD used for the row translation of the sub-DD.
+                Odd const* rowOdd;
+                
+                // The ODD used for the column translation of the sub-DD (if any).
+                Odd const* columnOdd;
+                
+                // The offset of the first row of the sub-DD.
+                uint_fast64_t rowOffset;
+                
+                // The offset of the first column of the sub-DD.
+                uint_fast64_t columnOffset;
+            };
+            
+            /*!
+             * Retrieves the number of variable levels up to which the conversion is split into independent tasks.
+             * Conversions of exact values are always done sequentially.
+             *
+             * @param numberOfLevels The number of variable levels that can be used to split the conversion.
+             * @return The number of levels to split or zero if the conversion is to be done sequentially.
+             */
+            uint_fast64_t getConversionSplitLevel(uint_fast64_t numberOfLevels) const;
+            
+            /*!
+             * Splits the conversion of the DD into an explicit vector into independent tasks.
+             *
+             * @param dd The DD to split.
+             * @param currentLevel The currently considered level in the DD.
+             * @param splitLevel The level at which the tasks are created.
+             * @param currentOffset The current offset.
+             * @param odd The ODD used for the translation.
+             * @param ddVariableIndices The (sorted) indices of all DD variables that need to be considered.
+             * @param tasks The vector to which the tasks are added.
+             */
+            void collectVectorConversionTasksRec(MTBDD dd, uint_fast64_t currentLevel, uint_fast64_t splitLevel, uint_fast64_t currentOffset, Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<ConversionTask>& tasks) const;
+            
+            /*!
+             * Splits the conversion of the DD into an explicit matrix into independent tasks. Tasks of the same row
+             * prefix are added to the same task list in the order of their columns and need to be processed in that
+             * order, while the lists of different row prefixes cover disjoint rows.
+             *
+             * @param dd The DD to split.
+             * @param negated A flag indicating whether the DD is to be interpreted as negated.
+             * @param rowOdd The ODD used for the row translation.
+             * @param columnOdd The ODD used for the column translation.
+             * @param currentLevel The currently considered (row and column) level in the DD.
+             * @param splitLevel The level at which the tasks are created.
+             * @param currentRowOffset The current row offset.
+             * @param currentColumnOffset The current column offset.
+             * @param rowPrefix The row bits that were chosen on the way to the current level.
+             * @param ddRowVariableIndices The (sorted) indices of all DD row variables that need to be considered.
+             * @param ddColumnVariableIndices The (sorted) indices of all DD column variables that need to be considered.
+             * @param taskLists The task lists, one for each row prefix.
+             */
+            void collectMatrixConversionTasksRec(MTBDD dd, bool negated, Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentLevel, uint_fast64_t splitLevel, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset, uint_fast64_t rowPrefix, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, std::vector<std::vector<ConversionTask>>& taskLists) const;
+            
             /*!
              * Performs a recursive step for forEach.
              *
@@ -5,6 +5,7 @@
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/SylvanSettings.h"
+#include "storm/settings/modules/CoreSettings.h"
 
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
@@ -54,7 +55,7 @@ namespace storm {
             return 0;
         }
         
-        InternalDdManager<DdType::Sylvan>::InternalDdManager() {
+        InternalDdManager<DdType::Sylvan>::InternalDdManager() : numberOfConversionThreads(storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfDdConversionThreads()) {
             if (numberOfInstances == 0) {
                 storm::settings::modules::SylvanSettings const& settings = storm::settings::getModule<storm::settings::modules::SylvanSettings>();
                 if (settings.isNumberOfThreadsSet()) {
@@ -263,6 +264,14 @@ namespace storm {
             return nextFreeVariableIndex;
         }
         
+        uint_fast64_t InternalDdManager<DdType::Sylvan>::getNumberOfConversionThreads() const {
+            return numberOfConversionThreads;
+        }
+        
+        void InternalDdManager<DdType::Sylvan>::setNumberOfConversionThreads(uint_fast64_t numberOfThreads) {
+            numberOfConversionThreads = numberOfThreads;
+        }
+        
         template InternalAdd<DdType::Sylvan, double> InternalDdManager<DdType::Sylvan>::getAddUndefined() const;
         template InternalAdd<DdType::Sylvan, uint_fast64_t> InternalDdManager<DdType::Sylvan>::getAddUndefined() const;
         
@@ -139,6 +139,20 @@ namespace storm {
              */
             uint_fast64_t getNumberOfDdVariables() const;
             
+            /*!
+             * Retrieves the number of threads used to convert DDs into explicit matrices and vectors.
+             *
+             * @return The number of threads.
+             */
+            uint_fast64_t getNumberOfConversionThreads() const;
+            
+            /*!
+             * Sets the number of threads used to convert DDs into explicit matrices and vectors.
+             *
+             * @param numberOfThreads The number of threads.
+             */
+            void setNumberOfConversionThreads(uint_fast64_t numberOfThreads);
+            
         private:
             // Helper function to create the BDD whose encodings are below a given bound.
             BDD getBddEncodingLessOrEqualThanRec(uint64_t minimalValue, uint64_t maximalValue, uint64_t bound, BDD cube, uint64_t remainingDdVariables) const;
@@ -151,6 +165,9 @@ namespace storm {
             // The index of the next free variable index. This needs to be shared across all instances since the sylvan
             // manager is implicitly 'global'.
             static uint_fast64_t nextFreeVariableIndex;
+            
+            // The number of threads used to convert DDs into explicit matrices and vectors.
+            uint_fast64_t numberOfConversionThreads;
         };
         
         template<>
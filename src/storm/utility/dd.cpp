@@ -6,6 +6,7 @@
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 
+#include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
@@ -82,6 +83,18 @@ namespace storm {
                 return ddManager.getIdentity(rowColumnMetaVariablePairs, false);
             }
             
+            template <storm::dd::DdType Type, typename ValueType>
+            storm::dd::Add<Type, ValueType> roundToPrecision(storm::dd::Add<Type, ValueType> const& values, ValueType const& precision, ValueType& maximalDeviation) {
+                storm::dd::DdManager<Type> const& manager = values.getDdManager();
+                storm::dd::Add<Type, ValueType> precisionAdd = manager.getConstant(precision);
+                storm::dd::Add<Type, ValueType> half = manager.getConstant(storm::utility::convertNumber<ValueType>(0.5));
+                storm::dd::Add<Type, ValueType> result = ((values / precisionAdd) + half).floor() * precisionAdd;
+                
+                storm::dd::Add<Type, ValueType> difference = result - values;
+                maximalDeviation = storm::utility::max<ValueType>(difference.getMax(), -difference.getMin());
+                return result;
+            }
+            
             template std::pair<storm::dd::Bdd<storm::dd::DdType::CUDD>,uint64_t> computeReachableStates(storm::dd::Bdd<storm::dd::DdType::CUDD> const& initialStates, storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
             template std::pair<storm::dd::Bdd<storm::dd::DdType::Sylvan>, uint64_t> computeReachableStates(storm::dd::Bdd<storm::dd::DdType::Sylvan> const& initialStates, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
 
@@ -91,6 +104,13 @@ namespace storm {
             template storm::dd::Bdd<storm::dd::DdType::CUDD> getRowColumnDiagonal(storm::dd::DdManager<storm::dd::DdType::CUDD> const& ddManager, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
             template storm::dd::Bdd<storm::dd::DdType::Sylvan> getRowColumnDiagonal(storm::dd::DdManager<storm::dd::DdType::Sylvan> const& ddManager, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
 
+            template storm::dd::Add<storm::dd::DdType::CUDD, double> roundToPrecision(storm::dd::Add<storm::dd::DdType::CUDD, double> const& values, double const& precision, double& maximalDeviation);
+            template storm::dd::Add<storm::dd::DdType::Sylvan, double> roundToPrecision(storm::dd::Add<storm::dd::DdType::Sylvan, double> const& values, double const& precision, double& maximalDeviation);
+#ifdef STORM_HAVE_CARL
+            template storm::dd::Add<storm::dd::DdType::CUDD, storm::RationalNumber> roundToPrecision(storm::dd::Add<storm::dd::DdType::CUDD, storm::RationalNumber> const& values, storm::RationalNumber const& precision, storm::RationalNumber& maximalDeviation);
+            template storm::dd::Add<storm::dd::DdType::Sylvan, storm::RationalNumber> roundToPrecision(storm::dd::Add<storm::dd::DdType::Sylvan, storm::RationalNumber> const& values, storm::RationalNumber const& precision, storm::RationalNumber& maximalDeviation);
+#endif
+
         }
     }
 }
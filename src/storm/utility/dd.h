@@ -35,6 +35,19 @@ namespace storm {
 
             template <storm::dd::DdType Type>
             storm::dd::Bdd<Type> getRowColumnDiagonal(storm::dd::DdManager<Type> const& ddManager, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
+
+            /*!
+             * Rounds the values of the given ADD to the closest multiples of the given precision. Values that only
+             * differ in their last digits are thereby merged, which reduces the number of nodes of the ADD. For
+             * floating point values, the rounding itself is exact if the precision is a power of two.
+             *
+             * @param values The ADD whose values to round.
+             * @param precision The precision to round to.
+             * @param maximalDeviation Is set to the maximal absolute difference between the given and the rounded values.
+             * @return The ADD with the rounded values.
+             */
+            template <storm::dd::DdType Type, typename ValueType>
+            storm::dd::Add<Type, ValueType> roundToPrecision(storm::dd::Add<Type, ValueType> const& values, ValueType const& precision, ValueType& maximalDeviation);
                         
         }
     }
@@ -0,0 +1,64 @@
+#include "storm/utility/parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace storm {
+    namespace utility {
+        namespace parallel {
+            
+            namespace {
+                std::atomic<uint64_t> numberOfMatrixThreads(1);
+            }
+            
+            void parallelFor(uint64_t numberOfItems, uint64_t numberOfThreads, std::function<void (uint64_t)> const& function) {
+                uint64_t threads = std::max<uint64_t>(1, std::min<uint64_t>(numberOfThreads, numberOfItems));
+                if (threads == 1) {
+                    for (uint64_t item = 0; item < numberOfItems; ++item) {
+                        function(item);
+                    }
+                    return;
+                }
+                
+                std::atomic<uint64_t> nextItem(0);
+                std::atomic<bool> failed(false);
+                std::vector<std::exception_ptr> exceptions(threads);
+                auto processItems = [&](uint64_t thread) {
+                    try {
+                        for (uint64_t item = nextItem++; item < numberOfItems && !failed; item = nextItem++) {
+                            function(item);
+                        }
+                    } catch (...) {
+                        exceptions[thread] = std::current_exception();
+                        failed = true;
+                    }
+                };
+                std::vector<std::thread> workers;
+                for (uint64_t thread = 1; thread < threads; ++thread) {
+                    workers.emplace_back(processItems, thread);
+                }
+                processItems(0);
+                for (auto& worker : workers) {
+                    worker.join();
+                }
+                for (auto const& exception : exceptions) {
+                    if (exception) {
+                        std::rethrow_exception(exception);
+                    }
+                }
+            }
+            
+            void setNumberOfMatrixThreads(uint64_t numberOfThreads) {
+                numberOfMatrixThreads = std::max<uint64_t>(1, numberOfThreads);
+            }
+            
+            uint64_t getNumberOfMatrixThreads() {
+                return numberOfMatrixThreads;
+            }
+            
+        }
+    }
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+namespace storm {
+    namespace utility {
+        namespace parallel {
+            
+            /*!
+             * Calls the given function for all items from 0 to the given number of items (exclusive) using the given
+             * number of threads. The items are handed out dynamically, so items may take different amounts of time.
+             * If a call throws an exception, the remaining items are skipped and the exception is rethrown once all
+             * threads have finished.
+             *
+             * @param numberOfItems The number of items.
+             * @param numberOfThreads The number of threads to use (including the calling thread).
+             * @param function The function to call for each item. Calls for different items must not interfere.
+             */
+            void parallelFor(uint64_t numberOfItems, uint64_t numberOfThreads, std::function<void (uint64_t)> const& function);
+            
+            /*!
+             * Sets the number of threads used to transpose sparse matrices and to extract submatrices from them.
+             */
+            void setNumberOfMatrixThreads(uint64_t numberOfThreads);
+            
+            /*!
+             * Retrieves the number of threads used to transpose sparse matrices and to extract submatrices from them.
+             * By default, only one thread is used.
+             */
+            uint64_t getNumberOfMatrixThreads();
+            
+        }
+    }
+}
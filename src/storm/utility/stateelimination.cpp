@@ -1,6 +1,11 @@
 #include "storm/utility/stateelimination.h"
 
+#include <algorithm>
+#include <iterator>
+#include <numeric>
 #include <random>
+#include <set>
+#include <string>
 
 #include "storm/solver/stateelimination/StatePriorityQueue.h"
 #include "storm/solver/stateelimination/StaticStatePriorityQueue.h"
@@ -45,7 +50,10 @@ namespace storm {
             }
             
             bool eliminationOrderIsStatic(storm::settings::modules::EliminationSettings::EliminationOrder const& order) {
-                return eliminationOrderNeedsDistances(order) || order == storm::settings::modules::EliminationSettings::EliminationOrder::StaticPenalty;
+                return eliminationOrderNeedsDistances(order) || order == storm::settings::modules::EliminationSettings::EliminationOrder::StaticPenalty ||
+                order == storm::settings::modules::EliminationSettings::EliminationOrder::MinimumDegree ||
+                order == storm::settings::modules::EliminationSettings::EliminationOrder::NestedDissection ||
+                order == storm::settings::modules::EliminationSettings::EliminationOrder::LeastFillIn;
             }
             
             template<typename ValueType>
@@ -95,6 +103,302 @@ namespace storm {
                 return backwardTransitions.getRow(state).size() * transitionMatrix.getRow(state).size();
             }
             
+            /*!
+             * Computes the undirected support of the transition matrix restricted to the given states, i.e., two states are
+             * neighbours if there is a transition between them in either direction. Self-loops are ignored and the states
+             * are referred to by their index among the given states.
+             */
+            template<typename ValueType>
+            std::vector<std::vector<uint_fast64_t>> getUndirectedSupport(storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states) {
+                std::vector<uint_fast64_t> localIndices = states.getNumberOfSetBitsBeforeIndices();
+                std::vector<std::vector<uint_fast64_t>> neighbours;
+                neighbours.reserve(states.getNumberOfSetBits());
+                for (auto state : states) {
+                    std::vector<uint_fast64_t> stateNeighbours;
+                    for (auto const& entry : transitionMatrix.getRow(state)) {
+                        if (entry.getColumn() != state && states.get(entry.getColumn())) {
+                            stateNeighbours.push_back(localIndices[entry.getColumn()]);
+                        }
+                    }
+                    for (auto const& entry : backwardTransitions.getRow(state)) {
+                        if (entry.getColumn() != state && states.get(entry.getColumn())) {
+                            stateNeighbours.push_back(localIndices[entry.getColumn()]);
+                        }
+                    }
+                    std::sort(stateNeighbours.begin(), stateNeighbours.end());
+                    stateNeighbours.erase(std::unique(stateNeighbours.begin(), stateNeighbours.end()), stateNeighbours.end());
+                    neighbours.push_back(std::move(stateNeighbours));
+                }
+                return neighbours;
+            }
+            
+            template<typename ValueType>
+            std::vector<storm::storage::sparse::state_type> computeMinimumDegreeOrder(storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states) {
+                std::vector<std::vector<uint_fast64_t>> neighbours = getUndirectedSupport(transitionMatrix, backwardTransitions, states);
+                std::vector<storm::storage::sparse::state_type> globalStates(states.begin(), states.end());
+                
+                // The queue holds pairs of the current degree and the state.
+                std::set<std::pair<uint_fast64_t, uint_fast64_t>> queue;
+                for (uint_fast64_t state = 0; state < neighbours.size(); ++state) {
+                    queue.emplace(neighbours[state].size(), state);
+                }
+                
+                std::vector<storm::storage::sparse::state_type> order;
+                order.reserve(neighbours.size());
+                std::vector<uint_fast64_t> stateNeighbours;
+                std::vector<uint_fast64_t> mergeBuffer;
+                while (!queue.empty()) {
+                    uint_fast64_t state = queue.begin()->second;
+                    queue.erase(queue.begin());
+                    order.push_back(globalStates[state]);
+                    
+                    // Eliminating the state makes its neighbours pairwise adjacent.
+                    stateNeighbours.clear();
+                    stateNeighbours.swap(neighbours[state]);
+                    for (auto neighbour : stateNeighbours) {
+                        std::vector<uint_fast64_t>& neighbourNeighbours = neighbours[neighbour];
+                        queue.erase(std::make_pair(neighbourNeighbours.size(), neighbour));
+                        
+                        mergeBuffer.clear();
+                        std::set_union(neighbourNeighbours.begin(), neighbourNeighbours.end(), stateNeighbours.begin(), stateNeighbours.end(), std::back_inserter(mergeBuffer));
+                        mergeBuffer.erase(std::remove_if(mergeBuffer.begin(), mergeBuffer.end(), [state, neighbour] (uint_fast64_t const& other) { return other == state || other == neighbour; }), mergeBuffer.end());
+                        neighbourNeighbours.swap(mergeBuffer);
+                        
+                        queue.emplace(neighbourNeighbours.size(), neighbour);
+                    }
+                }
+                return order;
+            }
+            
+            /*!
+             * Helper to compute nested dissection orders on the undirected support of a matrix.
+             */
+            class NestedDissectionOrderComputer {
+            public:
+                NestedDissectionOrderComputer(std::vector<std::vector<uint_fast64_t>> const& neighbours) : neighbours(neighbours), labels(neighbours.size(), 0), levels(neighbours.size(), 0), marks(neighbours.size(), 0), currentMark(0), nextLabel(1) {
+                    order.reserve(neighbours.size());
+                }
+                
+                std::vector<uint_fast64_t> const& computeOrder() {
+                    std::vector<uint_fast64_t> allStates(neighbours.size());
+                    std::iota(allStates.begin(), allStates.end(), 0);
+                    dissect(allStates, 0);
+                    return order;
+                }
+                
+            private:
+                // Parts with at most this number of states are not split further.
+                static const uint_fast64_t maximalLeafSize = 16;
+                
+                /*!
+                 * Orders the given part by splitting each of its connected components.
+                 */
+                void dissect(std::vector<uint_fast64_t> const& part, uint_fast64_t label) {
+                    if (part.size() <= maximalLeafSize) {
+                        appendByDegree(part);
+                        return;
+                    }
+                    
+                    // First collect the connected components, as splitting a component invalidates the marks.
+                    uint_fast64_t componentMark = ++currentMark;
+                    std::vector<std::vector<uint_fast64_t>> components;
+                    for (auto state : part) {
+                        if (marks[state] != componentMark) {
+                            components.push_back(computeLevelStructure(state, label, componentMark));
+                        }
+                    }
+                    for (auto const& component : components) {
+                        dissectConnected(component, label);
+                    }
+                }
+                
+                /*!
+                 * Orders the given connected part by splitting it at the median level of a breadth-first level structure.
+                 */
+                void dissectConnected(std::vector<uint_fast64_t> const& component, uint_fast64_t label) {
+                    if (component.size() <= maximalLeafSize) {
+                        appendByDegree(component);
+                        return;
+                    }
+                    
+                    // Start the level structure from a pseudo-peripheral state to obtain many narrow levels.
+                    uint_fast64_t peripheralState = computeLevelStructure(component.front(), label, ++currentMark).back();
+                    std::vector<uint_fast64_t> reached = computeLevelStructure(peripheralState, label, ++currentMark);
+                    uint_fast64_t medianLevel = levels[reached[reached.size() / 2]];
+                    
+                    // Since edges only connect states of the same or adjacent levels, the median level separates the lower
+                    // levels from the higher ones.
+                    std::vector<uint_fast64_t> lowerPart, separator, upperPart;
+                    uint_fast64_t lowerLabel = nextLabel++;
+                    uint_fast64_t separatorLabel = nextLabel++;
+                    uint_fast64_t upperLabel = nextLabel++;
+                    for (auto state : reached) {
+                        if (levels[state] < medianLevel) {
+                            lowerPart.push_back(state);
+                            labels[state] = lowerLabel;
+                        } else if (levels[state] == medianLevel) {
+                            separator.push_back(state);
+                            labels[state] = separatorLabel;
+                        } else {
+                            upperPart.push_back(state);
+                            labels[state] = upperLabel;
+                        }
+                    }
+                    
+                    if (lowerPart.empty() && upperPart.empty()) {
+                        appendByDegree(separator);
+                        return;
+                    }
+                    dissect(lowerPart, lowerLabel);
+                    dissect(upperPart, upperLabel);
+                    appendByDegree(separator);
+                }
+                
+                /*!
+                 * Performs a breadth-first search from the given state through the states with the given label and marks all
+                 * reached states. The reached states are returned ordered by their level, which is stored in the levels.
+                 */
+                std::vector<uint_fast64_t> computeLevelStructure(uint_fast64_t start, uint_fast64_t label, uint_fast64_t mark) {
+                    std::vector<uint_fast64_t> reached = {start};
+                    marks[start] = mark;
+                    levels[start] = 0;
+                    for (uint_fast64_t index = 0; index < reached.size(); ++index) {
+                        uint_fast64_t state = reached[index];
+                        for (auto neighbour : neighbours[state]) {
+                            if (labels[neighbour] == label && marks[neighbour] != mark) {
+                                marks[neighbour] = mark;
+                                levels[neighbour] = levels[state] + 1;
+                                reached.push_back(neighbour);
+                            }
+                        }
+                    }
+                    return reached;
+                }
+                
+                /*!
+                 * Appends the given states to the order such that states with fewer neighbours come first.
+                 */
+                void appendByDegree(std::vector<uint_fast64_t> part) {
+                    std::stable_sort(part.begin(), part.end(), [this] (uint_fast64_t const& state1, uint_fast64_t const& state2) { return neighbours[state1].size() < neighbours[state2].size(); });
+                    order.insert(order.end(), part.begin(), part.end());
+                }
+                
+                std::vector<std::vector<uint_fast64_t>> const& neighbours;
+                
+                // The label of the part each state currently belongs to.
+                std::vector<uint_fast64_t> labels;
+                
+                // The level of each state in the last computed level structure.
+                std::vector<uint_fast64_t> levels;
+                
+                // Marks of the states visited by breadth-first searches.
+                std::vector<uint_fast64_t> marks;
+                uint_fast64_t currentMark;
+                
+                uint_fast64_t nextLabel;
+                
+                std::vector<uint_fast64_t> order;
+            };
+            
+            template<typename ValueType>
+            std::vector<storm::storage::sparse::state_type> computeNestedDissectionOrder(storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states) {
+                std::vector<std::vector<uint_fast64_t>> neighbours = getUndirectedSupport(transitionMatrix, backwardTransitions, states);
+                std::vector<storm::storage::sparse::state_type> globalStates(states.begin(), states.end());
+                
+                NestedDissectionOrderComputer computer(neighbours);
+                std::vector<storm::storage::sparse::state_type> order;
+                order.reserve(globalStates.size());
+                for (auto state : computer.computeOrder()) {
+                    order.push_back(globalStates[state]);
+                }
+                return order;
+            }
+            
+            template<typename ValueType>
+            uint_fast64_t estimateFillIn(storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, std::vector<storm::storage::sparse::state_type> const& order, uint_fast64_t limit) {
+                // Copy the structure of the matrix.
+                std::vector<std::vector<uint_fast64_t>> successors(transitionMatrix.getRowCount());
+                std::vector<std::vector<uint_fast64_t>> predecessors(backwardTransitions.getRowCount());
+                for (uint_fast64_t row = 0; row < successors.size(); ++row) {
+                    for (auto const& entry : transitionMatrix.getRow(row)) {
+                        successors[row].push_back(entry.getColumn());
+                    }
+                }
+                for (uint_fast64_t row = 0; row < predecessors.size(); ++row) {
+                    for (auto const& entry : backwardTransitions.getRow(row)) {
+                        predecessors[row].push_back(entry.getColumn());
+                    }
+                }
+                
+                uint_fast64_t fillIn = 0;
+                std::vector<uint_fast64_t> mergeBuffer;
+                for (auto state : order) {
+                    // Each predecessor inherits the successors of the eliminated state.
+                    for (auto predecessor : predecessors[state]) {
+                        if (predecessor == state) {
+                            continue;
+                        }
+                        std::vector<uint_fast64_t>& predecessorSuccessors = successors[predecessor];
+                        mergeBuffer.clear();
+                        auto first1 = predecessorSuccessors.begin(), last1 = predecessorSuccessors.end();
+                        auto first2 = successors[state].begin(), last2 = successors[state].end();
+                        while (first1 != last1 || first2 != last2) {
+                            if (first2 == last2 || (first1 != last1 && *first1 < *first2)) {
+                                if (*first1 != state) {
+                                    mergeBuffer.push_back(*first1);
+                                }
+                                ++first1;
+                            } else if (first1 == last1 || *first2 < *first1) {
+                                if (*first2 != state) {
+                                    // This is a new transition.
+                                    mergeBuffer.push_back(*first2);
+                                    std::vector<uint_fast64_t>& successorPredecessors = predecessors[*first2];
+                                    successorPredecessors.insert(std::lower_bound(successorPredecessors.begin(), successorPredecessors.end(), predecessor), predecessor);
+                                    ++fillIn;
+                                }
+                                ++first2;
+                            } else {
+                                if (*first1 != state) {
+                                    mergeBuffer.push_back(*first1);
+                                }
+                                ++first1;
+                                ++first2;
+                            }
+                        }
+                        predecessorSuccessors.swap(mergeBuffer);
+                    }
+                    
+                    // The eliminated state is no longer a predecessor of its successors.
+                    for (auto successor : successors[state]) {
+                        if (successor != state) {
+                            std::vector<uint_fast64_t>& successorPredecessors = predecessors[successor];
+                            auto it = std::lower_bound(successorPredecessors.begin(), successorPredecessors.end(), state);
+                            if (it != successorPredecessors.end() && *it == state) {
+                                successorPredecessors.erase(it);
+                            }
+                        }
+                    }
+                    std::vector<uint_fast64_t>().swap(successors[state]);
+                    std::vector<uint_fast64_t>().swap(predecessors[state]);
+                    
+                    if (fillIn > limit) {
+                        break;
+                    }
+                }
+                return fillIn;
+            }
+            
+            template<typename ValueType>
+            std::vector<std::pair<storm::storage::sparse::state_type, uint_fast64_t>> computeSortedStatePenalties(std::vector<storm::storage::sparse::state_type> const& states, storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& oneStepProbabilities, typename DynamicStatePriorityQueue<ValueType>::PenaltyFunctionType const& penaltyFunction) {
+                std::vector<std::pair<storm::storage::sparse::state_type, uint_fast64_t>> statePenalties(states.size());
+                for (uint_fast64_t index = 0; index < states.size(); ++index) {
+                    statePenalties[index] = std::make_pair(states[index], penaltyFunction(states[index], transitionMatrix, backwardTransitions, oneStepProbabilities));
+                }
+                
+                std::sort(statePenalties.begin(), statePenalties.end(), [] (std::pair<storm::storage::sparse::state_type, uint_fast64_t> const& statePenalty1, std::pair<storm::storage::sparse::state_type, uint_fast64_t> const& statePenalty2) { return statePenalty1.second < statePenalty2.second; } );
+                return statePenalties;
+            }
+            
             template<typename ValueType>
             std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities, storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& oneStepProbabilities, storm::storage::BitVector const& states) {
                 
@@ -115,14 +419,38 @@ namespace storm {
                         STORM_LOG_THROW(static_cast<bool>(distanceBasedStatePriorities), storm::exceptions::InvalidStateException, "Unable to build state priority queue without distance-based priorities.");
                         std::sort(sortedStates.begin(), sortedStates.end(), [&distanceBasedStatePriorities] (storm::storage::sparse::state_type const& state1, storm::storage::sparse::state_type const& state2) { return distanceBasedStatePriorities.get()[state1] < distanceBasedStatePriorities.get()[state2]; } );
                         return std::make_unique<StaticStatePriorityQueue>(sortedStates);
-                    } else if (eliminationOrderIsPenaltyBased(order)) {
-                        std::vector<std::pair<storm::storage::sparse::state_type, uint_fast64_t>> statePenalties(sortedStates.size());
-                        typename DynamicStatePriorityQueue<ValueType>::PenaltyFunctionType penaltyFunction = order == storm::settings::modules::EliminationSettings::EliminationOrder::RegularExpression ?  computeStatePenaltyRegularExpression<ValueType> : computeStatePenalty<ValueType>;
-                        for (uint_fast64_t index = 0; index < sortedStates.size(); ++index) {
-                            statePenalties[index] = std::make_pair(sortedStates[index], penaltyFunction(sortedStates[index], transitionMatrix, backwardTransitions, oneStepProbabilities));
+                    } else if (order == storm::settings::modules::EliminationSettings::EliminationOrder::MinimumDegree) {
+                        return std::make_unique<StaticStatePriorityQueue>(computeMinimumDegreeOrder(transitionMatrix, backwardTransitions, states));
+                    } else if (order == storm::settings::modules::EliminationSettings::EliminationOrder::NestedDissection) {
+                        return std::make_unique<StaticStatePriorityQueue>(computeNestedDissectionOrder(transitionMatrix, backwardTransitions, states));
+                    } else if (order == storm::settings::modules::EliminationSettings::EliminationOrder::LeastFillIn) {
+                        // Compute the candidate orders and pick the one with the least estimated fill-in.
+                        std::vector<std::pair<std::string, std::vector<storm::storage::sparse::state_type>>> candidates;
+                        candidates.emplace_back("nested dissection", computeNestedDissectionOrder(transitionMatrix, backwardTransitions, states));
+                        candidates.emplace_back("minimum degree", computeMinimumDegreeOrder(transitionMatrix, backwardTransitions, states));
+                        std::vector<storm::storage::sparse::state_type> staticPenaltyOrder;
+                        staticPenaltyOrder.reserve(sortedStates.size());
+                        for (auto const& statePenalty : computeSortedStatePenalties<ValueType>(sortedStates, transitionMatrix, backwardTransitions, oneStepProbabilities, computeStatePenalty<ValueType>)) {
+                            staticPenaltyOrder.push_back(statePenalty.first);
                         }
+                        candidates.emplace_back("static penalty", std::move(staticPenaltyOrder));
                         
-                        std::sort(statePenalties.begin(), statePenalties.end(), [] (std::pair<storm::storage::sparse::state_type, uint_fast64_t> const& statePenalty1, std::pair<storm::storage::sparse::state_type, uint_fast64_t> const& statePenalty2) { return statePenalty1.second < statePenalty2.second; } );
+                        uint_fast64_t bestCandidate = 0;
+                        uint_fast64_t bestFillIn = std::numeric_limits<uint_fast64_t>::max();
+                        for (uint_fast64_t index = 0; index < candidates.size(); ++index) {
+                            // Candidates whose fill-in exceeds the best one found so far are not estimated completely.
+                            uint_fast64_t fillIn = estimateFillIn(transitionMatrix, backwardTransitions, candidates[index].second, bestFillIn);
+                            STORM_LOG_DEBUG("Estimated fill-in of the " << candidates[index].first << " order: " << (fillIn > bestFillIn ? "more than " : "") << std::min(fillIn, bestFillIn) << ".");
+                            if (fillIn < bestFillIn) {
+                                bestCandidate = index;
+                                bestFillIn = fillIn;
+                            }
+                        }
+                        STORM_LOG_INFO("Eliminating " << sortedStates.size() << " states in " << candidates[bestCandidate].first << " order with an estimated fill-in of " << bestFillIn << " transitions.");
+                        return std::make_unique<StaticStatePriorityQueue>(candidates[bestCandidate].second);
+                    } else if (eliminationOrderIsPenaltyBased(order)) {
+                        typename DynamicStatePriorityQueue<ValueType>::PenaltyFunctionType penaltyFunction = order == storm::settings::modules::EliminationSettings::EliminationOrder::RegularExpression ?  computeStatePenaltyRegularExpression<ValueType> : computeStatePenalty<ValueType>;
+                        std::vector<std::pair<storm::storage::sparse::state_type, uint_fast64_t>> statePenalties = computeSortedStatePenalties(sortedStates, transitionMatrix, backwardTransitions, oneStepProbabilities, penaltyFunction);
                         
                         if (eliminationOrderIsStatic(order)) {
                             // For the static penalty version, we need to strip the penalties to create the queue.
@@ -196,6 +524,9 @@ namespace storm {
             }
             
             template uint_fast64_t estimateComplexity(double const& value);
+            template std::vector<storm::storage::sparse::state_type> computeMinimumDegreeOrder(storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& states);
+            template std::vector<storm::storage::sparse::state_type> computeNestedDissectionOrder(storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& states);
+            template uint_fast64_t estimateFillIn(storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions, std::vector<storm::storage::sparse::state_type> const& order, uint_fast64_t limit);
             template std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities, storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions, std::vector<double> const& oneStepProbabilities, storm::storage::BitVector const& states);
             template uint_fast64_t computeStatePenalty(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions, std::vector<double> const& oneStepProbabilities);
             template uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions, std::vector<double> const& oneStepProbabilities);
@@ -204,12 +535,18 @@ namespace storm {
             
 #ifdef STORM_HAVE_CARL
             template uint_fast64_t estimateComplexity(storm::RationalNumber const& value);
+            template std::vector<storm::storage::sparse::state_type> computeMinimumDegreeOrder(storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& states);
+            template std::vector<storm::storage::sparse::state_type> computeNestedDissectionOrder(storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& states);
+            template uint_fast64_t estimateFillIn(storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::storage::sparse::state_type> const& order, uint_fast64_t limit);
             template std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities, storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& oneStepProbabilities, storm::storage::BitVector const& states);
             template uint_fast64_t computeStatePenalty(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& oneStepProbabilities);
             template uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& oneStepProbabilities);
             template std::vector<uint_fast64_t> getDistanceBasedPriorities(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrixTransposed, storm::storage::BitVector const& initialStates, std::vector<storm::RationalNumber> const& oneStepProbabilities, bool forward, bool reverse);
             template std::vector<uint_fast64_t> getStateDistances(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrixTransposed, storm::storage::BitVector const& initialStates, std::vector<storm::RationalNumber> const& oneStepProbabilities, bool forward);
 
+            template std::vector<storm::storage::sparse::state_type> computeMinimumDegreeOrder(storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& states);
+            template std::vector<storm::storage::sparse::state_type> computeNestedDissectionOrder(storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& states);
+            template uint_fast64_t estimateFillIn(storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions, std::vector<storm::storage::sparse::state_type> const& order, uint_fast64_t limit);
             template std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities, storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions, std::vector<storm::RationalFunction> const& oneStepProbabilities, storm::storage::BitVector const& states);
             template uint_fast64_t computeStatePenalty(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions, std::vector<storm::RationalFunction> const& oneStepProbabilities);
             template uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions, std::vector<storm::RationalFunction> const& oneStepProbabilities);
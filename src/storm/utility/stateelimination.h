@@ -1,5 +1,6 @@
 #pragma once
 
+#include <limits>
 #include <memory>
 #include <vector>
 
@@ -56,6 +57,33 @@ namespace storm {
             template<typename ValueType>
             std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& stateDistances, storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& oneStepProbabilities, storm::storage::BitVector const& states);
             
+            /*!
+             * Computes a minimum degree order of the given states. The degrees are taken on the undirected support of the
+             * transition matrix restricted to the given states. Eliminating a state connects all its neighbours, so the
+             * degrees of the neighbours are updated after each step.
+             */
+            template<typename ValueType>
+            std::vector<storm::storage::sparse::state_type> computeMinimumDegreeOrder(storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states);
+            
+            /*!
+             * Computes a nested dissection order of the given states. The undirected support of the transition matrix
+             * restricted to the given states is recursively split by separators obtained from breadth-first level
+             * structures. The states of both parts are eliminated before the states of the separator, so that no fill-in
+             * is created between the parts.
+             */
+            template<typename ValueType>
+            std::vector<storm::storage::sparse::state_type> computeNestedDissectionOrder(storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states);
+            
+            /*!
+             * Estimates the number of transitions that are newly created when eliminating the states in the given order.
+             * Only the structure of the matrix is considered, i.e., no values are computed.
+             *
+             * @param limit The estimation stops as soon as the fill-in exceeds this limit.
+             * @return The fill-in or a value larger than the limit if the limit was exceeded.
+             */
+            template<typename ValueType>
+            uint_fast64_t estimateFillIn(storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, std::vector<storm::storage::sparse::state_type> const& order, uint_fast64_t limit = std::numeric_limits<uint_fast64_t>::max());
+            
             std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(storm::storage::BitVector const& states);
             std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(std::vector<storm::storage::sparse::state_type> const& states);
             
@@ -257,7 +257,51 @@ namespace storm {
                     element = storm::utility::one<T>() - element;
                 }
             }
-            
+
+            /*!
+             * Writes the given vectors into a single block vector in which the entries of all vectors belonging to the
+             * same index are stored consecutively, i.e., the i-th entry of the j-th vector is stored at position
+             * i * vectors.size() + j.
+             *
+             * @param vectors The vectors to interleave. They all need to have the same size.
+             * @param target The target vector. It is resized appropriately.
+             */
+            template<class T>
+            void interleaveVectors(std::vector<std::vector<T>> const& vectors, std::vector<T>& target) {
+                uint64_t const blockSize = vectors.size();
+                uint64_t const size = vectors.empty() ? 0 : vectors.front().size();
+                target.resize(size * blockSize);
+                for (uint64_t j = 0; j < blockSize; ++j) {
+                    STORM_LOG_ASSERT(vectors[j].size() == size, "Lengths of vectors does not match.");
+                    for (uint64_t i = 0; i < size; ++i) {
+                        target[i * blockSize + j] = vectors[j][i];
+                    }
+                }
+            }
+
+            /*!
+             * Splits a block vector (as produced by interleaveVectors) into its individual vectors.
+             *
+             * @param source The block vector.
+             * @param vectors The target vectors. The number of vectors determines the block size. Each vector is resized
+             * appropriately.
+             */
+            template<class T>
+            void deinterleaveVector(std::vector<T> const& source, std::vector<std::vector<T>>& vectors) {
+                uint64_t const blockSize = vectors.size();
+                if (blockSize == 0) {
+                    return;
+                }
+                STORM_LOG_ASSERT(source.size() % blockSize == 0, "Size of block vector is not a multiple of the block size.");
+                uint64_t const size = source.size() / blockSize;
+                for (uint64_t j = 0; j < blockSize; ++j) {
+                    vectors[j].resize(size);
+                    for (uint64_t i = 0; i < size; ++i) {
+                        vectors[j][i] = source[i * blockSize + j];
+                    }
+                }
+            }
+
             template<class T>
             void addFilteredVectorGroupsToGroupedVector(std::vector<T>& target, std::vector<T> const& source, storm::storage::BitVector const& filter, std::vector<uint_fast64_t> const& rowGroupIndices) {
                 auto targetIt = target.begin();
@@ -0,0 +1,80 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include <boost/optional.hpp>
+
+#include "storm-dft/api/storm-dft.h"
+#include "storm-gspn/builder/ExplicitGspnModelBuilder.h"
+#include "storm/api/builder.h"
+#include "storm/environment/Environment.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/csl/SparseMarkovAutomatonCslModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/jani/Model.h"
+
+namespace {
+
+    // Results of building the GSPN obtained from a DFT.
+    struct GspnModelData {
+        std::shared_ptr<storm::models::sparse::Model<double>> model;
+        double mttf;
+    };
+
+    // Computes the mean time to failure of the given Markov automaton.
+    double computeMTTF(std::shared_ptr<storm::models::sparse::Model<double>> const& model, std::shared_ptr<storm::logic::Formula const> const& failedFormula) {
+        auto ma = model->as<storm::models::sparse::MarkovAutomaton<double>>();
+        if (!ma->isClosed()) {
+            ma->close();
+        }
+        auto formula = std::make_shared<storm::logic::TimeOperatorFormula>(std::make_shared<storm::logic::EventuallyFormula>(failedFormula, storm::logic::FormulaContext::Time), storm::logic::OperatorInformation(storm::solver::OptimizationDirection::Minimize));
+        storm::modelchecker::SparseMarkovAutomatonCslModelChecker<storm::models::sparse::MarkovAutomaton<double>> checker(*ma);
+        std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(storm::Environment(), storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formula, true));
+        return result->asExplicitQuantitativeCheckResult<double>()[*ma->getInitialStates().begin()];
+    }
+
+    // Builds the GSPN of the given DFT natively and via the JANI translation.
+    std::pair<GspnModelData, GspnModelData> buildModels(std::string const& file) {
+        std::shared_ptr<storm::storage::DFT<double>> dft = storm::api::loadDFTGalileoFile<double>(file);
+        auto gspnAndToplevel = storm::api::transformToGSPN(*dft);
+        storm::gspn::GSPN const& gspn = *gspnAndToplevel.first;
+        auto const& manager = gspn.getExpressionManager();
+        storm::expressions::Expression failedExpression = manager->getVariable(gspn.getPlace(gspnAndToplevel.second)->getName()).getExpression() == manager->integer(1);
+
+        GspnModelData explicitData;
+        storm::builder::ExplicitGspnModelBuilder<double> explicitBuilder(gspn);
+        explicitData.model = explicitBuilder.build({{"failed", failedExpression}});
+        explicitData.mttf = computeMTTF(explicitData.model, std::make_shared<storm::logic::AtomicLabelFormula>("failed"));
+
+        GspnModelData janiData;
+        std::shared_ptr<storm::jani::Model> janiModel = storm::api::transformToJani(gspn, gspnAndToplevel.second);
+        auto failedFormula = std::make_shared<storm::logic::AtomicExpressionFormula>(failedExpression);
+        std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = {failedFormula};
+        janiData.model = storm::api::buildSparseModel<double>(*janiModel, formulas);
+        janiData.mttf = computeMTTF(janiData.model, failedFormula);
+        return std::make_pair(explicitData, janiData);
+    }
+
+    void compareModels(std::string const& file, boost::optional<double> const& expectedMTTF = boost::none) {
+        auto models = buildModels(file);
+        auto const& explicitModel = models.first.model;
+        auto const& janiModel = models.second.model;
+        EXPECT_EQ(janiModel->getType(), explicitModel->getType()) << file;
+        EXPECT_EQ(janiModel->getNumberOfStates(), explicitModel->getNumberOfStates()) << file;
+        EXPECT_EQ(janiModel->getNumberOfChoices(), explicitModel->getNumberOfChoices()) << file;
+        EXPECT_EQ(janiModel->getNumberOfTransitions(), explicitModel->getNumberOfTransitions()) << file;
+        EXPECT_FLOAT_EQ(models.second.mttf, models.first.mttf) << file;
+        if (expectedMTTF) {
+            EXPECT_FLOAT_EQ(expectedMTTF.get(), models.first.mttf) << file;
+        }
+    }
+
+    TEST(DftGspnModelBuildingTest, ExplicitBuilderMatchesJani) {
+        compareModels(STORM_TEST_RESOURCES_DIR "/dft/and.dft", 3);
+        compareModels(STORM_TEST_RESOURCES_DIR "/dft/or.dft", 1);
+        compareModels(STORM_TEST_RESOURCES_DIR "/dft/voting.dft", 5 / 3.0);
+        compareModels(STORM_TEST_RESOURCES_DIR "/dft/spare.dft");
+        compareModels(STORM_TEST_RESOURCES_DIR "/dft/fdep.dft");
+    }
+}
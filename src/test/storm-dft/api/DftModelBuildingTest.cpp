@@ -90,4 +90,35 @@ namespace {
         EXPECT_EQ(13ul, model->getNumberOfTransitions());
     }
 
+    TEST(DftModelBuildingTest, ApproximationStateMapping) {
+        // Initialize
+        std::string file = STORM_TEST_RESOURCES_DIR "/dft/hecs_3_2_2_np.dft";
+        std::shared_ptr<storm::storage::DFT<double>> dft = storm::api::loadDFTGalileoFile<double>(file);
+        EXPECT_TRUE(storm::api::isWellFormed(*dft).first);
+        std::map<size_t, std::vector<std::vector<size_t>>> emptySymmetry;
+        storm::storage::DFTIndependentSymmetries symmetries(emptySymmetry);
+        dft->setRelevantEvents(storm::utility::RelevantEvents{}, false);
+
+        storm::builder::ExplicitDFTModelBuilder<double> builder(*dft, symmetries);
+        builder.buildModel(0, 1.0, storm::builder::ApproximationHeuristic::DEPTH);
+        EXPECT_TRUE(builder.getPreviousStateMapping().empty());
+        uint64_t previousStates = builder.getModelApproximation(true, true)->getNumberOfStates();
+
+        // Refine and check that the previous states are mapped injectively into the refined model
+        builder.buildModel(1, 1.0, storm::builder::ApproximationHeuristic::DEPTH);
+        std::shared_ptr<storm::models::sparse::Model<double>> model = builder.getModelApproximation(true, true);
+        std::vector<uint32_t> const& mapping = builder.getPreviousStateMapping();
+        ASSERT_EQ(previousStates, mapping.size());
+        EXPECT_LE(previousStates, model->getNumberOfStates());
+        storm::storage::BitVector mappedStates(model->getNumberOfStates());
+        for (auto const& state : mapping) {
+            ASSERT_LT(state, model->getNumberOfStates());
+            EXPECT_FALSE(mappedStates.get(state));
+            mappedStates.set(state);
+        }
+        // Initial state keeps its index
+        uint64_t initialState = *model->getInitialStates().begin();
+        EXPECT_EQ(initialState, mapping[initialState]);
+    }
+
 }
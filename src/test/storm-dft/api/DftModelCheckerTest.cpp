@@ -12,6 +12,7 @@ namespace {
         bool useSR;
         bool useMod;
         bool useDC;
+        uint64_t threads;
     };
 
     class NoOptimizationsConfig {
@@ -19,7 +20,7 @@ namespace {
         typedef double ValueType;
 
         static DftAnalysisConfig createConfig() {
-            return DftAnalysisConfig{false, false, false};
+            return DftAnalysisConfig{false, false, false, 1};
         }
     };
 
@@ -28,7 +29,7 @@ namespace {
         typedef double ValueType;
 
         static DftAnalysisConfig createConfig() {
-            return DftAnalysisConfig{false, false, true};
+            return DftAnalysisConfig{false, false, true, 1};
         }
     };
 
@@ -37,7 +38,7 @@ namespace {
         typedef double ValueType;
 
         static DftAnalysisConfig createConfig() {
-            return DftAnalysisConfig{false, true, false};
+            return DftAnalysisConfig{false, true, false, 1};
         }
     };
 
@@ -46,7 +47,7 @@ namespace {
         typedef double ValueType;
 
         static DftAnalysisConfig createConfig() {
-            return DftAnalysisConfig{true, false, false};
+            return DftAnalysisConfig{true, false, false, 1};
         }
     };
 
@@ -55,7 +56,16 @@ namespace {
         typedef double ValueType;
 
         static DftAnalysisConfig createConfig() {
-            return DftAnalysisConfig{true, true, true};
+            return DftAnalysisConfig{true, true, true, 1};
+        }
+    };
+
+    class ParallelModularisationConfig {
+    public:
+        typedef double ValueType;
+
+        static DftAnalysisConfig createConfig() {
+            return DftAnalysisConfig{true, true, true, 4};
         }
     };
 
@@ -72,7 +82,7 @@ namespace {
             return config;
         }
 
-        double analyze(std::string const& file, std::string const& property) {
+        std::vector<double> analyzeAll(std::string const& file, std::string const& property) {
             // Load, build and prepare DFT
             storm::transformations::dft::DftTransformator<double> dftTransformator = storm::transformations::dft::DftTransformator<double>();
             std::shared_ptr<storm::storage::DFT<double>> dft = dftTransformator.transformBinaryFDEPs(*(storm::api::loadDFTGalileoFile<double>(file)));
@@ -89,8 +99,18 @@ namespace {
             storm::utility::RelevantEvents relevantEvents = storm::api::computeRelevantEvents<ValueType>(*dft, properties, relevantNames);
 
             // Perform model checking
-            typename storm::modelchecker::DFTModelChecker<double>::dft_results results = storm::api::analyzeDFT<double>(*dft, properties, config.useSR, config.useMod, relevantEvents, false);
-            return boost::get<double>(results[0]);
+            typename storm::modelchecker::DFTModelChecker<double>::dft_results results = storm::api::analyzeDFT<double>(*dft, properties, config.useSR, config.useMod, relevantEvents, false, 0.0,
+                                                                                                                                       storm::builder::ApproximationHeuristic::DEPTH, false,
+                                                                                                                                       storm::transformer::EliminationLabelBehavior::KeepLabels, false, config.threads);
+            std::vector<double> values;
+            for (auto const& result : results) {
+                values.push_back(boost::get<double>(result));
+            }
+            return values;
+        }
+
+        double analyze(std::string const& file, std::string const& property) {
+            return analyzeAll(file, property)[0];
         }
 
         double analyzeMTTF(std::string const& file) {
@@ -112,7 +132,8 @@ namespace {
             DontCareConfig,
             ModularisationConfig,
             SymmetryReductionConfig,
-            AllOptimizationsConfig
+            AllOptimizationsConfig,
+            ParallelModularisationConfig
         > TestingTypes;
 
     TYPED_TEST_SUITE(DftModelCheckerTest, TestingTypes,);
@@ -236,6 +257,22 @@ namespace {
         EXPECT_FLOAT_EQ(result, 0.3421934224);
     }
 
+    TYPED_TEST(DftModelCheckerTest, ReliabilityTimePoints) {
+        std::string file = STORM_TEST_RESOURCES_DIR "/dft/symmetry6.dft";
+        std::vector<double> timepoints = {0.5, 1.0, 2.0, 4.0};
+        std::string properties;
+        for (auto const& timepoint : timepoints) {
+            properties += "P=? [F<=" + std::to_string(timepoint) + " \"failed\"];";
+        }
+        // The time points are checked together but have to yield the same results as the individual properties
+        std::vector<double> results = this->analyzeAll(file, properties);
+        ASSERT_EQ(timepoints.size(), results.size());
+        for (size_t i = 0; i < timepoints.size(); ++i) {
+            EXPECT_NEAR(this->analyzeReliability(file, timepoints[i]), results[i], 1e-6);
+        }
+        EXPECT_FLOAT_EQ(results[1], 0.3421934224);
+    }
+
     TYPED_TEST(DftModelCheckerTest, HecsReliability) {
         if (!this->getConfig().useDC) {
             // Skip configurations because it takes too long
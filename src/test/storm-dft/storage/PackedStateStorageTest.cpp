@@ -0,0 +1,31 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm-dft/storage/PackedStateStorage.h"
+
+namespace {
+
+    TEST(PackedStateStorageTest, AddGetRemove) {
+        // Size which is not a multiple of 64
+        uint64_t size = 150;
+        storm::storage::PackedStateStorage storage(size);
+
+        storm::storage::BitVector first(size, {0, 63, 64, 149});
+        storm::storage::BitVector second(size, {1, 70, 128});
+        uint64_t firstSlot = storage.add(first);
+        uint64_t secondSlot = storage.add(second);
+        EXPECT_NE(firstSlot, secondSlot);
+        EXPECT_EQ(2ul, storage.size());
+        EXPECT_EQ(first, storage.get(firstSlot));
+        EXPECT_EQ(second, storage.get(secondSlot));
+
+        // Slot of removed state is reused
+        storage.remove(firstSlot);
+        EXPECT_EQ(1ul, storage.size());
+        storm::storage::BitVector third(size, true);
+        EXPECT_EQ(firstSlot, storage.add(third));
+        EXPECT_EQ(third, storage.get(firstSlot));
+        EXPECT_EQ(second, storage.get(secondSlot));
+    }
+
+}
@@ -160,3 +160,44 @@ TEST(AssumptionMakerTest, Casestudy1) {
     EXPECT_EQ("2", itr->first->getSecondOperand()->asVariableExpression().getVariable().getName());
     EXPECT_EQ(storm::expressions::BinaryRelationExpression::RelationType::Greater, itr->first->getRelationType());
 }
+
+TEST(AssumptionMakerTest, Casestudy1_parallel) {
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/casestudy1.pm";
+    std::string formulaAsString = "P=? [F s=3 ]";
+    std::string constantsAsString = "";
+
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, constantsAsString);
+    std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    auto simplifier = storm::transformer::SparseParametricDtmcSimplifier<storm::models::sparse::Dtmc<storm::RationalFunction>>(*model);
+    ASSERT_TRUE(simplifier.simplify(*(formulas[0])));
+    model = simplifier.getSimplifiedModel();
+    model = model->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    // Create the region
+    auto vars = storm::models::sparse::getProbabilityParameters(*model);
+    auto region = storm::api::parseRegion<storm::RationalFunction>("0.00001 <= p <= 0.999999", vars);
+
+    storm::storage::BitVector above(5);
+    above.set(3);
+    storm::storage::BitVector below(5);
+    below.set(4);
+
+    storm::storage::StronglyConnectedComponentDecompositionOptions options;
+    options.forceTopologicalSort();
+    auto decomposition = storm::storage::StronglyConnectedComponentDecomposition<storm::RationalFunction>(model->getTransitionMatrix(), options);
+    auto statesSorted = storm::utility::graph::getTopologicalSort(model->getTransitionMatrix());
+    auto order = std::shared_ptr<storm::analysis::Order>(new storm::analysis::Order(&above, &below, 5, decomposition, statesSorted));
+
+    // All three assumptions are validated at once, the result should be the same as in the sequential case
+    auto assumptionMaker = storm::analysis::AssumptionMaker<storm::RationalFunction, double>(model->getTransitionMatrix());
+    assumptionMaker.setNumberOfThreads(3);
+    auto result = assumptionMaker.createAndCheckAssumptions(1, 2, order, region);
+
+    EXPECT_EQ(1, result.size());
+    auto itr = result.begin();
+    EXPECT_EQ(storm::analysis::AssumptionStatus::VALID, itr->second);
+    EXPECT_EQ("1", itr->first->getFirstOperand()->asVariableExpression().getVariable().getName());
+    EXPECT_EQ("2", itr->first->getSecondOperand()->asVariableExpression().getVariable().getName());
+    EXPECT_EQ(storm::expressions::BinaryRelationExpression::RelationType::Greater, itr->first->getRelationType());
+}
@@ -90,6 +90,44 @@ TEST(OrderExtenderTest, Brp_without_bisimulation_on_model) {
     EXPECT_EQ(186ul, std::get<2>(criticalTuple));
 }
 
+TEST(OrderExtenderTest, Brp_without_bisimulation_order_cache) {
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P=? [F s=4 & i=N ]";
+    std::string constantsAsString = ""; //e.g. pL=0.9,TOACK=0.5
+
+    // Program and formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, constantsAsString);
+    std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    auto simplifier = storm::transformer::SparseParametricDtmcSimplifier<storm::models::sparse::Dtmc<storm::RationalFunction>>(*model);
+    ASSERT_TRUE(simplifier.simplify(*(formulas[0])));
+    model = simplifier.getSimplifiedModel();
+
+    auto vars = storm::models::sparse::getProbabilityParameters(*model);
+    auto region = storm::api::parseRegion<storm::RationalFunction>("0.00001 <= pK <= 0.999999, 0.00001 <= pL <= 0.999999", vars);
+    auto subRegion = storm::api::parseRegion<storm::RationalFunction>("0.1 <= pK <= 0.9, 0.1 <= pL <= 0.9", vars);
+    EXPECT_TRUE(region.isSubRegion(subRegion));
+    EXPECT_FALSE(subRegion.isSubRegion(region));
+
+    auto extender = storm::analysis::OrderExtender<storm::RationalFunction, double>(model, formulas[0]);
+    auto criticalTuple = extender.toOrder(region);
+    EXPECT_EQ(183ul, std::get<1>(criticalTuple));
+    EXPECT_EQ(186ul, std::get<2>(criticalTuple));
+    auto order = std::get<0>(criticalTuple);
+
+    // The order for the subregion starts from a copy of the order for the region
+    auto subCriticalTuple = extender.toOrder(subRegion);
+    auto subOrder = std::get<0>(subCriticalTuple);
+    EXPECT_NE(order, subOrder);
+    EXPECT_LE(order->getNumberOfDoneStates(), subOrder->getNumberOfDoneStates());
+    for (uint_fast64_t i = 0; i < model->getNumberOfStates(); ++i) {
+        if (order->contains(i)) {
+            EXPECT_TRUE(subOrder->contains(i));
+        }
+    }
+}
+
 TEST(OrderExtenderTest, Brp_with_bisimulation_on_matrix) {
     std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
     std::string formulaAsString = "P=? [F s=4 & i=N ]";
@@ -128,6 +128,33 @@ namespace {
         EXPECT_EQ(storm::modelchecker::RegionResult::AllViolated, regionChecker->analyzeRegion(this->env(), allVioRegion, storm::modelchecker::RegionResultHypothesis::Unknown,storm::modelchecker::RegionResult::Unknown, true));
     }
 
+    TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_ParallelRefinement) {
+        typedef typename TestFixture::ValueType ValueType;
+
+        std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+        std::string formulaAsString = "P<=0.84 [F s=5 ]";
+
+        // Program and formula
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+        std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+        auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+        auto region = storm::api::parseRegion<storm::RationalFunction>("0.1<=pL<=0.9,0.2<=pK<=0.95", modelParameters);
+
+        auto sequentialChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, storm::api::createTask<storm::RationalFunction>(formulas[0], true));
+        auto sequentialResult = sequentialChecker->performRegionRefinement(this->env(), region, storm::utility::zero<storm::RationalFunction>(), 3);
+
+        auto parallelChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, storm::api::createTask<storm::RationalFunction>(formulas[0], true));
+        parallelChecker->setRefinementThreads(4);
+        auto parallelResult = parallelChecker->performRegionRefinement(this->env(), region, storm::utility::zero<storm::RationalFunction>(), 3);
+
+        // Without a coverage threshold, the same regions are analyzed regardless of the order in which this happens.
+        EXPECT_EQ(sequentialResult->getRegionResults().size(), parallelResult->getRegionResults().size());
+        EXPECT_EQ(sequentialResult->getSatFraction(), parallelResult->getSatFraction());
+        EXPECT_EQ(sequentialResult->getUnsatFraction(), parallelResult->getUnsatFraction());
+    }
+
     TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Rew) {
         typedef typename TestFixture::ValueType ValueType;
         std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp_rewards16_2.pm";
@@ -0,0 +1,63 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_CARL
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include<carl/core/VariablePool.h>
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/GeneralSettings.h"
+
+#include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
+#include "storm/environment/Environment.h"
+#include "storm/api/storm.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+
+TEST(SparseInstantiationModelCheckerTest, ParallelSampling) {
+    carl::VariablePool::getInstance().clear();
+    
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P=? [F s=5 ]";
+    
+    // Program and formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program.checkValidity();
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    ASSERT_TRUE(formulas.size()==1);
+    // Parametric model
+    storm::generator::NextStateGeneratorOptions options(*formulas.front());
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> dtmc = storm::builder::ExplicitModelBuilder<storm::RationalFunction>(program, options).build()->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    
+    storm::RationalFunctionVariable const& pL = carl::VariablePool::getInstance().findVariableWithName("pL");
+    ASSERT_NE(pL, carl::Variable::NO_VARIABLE);
+    storm::RationalFunctionVariable const& pK = carl::VariablePool::getInstance().findVariableWithName("pK");
+    ASSERT_NE(pK, carl::Variable::NO_VARIABLE);
+    std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>> valuations;
+    for (double valueL : {0.6, 0.8, 1.0}) {
+        for (double valueK : {0.5, 0.7, 0.9}) {
+            valuations.emplace_back();
+            valuations.back()[pL] = storm::utility::convertNumber<storm::RationalFunctionCoefficient>(valueL);
+            valuations.back()[pK] = storm::utility::convertNumber<storm::RationalFunctionCoefficient>(valueK);
+        }
+    }
+    
+    storm::Environment env;
+    storm::modelchecker::CheckTask<storm::logic::Formula, storm::RationalFunction> task(*formulas.front(), true);
+    storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double> sequentialChecker(*dtmc);
+    sequentialChecker.specifyFormula(task);
+    storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double> parallelChecker(*dtmc);
+    parallelChecker.specifyFormula(task);
+    
+    std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> parallelResults = parallelChecker.checkValuations(env, valuations, 4);
+    ASSERT_EQ(valuations.size(), parallelResults.size());
+    uint64_t initialState = *dtmc->getInitialStates().begin();
+    for (uint64_t i = 0; i < valuations.size(); ++i) {
+        std::unique_ptr<storm::modelchecker::CheckResult> sequentialResult = sequentialChecker.check(env, valuations[i]);
+        EXPECT_NEAR(sequentialResult->asExplicitQuantitativeCheckResult<double>()[initialState], parallelResults[i]->asExplicitQuantitativeCheckResult<double>()[initialState], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+    }
+}
+
+#endif
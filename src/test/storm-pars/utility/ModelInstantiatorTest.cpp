@@ -139,6 +139,90 @@ TEST(ModelInstantiatorTest, BrpProb) {
     }
 }
 
+TEST(ModelInstantiatorTest, SupportPreservation) {
+    carl::VariablePool::getInstance().clear();
+    
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P=? [F s=5 ]";
+    
+    // Program and formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program.checkValidity();
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    ASSERT_TRUE(formulas.size()==1);
+    // Parametric model
+    storm::generator::NextStateGeneratorOptions options(*formulas.front());
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> dtmc = storm::builder::ExplicitModelBuilder<storm::RationalFunction>(program, options).build()->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    
+    storm::utility::ModelInstantiator<storm::models::sparse::Dtmc<storm::RationalFunction>, storm::models::sparse::Dtmc<double>> modelInstantiator(*dtmc);
+    
+    storm::RationalFunctionVariable const& pL = carl::VariablePool::getInstance().findVariableWithName("pL");
+    ASSERT_NE(pL, carl::Variable::NO_VARIABLE);
+    storm::RationalFunctionVariable const& pK = carl::VariablePool::getInstance().findVariableWithName("pK");
+    ASSERT_NE(pK, carl::Variable::NO_VARIABLE);
+    auto makeValuation = [&pL, &pK] (double valueL, double valueK) {
+        std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient> valuation;
+        valuation.insert(std::make_pair(pL, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(valueL)));
+        valuation.insert(std::make_pair(pK, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(valueK)));
+        return valuation;
+    };
+    
+    modelInstantiator.instantiate(makeValuation(0.8, 0.9));
+    EXPECT_FALSE(modelInstantiator.isSupportPreserved());
+    modelInstantiator.instantiate(makeValuation(0.7, 0.6));
+    EXPECT_TRUE(modelInstantiator.isSupportPreserved());
+    modelInstantiator.instantiate(makeValuation(1.0, 0.9));
+    EXPECT_FALSE(modelInstantiator.isSupportPreserved());
+    modelInstantiator.instantiate(makeValuation(1.0, 0.5));
+    EXPECT_TRUE(modelInstantiator.isSupportPreserved());
+    modelInstantiator.instantiate(makeValuation(0.5, 0.5));
+    EXPECT_FALSE(modelInstantiator.isSupportPreserved());
+}
+
+TEST(ModelInstantiatorTest, ChangingSupport) {
+    carl::VariablePool::getInstance().clear();
+    
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/parametric_die.pm";
+    std::string formulaAsString = "P=? [F s=7&d=1 ]";
+    
+    // Program and formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program.checkValidity();
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    ASSERT_TRUE(formulas.size()==1);
+    // Parametric model
+    storm::generator::NextStateGeneratorOptions options(*formulas.front());
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> dtmc = storm::builder::ExplicitModelBuilder<storm::RationalFunction>(program, options).build()->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    
+    storm::utility::ModelInstantiator<storm::models::sparse::Dtmc<storm::RationalFunction>, storm::models::sparse::Dtmc<double>> modelInstantiator(*dtmc);
+    
+    storm::RationalFunctionVariable const& p = carl::VariablePool::getInstance().findVariableWithName("p");
+    ASSERT_NE(p, carl::Variable::NO_VARIABLE);
+    auto makeValuation = [&p] (double value) {
+        std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient> valuation;
+        valuation.insert(std::make_pair(p, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(value)));
+        return valuation;
+    };
+    
+    // For p=0, the target is unreachable. Checking the instantiated model computes its backward transitions.
+    {
+        storm::models::sparse::Dtmc<double> const& instantiated(modelInstantiator.instantiate(makeValuation(0.0)));
+        storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<double>> modelchecker(instantiated);
+        std::unique_ptr<storm::modelchecker::CheckResult> chkResult = modelchecker.check(*formulas[0]);
+        EXPECT_NEAR(0.0, chkResult->asExplicitQuantitativeCheckResult<double>()[*instantiated.getInitialStates().begin()], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+    }
+    
+    // For p=0.5, the support is larger. The backward transitions must not be the ones of the previous instantiation.
+    {
+        storm::models::sparse::Dtmc<double> const& instantiated(modelInstantiator.instantiate(makeValuation(0.5)));
+        EXPECT_FALSE(modelInstantiator.isSupportPreserved());
+        EXPECT_EQ(instantiated.getTransitionMatrix().transpose(true), instantiated.getBackwardTransitions());
+        storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<double>> modelchecker(instantiated);
+        std::unique_ptr<storm::modelchecker::CheckResult> chkResult = modelchecker.check(*formulas[0]);
+        EXPECT_NEAR(1.0/6.0, chkResult->asExplicitQuantitativeCheckResult<double>()[*instantiated.getInitialStates().begin()], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+    }
+}
+
 TEST(ModelInstantiatorTest, Brp_Rew) {
     carl::VariablePool::getInstance().clear();
     
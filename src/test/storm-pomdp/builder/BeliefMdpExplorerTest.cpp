@@ -0,0 +1,123 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm-pomdp/builder/BeliefMdpExplorer.h"
+#include "storm-pomdp/analysis/FormulaInformation.h"
+#include "storm-pomdp/modelchecker/TrivialPomdpValueBoundsModelChecker.h"
+#include "storm-pomdp/transformer/MakePOMDPCanonic.h"
+#include "storm/api/storm.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/EigenSolverEnvironment.h"
+
+namespace {
+    typedef storm::models::sparse::Pomdp<double> PomdpType;
+    typedef storm::storage::BeliefManager<PomdpType> BeliefManagerType;
+    typedef storm::builder::BeliefMdpExplorer<PomdpType> ExplorerType;
+
+    storm::Environment createValueIterationEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+        return env;
+    }
+
+    storm::Environment createPolicyIterationEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::PolicyIteration);
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Eigen);
+        env.solver().eigen().setMethod(storm::solver::EigenLinearEquationSolverMethod::SparseLU);
+        return env;
+    }
+
+    // Explores the belief MDP (without discretization) until the given number of states is reached. The remaining beliefs are truncated using the lower or upper value bounds.
+    // If the exploration is refined, the behavior of states that were already explored is restored.
+    void explore(ExplorerType& explorer, BeliefManagerType& beliefManager, std::set<uint32_t> const& targetObservations, bool min, bool refine, uint64_t sizeThreshold) {
+        if (refine) {
+            explorer.restartExploration();
+        } else {
+            explorer.startNewExploration(storm::utility::one<double>(), storm::utility::zero<double>());
+        }
+        while (explorer.hasUnexploredState()) {
+            uint64_t currId = explorer.exploreNextState();
+            bool stateAlreadyExplored = refine && explorer.currentStateHasOldBehavior() && !explorer.getCurrentStateWasTruncated();
+            if (targetObservations.count(beliefManager.getBeliefObservation(currId)) != 0) {
+                explorer.setCurrentStateIsTarget();
+                explorer.addSelfloopTransition();
+                continue;
+            }
+            bool stopExploration = !stateAlreadyExplored && explorer.getCurrentNumberOfMdpStates() >= sizeThreshold;
+            if (stopExploration) {
+                explorer.setCurrentStateIsTruncated();
+            }
+            for (uint64_t action = 0, numActions = beliefManager.getBeliefNumberOfChoices(currId); action < numActions; ++action) {
+                if (stateAlreadyExplored) {
+                    explorer.restoreOldBehaviorAtCurrentState(action);
+                    continue;
+                }
+                double truncationProbability = storm::utility::zero<double>();
+                double truncationValueBound = storm::utility::zero<double>();
+                for (auto const& successor : beliefManager.expand(currId, action)) {
+                    if (!explorer.addTransitionToBelief(action, successor.first, successor.second, stopExploration)) {
+                        truncationProbability += successor.second;
+                        truncationValueBound += successor.second * (min ? explorer.computeUpperValueBoundAtBelief(successor.first) : explorer.computeLowerValueBoundAtBelief(successor.first));
+                    }
+                }
+                if (stopExploration) {
+                    explorer.addTransitionsToExtraStates(action, truncationValueBound, truncationProbability - truncationValueBound);
+                }
+            }
+        }
+        explorer.finishExploration();
+    }
+
+    // Explores the belief MDP of the given POMDP with increasing size thresholds. The values that are obtained incrementally (i.e., only for the states that can
+    // reach a changed state) have to coincide with the values obtained by checking the whole explored MDP.
+    void checkIncrementalValues(storm::Environment const& env, std::string const& programFile, std::string const& formulaAsString, std::string const& constantsAsString) {
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        program = storm::utility::prism::preprocess(program, constantsAsString);
+        std::shared_ptr<storm::logic::Formula const> formula = storm::api::parsePropertiesForPrismProgram(formulaAsString, program).front().getRawFormula();
+        std::shared_ptr<PomdpType> pomdp = storm::api::buildSparseModel<double>(program, {formula})->as<PomdpType>();
+        pomdp = storm::transformer::MakePOMDPCanonic<double>(*pomdp).transform();
+
+        auto formulaInfo = storm::pomdp::analysis::getFormulaInformation(*pomdp, *formula);
+        ASSERT_TRUE(formulaInfo.isNonNestedReachabilityProbability());
+        ASSERT_TRUE(formulaInfo.getTargetStates().observationClosed);
+        auto valueBounds = storm::pomdp::modelchecker::TrivialPomdpValueBoundsModelChecker<PomdpType>(*pomdp).getValueBounds(*formula, formulaInfo);
+        auto beliefManager = std::make_shared<BeliefManagerType>(*pomdp, 1e-9, BeliefManagerType::TriangulationMode::Static);
+        ExplorerType explorer(beliefManager, valueBounds);
+        storm::solver::OptimizationDirection direction = formulaInfo.minimize() ? storm::solver::OptimizationDirection::Minimize : storm::solver::OptimizationDirection::Maximize;
+        std::shared_ptr<storm::logic::Formula const> exploredMdpFormula = storm::api::extractFormulasFromProperties(storm::api::parseProperties(formulaInfo.minimize() ? "Pmin=? [F \"target\"]" : "Pmax=? [F \"target\"]")).front();
+
+        bool refine = false;
+        for (uint64_t sizeThreshold : {10ull, 20ull, 20ull, 50ull}) {
+            explore(explorer, *beliefManager, formulaInfo.getTargetStates().observations, formulaInfo.minimize(), refine, sizeThreshold);
+            refine = true;
+            explorer.computeValuesOfExploredMdp(env, direction);
+            ASSERT_TRUE(explorer.hasComputedValues());
+
+            std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<double>(env, explorer.getExploredMdp(), storm::api::createTask<double>(exploredMdpFormula, false));
+            std::vector<double> const& expectedValues = result->asExplicitQuantitativeCheckResult<double>().getValueVector();
+            std::vector<double> const& values = explorer.getValuesOfExploredMdp();
+            ASSERT_EQ(expectedValues.size(), values.size());
+            for (uint64_t state = 0; state < values.size(); ++state) {
+                EXPECT_NEAR(expectedValues[state], values[state], 1e-6) << "State " << state << " with size threshold " << sizeThreshold << ".";
+            }
+        }
+    }
+
+    TEST(BeliefMdpExplorerTest, IncrementalValues_VI) {
+        storm::Environment env = createValueIterationEnvironment();
+        checkIncrementalValues(env, STORM_TEST_RESOURCES_DIR "/pomdp/refuel.prism", "Pmax=?[\"notbad\" U \"goal\"]", "N=4");
+        checkIncrementalValues(env, STORM_TEST_RESOURCES_DIR "/pomdp/refuel.prism", "Pmin=?[\"notbad\" U \"goal\"]", "N=4");
+    }
+
+    TEST(BeliefMdpExplorerTest, IncrementalValues_PI) {
+        // With policy iteration, the scheduler of the previous check is used as a hint.
+        storm::Environment env = createPolicyIterationEnvironment();
+        checkIncrementalValues(env, STORM_TEST_RESOURCES_DIR "/pomdp/refuel.prism", "Pmax=?[\"notbad\" U \"goal\"]", "N=4");
+        checkIncrementalValues(env, STORM_TEST_RESOURCES_DIR "/pomdp/refuel.prism", "Pmin=?[\"notbad\" U \"goal\"]", "N=4");
+    }
+}
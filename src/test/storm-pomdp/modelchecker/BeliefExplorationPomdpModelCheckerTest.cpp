@@ -123,6 +123,21 @@ namespace {
         static void adaptOptions(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) {options.refine = true; options.refinePrecision = precision();}
     };
     
+    class ParallelRefineDoubleVIEnvironment {
+    public:
+        typedef double ValueType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+            return env;
+        }
+        static bool const isExactModelChecking = false;
+        static ValueType precision() { return storm::utility::convertNumber<ValueType>(0.005); }
+        static PreprocessingType const preprocessingType = PreprocessingType::None;
+        static void adaptOptions(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) {options.refine = true; options.refinePrecision = precision(); options.explorationThreads = 4; options.explorationBatchSize = 8;}
+    };
+    
     class DefaultDoubleOVIEnvironment {
     public:
         typedef double ValueType;
@@ -241,6 +256,7 @@ namespace {
             FineDoubleVIEnvironment,
             RefineDoubleVIEnvironment,
             PreprocessedRefineDoubleVIEnvironment,
+            ParallelRefineDoubleVIEnvironment,
             DefaultDoubleOVIEnvironment,
             DefaultRationalPIEnvironment,
             PreprocessedDefaultRationalPIEnvironment
@@ -253,7 +269,7 @@ namespace {
 
         auto data = this->buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "Pmax=? [F \"goal\" ]", "slippery=0");
         storm::pomdp::modelchecker::BeliefExplorationPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> checker(data.model, this->options());
-        auto result = checker.check(*data.formula);
+        auto result = checker.check(this->env(), *data.formula);
         
         ValueType expected = this->parseNumber("7/10");
         EXPECT_LE(result.lowerBound, expected + this->modelcheckingPrecision());
@@ -266,7 +282,7 @@ namespace {
 
         auto data = this->buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "Pmin=? [F \"goal\" ]", "slippery=0");
         storm::pomdp::modelchecker::BeliefExplorationPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> checker(data.model, this->options());
-        auto result = checker.check(*data.formula);
+        auto result = checker.check(this->env(), *data.formula);
         
         ValueType expected = this->parseNumber("3/10");
         EXPECT_LE(result.lowerBound, expected + this->modelcheckingPrecision());
@@ -279,7 +295,7 @@ namespace {
 
         auto data = this->buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "Pmax=? [F \"goal\" ]", "slippery=0.4");
         storm::pomdp::modelchecker::BeliefExplorationPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> checker(data.model, this->options());
-        auto result = checker.check(*data.formula);
+        auto result = checker.check(this->env(), *data.formula);
         
         ValueType expected = this->parseNumber("7/10");
         EXPECT_LE(result.lowerBound, expected + this->modelcheckingPrecision());
@@ -292,7 +308,7 @@ namespace {
 
         auto data = this->buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "Pmin=? [F \"goal\" ]", "slippery=0.4");
         storm::pomdp::modelchecker::BeliefExplorationPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> checker(data.model, this->options());
-        auto result = checker.check(*data.formula);
+        auto result = checker.check(this->env(), *data.formula);
         
         ValueType expected = this->parseNumber("3/10");
         EXPECT_LE(result.lowerBound, expected + this->modelcheckingPrecision());
@@ -305,7 +321,7 @@ namespace {
 
         auto data = this->buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "Rmax=? [F s>4 ]", "slippery=0");
         storm::pomdp::modelchecker::BeliefExplorationPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> checker(data.model, this->options());
-        auto result = checker.check(*data.formula);
+        auto result = checker.check(this->env(), *data.formula);
         
         ValueType expected = this->parseNumber("29/50");
         EXPECT_LE(result.lowerBound, expected + this->modelcheckingPrecision());
@@ -318,7 +334,7 @@ namespace {
 
         auto data = this->buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "Rmin=? [F s>4 ]", "slippery=0");
         storm::pomdp::modelchecker::BeliefExplorationPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> checker(data.model, this->options());
-        auto result = checker.check(*data.formula);
+        auto result = checker.check(this->env(), *data.formula);
         
         ValueType expected = this->parseNumber("19/50");
         EXPECT_LE(result.lowerBound, expected + this->modelcheckingPrecision());
@@ -331,7 +347,7 @@ namespace {
 
         auto data = this->buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "Rmax=? [F s>4 ]", "slippery=0.4");
         storm::pomdp::modelchecker::BeliefExplorationPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> checker(data.model, this->options());
-        auto result = checker.check(*data.formula);
+        auto result = checker.check(this->env(), *data.formula);
         
         ValueType expected = this->parseNumber("29/30");
         EXPECT_LE(result.lowerBound, expected + this->modelcheckingPrecision());
@@ -344,7 +360,7 @@ namespace {
 
         auto data = this->buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "Rmin=? [F s>4 ]", "slippery=0.4");
         storm::pomdp::modelchecker::BeliefExplorationPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> checker(data.model, this->options());
-        auto result = checker.check(*data.formula);
+        auto result = checker.check(this->env(), *data.formula);
         
         ValueType expected = this->parseNumber("19/30");
         EXPECT_LE(result.lowerBound, expected + this->modelcheckingPrecision());
@@ -357,7 +373,7 @@ namespace {
 
         auto data = this->buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "R[exp]min=? [F \"goal\"]", "sl=0");
         storm::pomdp::modelchecker::BeliefExplorationPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> checker(data.model, this->options());
-        auto result = checker.check(*data.formula);
+        auto result = checker.check(this->env(), *data.formula);
         
         ValueType expected = this->parseNumber("74/91");
         EXPECT_LE(result.lowerBound, expected + this->modelcheckingPrecision());
@@ -371,7 +387,7 @@ namespace {
 
         auto data = this->buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "R[exp]max=? [F \"goal\"]", "sl=0");
         storm::pomdp::modelchecker::BeliefExplorationPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> checker(data.model, this->options());
-        auto result = checker.check(*data.formula);
+        auto result = checker.check(this->env(), *data.formula);
         
         EXPECT_TRUE(storm::utility::isInfinity(result.lowerBound));
         EXPECT_TRUE(storm::utility::isInfinity(result.upperBound));
@@ -382,7 +398,7 @@ namespace {
 
         auto data = this->buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "R[exp]min=? [F \"goal\"]", "sl=0.075");
         storm::pomdp::modelchecker::BeliefExplorationPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> checker(data.model, this->options());
-        auto result = checker.check(*data.formula);
+        auto result = checker.check(this->env(), *data.formula);
         
         ValueType expected = this->parseNumber("80/91");
         EXPECT_LE(result.lowerBound, expected + this->modelcheckingPrecision());
@@ -396,7 +412,7 @@ namespace {
 
         auto data = this->buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "R[exp]max=? [F \"goal\"]", "sl=0.075");
         storm::pomdp::modelchecker::BeliefExplorationPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> checker(data.model, this->options());
-        auto result = checker.check(*data.formula);
+        auto result = checker.check(this->env(), *data.formula);
         
         EXPECT_TRUE(storm::utility::isInfinity(result.lowerBound));
         EXPECT_TRUE(storm::utility::isInfinity(result.upperBound));
@@ -407,7 +423,7 @@ namespace {
 
         auto data = this->buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/refuel.prism", "Pmax=?[\"notbad\" U \"goal\"]", "N=4");
         storm::pomdp::modelchecker::BeliefExplorationPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> checker(data.model, this->options());
-        auto result = checker.check(*data.formula);
+        auto result = checker.check(this->env(), *data.formula);
         
         ValueType expected = this->parseNumber("38/155");
         EXPECT_LE(result.lowerBound, expected + this->modelcheckingPrecision());
@@ -421,7 +437,7 @@ namespace {
 
         auto data = this->buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/refuel.prism", "Pmin=?[\"notbad\" U \"goal\"]", "N=4");
         storm::pomdp::modelchecker::BeliefExplorationPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> checker(data.model, this->options());
-        auto result = checker.check(*data.formula);
+        auto result = checker.check(this->env(), *data.formula);
         
         ValueType expected = this->parseNumber("0");
         EXPECT_LE(result.lowerBound, expected + this->modelcheckingPrecision());
@@ -12,6 +12,11 @@
 #include "storm/models/symbolic/StandardRewardModel.h"
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/builder/DdJaniModelBuilder.h"
+#include "storm/builder/DdVariableOrder.h"
+#include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/DdMetaVariable.h"
+#include "storm/storage/jani/Model.h"
+#include "storm/storage/jani/Automaton.h"
 
 #include "storm/settings/SettingMemento.h"
 #include "storm/settings/SettingsManager.h"
@@ -663,3 +668,131 @@ TEST(DdJaniModelBuilderTest_Sylvan, InputEnabling) {
     EXPECT_EQ(4ul, model->getNumberOfStates());
     EXPECT_EQ(5ul, model->getNumberOfTransitions());
 }
+
+namespace {
+    // The declaration order separates the variables that are updated together, such that FORCE has to change it.
+    std::string const forceOrderProgram = R"(mdp
+module main
+    a : bool init false;
+    b : bool init false;
+    c : bool init false;
+    d : bool init false;
+    [] a=c -> (a'=!a);
+    [] a!=c -> (c'=!c);
+    [] b=d -> (b'=!b);
+    [] b!=d -> (d'=!d);
+endmodule
+)";
+
+    // Retrieves the names of the (row) meta variables of the given model in the order of their DD variables.
+    template<storm::dd::DdType Type>
+    std::vector<std::string> getMetaVariableOrder(storm::models::symbolic::Model<Type> const& model) {
+        std::vector<storm::expressions::Variable> variables(model.getRowVariables().begin(), model.getRowVariables().end());
+        std::sort(variables.begin(), variables.end(), [&model] (storm::expressions::Variable const& a, storm::expressions::Variable const& b) {
+            return model.getManager().getMetaVariable(a).getLowestIndex() < model.getManager().getMetaVariable(b).getLowestIndex();
+        });
+        std::vector<std::string> result;
+        for (auto const& variable : variables) {
+            result.push_back(variable.getName());
+        }
+        return result;
+    }
+
+    // Retrieves the names of the meta variables that the builder creates for the given variables of the given model.
+    std::vector<std::string> getMetaVariableNames(storm::jani::Model const& model, std::vector<storm::expressions::Variable> const& variables) {
+        std::map<storm::expressions::Variable, std::string> locationVariableToName;
+        for (auto const& automaton : model.getAutomata()) {
+            locationVariableToName.emplace(automaton.getLocationExpressionVariable(), "l_" + automaton.getName());
+        }
+        std::vector<std::string> result;
+        for (auto const& variable : variables) {
+            auto it = locationVariableToName.find(variable);
+            result.push_back(it == locationVariableToName.end() ? variable.getName() : it->second);
+        }
+        return result;
+    }
+}
+
+TEST(DdJaniModelBuilderTest_Sylvan, ForceVariableOrder) {
+    std::vector<std::string> names = {STORM_TEST_RESOURCES_DIR "/dtmc/leader-3-5.pm", STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm", STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.sm"};
+    std::vector<storm::jani::Model> models;
+    for (std::string const& file : names) {
+        models.push_back(storm::storage::SymbolicModelDescription(storm::parser::PrismParser::parse(file)).toJani(true).preprocess().asJaniModel());
+    }
+    names.push_back("force order program");
+    models.push_back(storm::storage::SymbolicModelDescription(storm::parser::PrismParser::parseFromString(forceOrderProgram, names.back())).toJani(true).preprocess().asJaniModel());
+    
+    bool orderChanged = false;
+    for (uint64_t i = 0; i < models.size(); ++i) {
+        storm::jani::Model const& model = models[i];
+        std::string const& file = names[i];
+        storm::builder::DdJaniModelBuilder<storm::dd::DdType::Sylvan, double> builder;
+        storm::builder::DdJaniModelBuilder<storm::dd::DdType::Sylvan, double>::Options options;
+        std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> declarationModel = builder.build(model, options);
+        std::vector<storm::expressions::Variable> declarationOrder = storm::builder::computeDdVariableOrder(model, storm::builder::DdVariableOrderHeuristic::Declaration);
+        EXPECT_EQ(getMetaVariableNames(model, declarationOrder), getMetaVariableOrder(*declarationModel)) << file;
+        
+        options.variableOrderHeuristic = storm::builder::DdVariableOrderHeuristic::Force;
+        std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> forceModel = builder.build(model, options);
+        std::vector<storm::expressions::Variable> forceOrder = storm::builder::computeDdVariableOrder(model, storm::builder::DdVariableOrderHeuristic::Force);
+        EXPECT_EQ(getMetaVariableNames(model, forceOrder), getMetaVariableOrder(*forceModel)) << file;
+        orderChanged |= forceOrder != declarationOrder;
+        EXPECT_EQ(declarationModel->getNumberOfStates(), forceModel->getNumberOfStates()) << file;
+        EXPECT_EQ(declarationModel->getNumberOfTransitions(), forceModel->getNumberOfTransitions()) << file;
+        
+        // A given order that matches the variables takes precedence over the heuristic.
+        std::vector<storm::expressions::Variable> reversedVariables(declarationOrder.rbegin(), declarationOrder.rend());
+        std::vector<std::string> reversedOrder;
+        for (auto const& variable : reversedVariables) {
+            reversedOrder.push_back(variable.getName());
+        }
+        options.variableOrder = reversedOrder;
+        std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> reversedModel = builder.build(model, options);
+        EXPECT_EQ(getMetaVariableNames(model, reversedVariables), getMetaVariableOrder(*reversedModel)) << file;
+        EXPECT_EQ(declarationModel->getNumberOfStates(), reversedModel->getNumberOfStates()) << file;
+        EXPECT_EQ(declarationModel->getNumberOfTransitions(), reversedModel->getNumberOfTransitions()) << file;
+    }
+    EXPECT_TRUE(orderChanged);
+}
+
+TEST(DdJaniModelBuilderTest_Cudd, ForceVariableOrder) {
+    std::vector<std::string> names = {STORM_TEST_RESOURCES_DIR "/dtmc/leader-3-5.pm", STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm", STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.sm"};
+    std::vector<storm::jani::Model> models;
+    for (std::string const& file : names) {
+        models.push_back(storm::storage::SymbolicModelDescription(storm::parser::PrismParser::parse(file)).toJani(true).preprocess().asJaniModel());
+    }
+    names.push_back("force order program");
+    models.push_back(storm::storage::SymbolicModelDescription(storm::parser::PrismParser::parseFromString(forceOrderProgram, names.back())).toJani(true).preprocess().asJaniModel());
+    
+    bool orderChanged = false;
+    for (uint64_t i = 0; i < models.size(); ++i) {
+        storm::jani::Model const& model = models[i];
+        std::string const& file = names[i];
+        storm::builder::DdJaniModelBuilder<storm::dd::DdType::CUDD, double> builder;
+        storm::builder::DdJaniModelBuilder<storm::dd::DdType::CUDD, double>::Options options;
+        std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD>> declarationModel = builder.build(model, options);
+        std::vector<storm::expressions::Variable> declarationOrder = storm::builder::computeDdVariableOrder(model, storm::builder::DdVariableOrderHeuristic::Declaration);
+        EXPECT_EQ(getMetaVariableNames(model, declarationOrder), getMetaVariableOrder(*declarationModel)) << file;
+        
+        options.variableOrderHeuristic = storm::builder::DdVariableOrderHeuristic::Force;
+        std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD>> forceModel = builder.build(model, options);
+        std::vector<storm::expressions::Variable> forceOrder = storm::builder::computeDdVariableOrder(model, storm::builder::DdVariableOrderHeuristic::Force);
+        EXPECT_EQ(getMetaVariableNames(model, forceOrder), getMetaVariableOrder(*forceModel)) << file;
+        orderChanged |= forceOrder != declarationOrder;
+        EXPECT_EQ(declarationModel->getNumberOfStates(), forceModel->getNumberOfStates()) << file;
+        EXPECT_EQ(declarationModel->getNumberOfTransitions(), forceModel->getNumberOfTransitions()) << file;
+        
+        // A given order that matches the variables takes precedence over the heuristic.
+        std::vector<storm::expressions::Variable> reversedVariables(declarationOrder.rbegin(), declarationOrder.rend());
+        std::vector<std::string> reversedOrder;
+        for (auto const& variable : reversedVariables) {
+            reversedOrder.push_back(variable.getName());
+        }
+        options.variableOrder = reversedOrder;
+        std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD>> reversedModel = builder.build(model, options);
+        EXPECT_EQ(getMetaVariableNames(model, reversedVariables), getMetaVariableOrder(*reversedModel)) << file;
+        EXPECT_EQ(declarationModel->getNumberOfStates(), reversedModel->getNumberOfStates()) << file;
+        EXPECT_EQ(declarationModel->getNumberOfTransitions(), reversedModel->getNumberOfTransitions()) << file;
+    }
+    EXPECT_TRUE(orderChanged);
+}
@@ -10,6 +10,9 @@
 #include "storm/models/symbolic/StandardRewardModel.h"
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/builder/DdPrismModelBuilder.h"
+#include "storm/builder/DdVariableOrder.h"
+#include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/DdMetaVariable.h"
 
 TEST(DdPrismModelBuilderTest_Sylvan, Dtmc) {
     storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
@@ -329,4 +332,132 @@ TEST(UnboundedTest_Cudd, Mdp) {
     storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/unbounded.nm");
     storm::prism::Program program = modelDescription.preprocess("N=1").asPrismProgram();
     EXPECT_FALSE(storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD>().canHandle(program));
-}
\ No newline at end of file
+}
+
+TEST(DdPrismModelBuilderTest, VariableOrder) {
+    // Nodes that share a hyperedge are placed next to each other.
+    std::vector<uint64_t> order = storm::builder::computeForceOrder(4, {{0, 2}, {1, 3}});
+    EXPECT_EQ(std::vector<uint64_t>({0, 2, 1, 3}), order);
+    
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    std::vector<storm::expressions::Variable> declarationOrder = storm::builder::computeDdVariableOrder(program, storm::builder::DdVariableOrderHeuristic::Declaration);
+    std::vector<storm::expressions::Variable> forceOrder = storm::builder::computeDdVariableOrder(program, storm::builder::DdVariableOrderHeuristic::Force);
+    EXPECT_EQ(5ul, declarationOrder.size());
+    EXPECT_TRUE(std::is_permutation(declarationOrder.begin(), declarationOrder.end(), forceOrder.begin(), forceOrder.end()));
+}
+
+namespace {
+    // The declaration order separates the variables that are updated together, such that FORCE has to change it.
+    std::string const forceOrderProgram = R"(mdp
+module main
+    a : bool init false;
+    b : bool init false;
+    c : bool init false;
+    d : bool init false;
+    [] a=c -> (a'=!a);
+    [] a!=c -> (c'=!c);
+    [] b=d -> (b'=!b);
+    [] b!=d -> (d'=!d);
+endmodule
+)";
+
+    // Retrieves the names of the (row) meta variables of the given model in the order of their DD variables.
+    template<storm::dd::DdType Type>
+    std::vector<std::string> getMetaVariableOrder(storm::models::symbolic::Model<Type> const& model) {
+        std::vector<storm::expressions::Variable> variables(model.getRowVariables().begin(), model.getRowVariables().end());
+        std::sort(variables.begin(), variables.end(), [&model] (storm::expressions::Variable const& a, storm::expressions::Variable const& b) {
+            return model.getManager().getMetaVariable(a).getLowestIndex() < model.getManager().getMetaVariable(b).getLowestIndex();
+        });
+        std::vector<std::string> result;
+        for (auto const& variable : variables) {
+            result.push_back(variable.getName());
+        }
+        return result;
+    }
+
+    // Retrieves the names of the meta variables that the builder creates for the given variables.
+    std::vector<std::string> getMetaVariableNames(std::vector<storm::expressions::Variable> const& variables) {
+        std::vector<std::string> result;
+        for (auto const& variable : variables) {
+            result.push_back(variable.getName());
+        }
+        return result;
+    }
+}
+
+TEST(DdPrismModelBuilderTest_Sylvan, ForceVariableOrder) {
+    std::vector<std::string> names = {STORM_TEST_RESOURCES_DIR "/dtmc/leader-3-5.pm", STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm", STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.sm"};
+    std::vector<storm::prism::Program> programs;
+    for (std::string const& file : names) {
+        programs.push_back(storm::storage::SymbolicModelDescription(storm::parser::PrismParser::parse(file)).preprocess().asPrismProgram());
+    }
+    names.push_back("force order program");
+    programs.push_back(storm::parser::PrismParser::parseFromString(forceOrderProgram, names.back()));
+    
+    bool orderChanged = false;
+    for (uint64_t i = 0; i < programs.size(); ++i) {
+        storm::prism::Program const& model = programs[i];
+        std::string const& file = names[i];
+        storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan> builder;
+        storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>::Options options;
+        std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> declarationModel = builder.build(model, options);
+        std::vector<std::string> declarationOrder = getMetaVariableNames(storm::builder::computeDdVariableOrder(model, storm::builder::DdVariableOrderHeuristic::Declaration));
+        EXPECT_EQ(declarationOrder, getMetaVariableOrder(*declarationModel)) << file;
+        
+        options.variableOrderHeuristic = storm::builder::DdVariableOrderHeuristic::Force;
+        std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> forceModel = builder.build(model, options);
+        std::vector<std::string> forceOrder = getMetaVariableNames(storm::builder::computeDdVariableOrder(model, storm::builder::DdVariableOrderHeuristic::Force));
+        EXPECT_EQ(forceOrder, getMetaVariableOrder(*forceModel)) << file;
+        orderChanged |= forceOrder != declarationOrder;
+        EXPECT_EQ(declarationModel->getNumberOfStates(), forceModel->getNumberOfStates()) << file;
+        EXPECT_EQ(declarationModel->getNumberOfTransitions(), forceModel->getNumberOfTransitions()) << file;
+        
+        // A given order that matches the variables takes precedence over the heuristic.
+        std::vector<std::string> reversedOrder(declarationOrder.rbegin(), declarationOrder.rend());
+        options.variableOrder = reversedOrder;
+        std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> reversedModel = builder.build(model, options);
+        EXPECT_EQ(reversedOrder, getMetaVariableOrder(*reversedModel)) << file;
+        EXPECT_EQ(declarationModel->getNumberOfStates(), reversedModel->getNumberOfStates()) << file;
+        EXPECT_EQ(declarationModel->getNumberOfTransitions(), reversedModel->getNumberOfTransitions()) << file;
+    }
+    EXPECT_TRUE(orderChanged);
+}
+
+TEST(DdPrismModelBuilderTest_Cudd, ForceVariableOrder) {
+    std::vector<std::string> names = {STORM_TEST_RESOURCES_DIR "/dtmc/leader-3-5.pm", STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm", STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.sm"};
+    std::vector<storm::prism::Program> programs;
+    for (std::string const& file : names) {
+        programs.push_back(storm::storage::SymbolicModelDescription(storm::parser::PrismParser::parse(file)).preprocess().asPrismProgram());
+    }
+    names.push_back("force order program");
+    programs.push_back(storm::parser::PrismParser::parseFromString(forceOrderProgram, names.back()));
+    
+    bool orderChanged = false;
+    for (uint64_t i = 0; i < programs.size(); ++i) {
+        storm::prism::Program const& model = programs[i];
+        std::string const& file = names[i];
+        storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD> builder;
+        storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD>::Options options;
+        std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD>> declarationModel = builder.build(model, options);
+        std::vector<std::string> declarationOrder = getMetaVariableNames(storm::builder::computeDdVariableOrder(model, storm::builder::DdVariableOrderHeuristic::Declaration));
+        EXPECT_EQ(declarationOrder, getMetaVariableOrder(*declarationModel)) << file;
+        
+        options.variableOrderHeuristic = storm::builder::DdVariableOrderHeuristic::Force;
+        std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD>> forceModel = builder.build(model, options);
+        std::vector<std::string> forceOrder = getMetaVariableNames(storm::builder::computeDdVariableOrder(model, storm::builder::DdVariableOrderHeuristic::Force));
+        EXPECT_EQ(forceOrder, getMetaVariableOrder(*forceModel)) << file;
+        orderChanged |= forceOrder != declarationOrder;
+        EXPECT_EQ(declarationModel->getNumberOfStates(), forceModel->getNumberOfStates()) << file;
+        EXPECT_EQ(declarationModel->getNumberOfTransitions(), forceModel->getNumberOfTransitions()) << file;
+        
+        // A given order that matches the variables takes precedence over the heuristic.
+        std::vector<std::string> reversedOrder(declarationOrder.rbegin(), declarationOrder.rend());
+        options.variableOrder = reversedOrder;
+        std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD>> reversedModel = builder.build(model, options);
+        EXPECT_EQ(reversedOrder, getMetaVariableOrder(*reversedModel)) << file;
+        EXPECT_EQ(declarationModel->getNumberOfStates(), reversedModel->getNumberOfStates()) << file;
+        EXPECT_EQ(declarationModel->getNumberOfTransitions(), reversedModel->getNumberOfTransitions()) << file;
+    }
+    EXPECT_TRUE(orderChanged);
+}
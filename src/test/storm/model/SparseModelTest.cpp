@@ -0,0 +1,26 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+
+TEST(SparseModelTest, BackwardTransitions) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program).build();
+    ASSERT_TRUE(model->isOfType(storm::models::ModelType::Dtmc));
+
+    storm::storage::SparseMatrix<double> const& backwardTransitions = model->getBackwardTransitions();
+    EXPECT_EQ(model->getTransitionMatrix().transpose(true), backwardTransitions);
+
+    // The backward transitions are only computed once.
+    EXPECT_EQ(&backwardTransitions, &model->getBackwardTransitions());
+
+    // Copies of the model share the backward transitions until the copy is modified.
+    storm::models::sparse::Dtmc<double> copy(*model->as<storm::models::sparse::Dtmc<double>>());
+    EXPECT_EQ(&backwardTransitions, &copy.getBackwardTransitions());
+    copy.getTransitionMatrix().makeRowsAbsorbing(storm::storage::BitVector(copy.getNumberOfStates(), true));
+    copy.invalidateBackwardTransitions();
+    EXPECT_EQ(copy.getTransitionMatrix().transpose(true), copy.getBackwardTransitions());
+    EXPECT_EQ(model->getTransitionMatrix().transpose(true), model->getBackwardTransitions());
+}
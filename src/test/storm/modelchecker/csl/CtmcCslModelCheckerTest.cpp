@@ -27,6 +27,7 @@
 #include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/environment/solver/GmmxxSolverEnvironment.h"
 #include "storm/environment/solver/EigenSolverEnvironment.h"
+#include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
 
 namespace {
     
@@ -446,4 +447,33 @@ namespace {
         EXPECT_NEAR(0.404043, result[0], 1e-6);
         EXPECT_NEAR(0.595957, result[1], 1e-6);
     }
+
+    TEST(CtmcCslModelCheckerTest, BoundedUntilMultipleTimeBounds) {
+        storm::storage::SparseMatrixBuilder<double> matrixBuilder(2, 2, 1);
+        matrixBuilder.addNextValue(0, 1, 3.0);
+        storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+        storm::storage::SparseMatrix<double> backwardTransitions = matrix.transpose();
+
+        std::vector<double> exitRates = {3, 0};
+        storm::storage::BitVector phiStates(2, true);
+        storm::storage::BitVector psiStates(2);
+        psiStates.set(1);
+        std::vector<double> timeBounds = {0.0, 0.5, 1.0, 2.0};
+        storm::Environment env;
+        env.solver().timeBounded().setRelativeTerminationCriterion(false);
+        std::vector<std::vector<double>> result = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilities(env, matrix, backwardTransitions, phiStates, psiStates, exitRates, timeBounds);
+
+        ASSERT_EQ(timeBounds.size(), result.size());
+        for (uint64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+            EXPECT_NEAR(1.0 - std::exp(-3.0 * timeBounds[boundIndex]), result[boundIndex][0], 1e-6);
+            EXPECT_NEAR(1.0, result[boundIndex][1], 1e-6);
+        }
+
+        env.solver().timeBounded().setSteadyStateDetection(true);
+        result = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilities(env, matrix, backwardTransitions, phiStates, psiStates, exitRates, timeBounds);
+        ASSERT_EQ(timeBounds.size(), result.size());
+        for (uint64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+            EXPECT_NEAR(1.0 - std::exp(-3.0 * timeBounds[boundIndex]), result[boundIndex][0], 1e-5);
+        }
+    }
 }
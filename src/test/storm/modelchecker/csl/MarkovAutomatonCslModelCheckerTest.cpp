@@ -15,12 +15,14 @@
 #include "storm/models/symbolic/StandardRewardModel.h"
 #include "storm/modelchecker/csl/SparseMarkovAutomatonCslModelChecker.h"
 #include "storm/modelchecker/csl/HybridMarkovAutomatonCslModelChecker.h"
+#include "storm/modelchecker/csl/helper/SparseMarkovAutomatonCslHelper.h"
 #include "storm/modelchecker/results/QuantitativeCheckResult.h"
 #include "storm/modelchecker/results/QualitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
+#include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/logic/Formulas.h"
 #include "storm/storage/jani/Property.h"
@@ -349,4 +351,23 @@ namespace {
         }
 #endif
     }
+    
+    TEST(MarkovAutomatonCslModelCheckerTest, BoundedUntilMultipleTimeBounds) {
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/ma/server.ma");
+        auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("Pmax=? [F<1 \"error\"]", program));
+        auto model = storm::api::buildSparseModel<double>(program, formulas)->template as<storm::models::sparse::MarkovAutomaton<double>>();
+        uint64_t initialState = model->getInitialStates().getNextSetIndex(0);
+        
+        storm::Environment env;
+        env.solver().timeBounded().setMaMethod(storm::solver::MaBoundedReachabilityMethod::UnifPlus);
+        std::vector<double> upperBounds = {1.0, 0.5, storm::utility::infinity<double>()};
+        std::vector<std::vector<double>> result = storm::modelchecker::helper::SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilities(env, storm::solver::SolveGoal<double>(storm::OptimizationDirection::Maximize), model->getTransitionMatrix(), model->getExitRates(), model->getMarkovianStates(), storm::storage::BitVector(model->getNumberOfStates(), true), model->getStates("error"), upperBounds);
+        
+        ASSERT_EQ(upperBounds.size(), result.size());
+        EXPECT_NEAR(0.455504, result[0][initialState], 1e-6);
+        std::vector<double> singleResult = storm::modelchecker::helper::SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilities(env, storm::solver::SolveGoal<double>(storm::OptimizationDirection::Maximize), model->getTransitionMatrix(), model->getExitRates(), model->getMarkovianStates(), storm::storage::BitVector(model->getNumberOfStates(), true), model->getStates("error"), std::make_pair(0.0, 0.5));
+        EXPECT_NEAR(singleResult[initialState], result[1][initialState], 1e-6);
+        EXPECT_LE(result[1][initialState], result[0][initialState]);
+        EXPECT_NEAR(1.0, result[2][initialState], 1e-6);
+    }
 }
@@ -6,6 +6,7 @@
 #include "storm/solver/StandardMinMaxLinearEquationSolver.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/helper/QualitativeStateSetsCache.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
@@ -197,3 +198,39 @@ TEST(ExplicitMdpPrctlModelCheckerTest, AsynchronousLeader) {
     EXPECT_NEAR(30.0/7.0, quantitativeResult6[0], precision);
 }
 
+TEST(ExplicitMdpPrctlModelCheckerTest, SharedQualitativeStateSets) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/two_dice.tra", STORM_TEST_RESOURCES_DIR "/lab/two_dice.lab", "", "");
+    storm::Environment env;
+    double const precision = 1e-6;
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+    storm::parser::FormulaParser formulaParser;
+
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = abstractModel->as<storm::models::sparse::Mdp<double>>();
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*mdp);
+    auto cache = std::make_shared<storm::modelchecker::helper::QualitativeStateSetsCache>(mdp);
+
+    std::vector<std::string> formulas = {"Pmin=? [F \"two\"]", "Pmax=? [F \"two\"]", "Pmin=? [true U \"two\"]", "Pmax=? [F \"three\"]"};
+    std::vector<double> expectedResults = {1.0/36.0, 1.0/36.0, 1.0/36.0, 2.0/36.0};
+    for (uint64_t index = 0; index < formulas.size(); ++index) {
+        std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString(formulas[index]);
+        storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*formula);
+        task.setQualitativeStateSetsCache(cache);
+        std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, task);
+        EXPECT_NEAR(expectedResults[index], result->asExplicitQuantitativeCheckResult<double>()[0], precision);
+    }
+
+    // The third formula shares the qualitative analysis of the first one.
+    EXPECT_EQ(3ull, cache->getNumberOfEntries());
+    EXPECT_EQ(1ull, cache->getNumberOfHits());
+
+    // The cache is bound to the model it was created for.
+    EXPECT_TRUE(cache->isApplicable(mdp->getTransitionMatrix()));
+    auto otherMdp = std::make_shared<storm::models::sparse::Mdp<double>>(*mdp);
+    EXPECT_FALSE(cache->isApplicable(otherMdp->getTransitionMatrix()));
+    auto otherCache = std::make_shared<storm::modelchecker::helper::QualitativeStateSetsCache>(otherMdp);
+    EXPECT_TRUE(otherCache->isApplicable(otherMdp->getTransitionMatrix()));
+    // A model replacing a destroyed one is not matched, even if its matrix is allocated at the same address.
+    otherMdp.reset();
+    otherMdp = std::make_shared<storm::models::sparse::Mdp<double>>(*mdp);
+    EXPECT_FALSE(otherCache->isApplicable(otherMdp->getTransitionMatrix()));
+}
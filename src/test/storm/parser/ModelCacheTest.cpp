@@ -0,0 +1,102 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include <fstream>
+#include <sstream>
+
+#include <boost/filesystem.hpp>
+
+#include "storm-parsers/api/model_cache.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/api/builder.h"
+#include "storm/builder/BuilderOptions.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+TEST(ModelCacheTest, StoreAndLoad) {
+    boost::filesystem::path cacheDirectory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("storm-model-cache-%%%%-%%%%");
+
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    modelDescription = modelDescription.preprocess();
+    storm::builder::BuilderOptions options;
+    options.setBuildAllLabels(true);
+    options.setBuildAllRewardModels(true);
+    ASSERT_TRUE(storm::api::isModelCacheApplicable(options));
+    std::string key = storm::api::computeModelCacheKey<double>(modelDescription, options);
+
+    EXPECT_EQ(nullptr, storm::api::loadModelFromCache<double>(cacheDirectory.string(), key));
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::api::buildSparseModel<double>(modelDescription, options);
+    // Labels without states do not appear in the DRN format and have to survive the round trip nevertheless.
+    model->getStateLabeling().addLabel("empty");
+    ASSERT_TRUE(model->hasRewardModel());
+    storm::api::storeModelInCache<double>(cacheDirectory.string(), key, model);
+
+    std::shared_ptr<storm::models::sparse::Model<double>> cachedModel = storm::api::loadModelFromCache<double>(cacheDirectory.string(), key);
+    ASSERT_NE(nullptr, cachedModel);
+    EXPECT_EQ(model->getType(), cachedModel->getType());
+    EXPECT_EQ(model->getNumberOfStates(), cachedModel->getNumberOfStates());
+    EXPECT_EQ(model->getNumberOfChoices(), cachedModel->getNumberOfChoices());
+    EXPECT_EQ(model->getNumberOfTransitions(), cachedModel->getNumberOfTransitions());
+    EXPECT_EQ(model->getInitialStates(), cachedModel->getInitialStates());
+    for (auto const& label : model->getStateLabeling().getLabels()) {
+        ASSERT_TRUE(cachedModel->hasLabel(label)) << label;
+        EXPECT_EQ(model->getStates(label), cachedModel->getStates(label)) << label;
+    }
+    EXPECT_TRUE(cachedModel->getStates("empty").empty());
+    EXPECT_EQ(model->getNumberOfRewardModels(), cachedModel->getNumberOfRewardModels());
+    for (auto const& rewardModel : model->getRewardModels()) {
+        ASSERT_TRUE(cachedModel->hasRewardModel(rewardModel.first)) << rewardModel.first;
+        EXPECT_EQ(rewardModel.second.getTotalRewardVector(model->getTransitionMatrix()), cachedModel->getRewardModel(rewardModel.first).getTotalRewardVector(cachedModel->getTransitionMatrix())) << rewardModel.first;
+    }
+
+    boost::filesystem::path modelFile, keyFile;
+    for (boost::filesystem::directory_iterator it(cacheDirectory); it != boost::filesystem::directory_iterator(); ++it) {
+        if (it->path().extension() == ".drn") {
+            modelFile = it->path();
+        } else if (it->path().extension() == ".key") {
+            keyFile = it->path();
+        }
+    }
+    ASSERT_FALSE(modelFile.empty());
+    ASSERT_FALSE(keyFile.empty());
+    auto readFile = [] (boost::filesystem::path const& file) {
+        std::ifstream stream(file.string());
+        std::stringstream content;
+        content << stream.rdbuf();
+        return content.str();
+    };
+    auto writeFile = [] (boost::filesystem::path const& file, std::string const& content) {
+        std::ofstream stream(file.string(), std::ios::trunc);
+        stream << content;
+    };
+
+    // A summary that does not match the loaded model is detected.
+    std::string keyContent = readFile(keyFile);
+    ASSERT_EQ(0ull, keyContent.find("states: " + std::to_string(model->getNumberOfStates()) + "\n"));
+    writeFile(keyFile, "states: " + std::to_string(model->getNumberOfStates() + 1) + keyContent.substr(keyContent.find('\n')));
+    EXPECT_EQ(nullptr, storm::api::loadModelFromCache<double>(cacheDirectory.string(), key));
+    writeFile(keyFile, keyContent);
+    EXPECT_NE(nullptr, storm::api::loadModelFromCache<double>(cacheDirectory.string(), key));
+
+    // A truncated model file is ignored, even if it still consists of complete lines.
+    std::string modelContent = readFile(modelFile);
+    uint64_t lineEnd = modelContent.rfind('\n', modelContent.size() / 2);
+    ASSERT_NE(std::string::npos, lineEnd);
+    writeFile(modelFile, modelContent.substr(0, lineEnd + 1));
+    EXPECT_EQ(nullptr, storm::api::loadModelFromCache<double>(cacheDirectory.string(), key));
+
+    // Storing the model again repairs the entry without leaving temporary files behind.
+    storm::api::storeModelInCache<double>(cacheDirectory.string(), key, model);
+    EXPECT_NE(nullptr, storm::api::loadModelFromCache<double>(cacheDirectory.string(), key));
+    EXPECT_EQ(3, std::distance(boost::filesystem::directory_iterator(cacheDirectory), boost::filesystem::directory_iterator()));
+
+    // Different options yield a different key.
+    options.setApplyMaximalProgressAssumption(!options.isApplyMaximalProgressAssumptionSet());
+    EXPECT_NE(key, storm::api::computeModelCacheKey<double>(modelDescription, options));
+
+    // State valuations are not retained by the cache.
+    options.setBuildStateValuations(true);
+    EXPECT_FALSE(storm::api::isModelCacheApplicable(options));
+
+    boost::filesystem::remove_all(cacheDirectory);
+}
@@ -175,7 +175,32 @@ namespace {
         ASSERT_NO_THROW(solver->solveEquations(this->env(), storm::OptimizationDirection::Maximize, x, b));
         EXPECT_NEAR(x[0], this->parseNumber("0.99"), this->precision());
     }
+    
+    TYPED_TEST(MinMaxLinearEquationSolverTest, SolveMultipleEquations) {
+        typedef typename TestFixture::ValueType ValueType;
+        
+        storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, true);
+        ASSERT_NO_THROW(builder.newRowGroup(0));
+        ASSERT_NO_THROW(builder.addNextValue(0, 0, this->parseNumber("0.9")));
+        
+        storm::storage::SparseMatrix<ValueType> A;
+        ASSERT_NO_THROW(A = builder.build(2));
+        
+        std::vector<std::vector<ValueType>> x(2, std::vector<ValueType>(1));
+        std::vector<std::vector<ValueType>> b = {{this->parseNumber("0.099"), this->parseNumber("0.5")}, {this->parseNumber("0.01"), this->parseNumber("0.2")}};
+        
+        auto factory = storm::solver::GeneralMinMaxLinearEquationSolverFactory<ValueType>();
+        auto solver = factory.create(this->env(), A);
+        solver->setHasUniqueSolution(true);
+        solver->setHasNoEndComponents(true);
+        solver->setBounds(this->parseNumber("0"), this->parseNumber("2"));
+        solver->setRequirementsChecked();
+        ASSERT_NO_THROW(solver->solveEquations(this->env(), storm::OptimizationDirection::Minimize, x, b));
+        EXPECT_NEAR(x[0][0], this->parseNumber("0.5"), this->precision());
+        EXPECT_NEAR(x[1][0], this->parseNumber("0.1"), this->precision());
+        
+        ASSERT_NO_THROW(solver->solveEquations(this->env(), storm::OptimizationDirection::Maximize, x, b));
+        EXPECT_NEAR(x[0][0], this->parseNumber("0.99"), this->precision());
+        EXPECT_NEAR(x[1][0], this->parseNumber("0.2"), this->precision());
+    }
 }
-
-
-
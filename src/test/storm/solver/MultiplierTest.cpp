@@ -120,4 +120,55 @@ namespace {
         EXPECT_NEAR(x[0], this->parseNumber("0.923808265834023387639"), this->precision());
     }
     
-}
\ No newline at end of file
+    TYPED_TEST(MultiplierTest, multiplyBlockTest) {
+        typedef typename TestFixture::ValueType ValueType;
+        
+        storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, true);
+        ASSERT_NO_THROW(builder.newRowGroup(0));
+        ASSERT_NO_THROW(builder.addNextValue(0, 0, this->parseNumber("0.9")));
+        ASSERT_NO_THROW(builder.addNextValue(0, 1, this->parseNumber("0.099")));
+        ASSERT_NO_THROW(builder.addNextValue(0, 2, this->parseNumber("0.001")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 1, this->parseNumber("0.5")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 2, this->parseNumber("0.5")));
+        ASSERT_NO_THROW(builder.newRowGroup(2));
+        ASSERT_NO_THROW(builder.addNextValue(2, 1, this->parseNumber("1")));
+        ASSERT_NO_THROW(builder.newRowGroup(3));
+        ASSERT_NO_THROW(builder.addNextValue(3, 2, this->parseNumber("1")));
+        
+        storm::storage::SparseMatrix<ValueType> A;
+        ASSERT_NO_THROW(A = builder.build());
+        
+        std::vector<std::vector<ValueType>> xVectors = {{this->parseNumber("0"), this->parseNumber("1"), this->parseNumber("0")}, {this->parseNumber("0.3"), this->parseNumber("0.2"), this->parseNumber("0.7")}};
+        std::vector<std::vector<ValueType>> bVectors = {{this->parseNumber("0.1"), this->parseNumber("0"), this->parseNumber("0.2"), this->parseNumber("0")}, {this->parseNumber("0"), this->parseNumber("0.4"), this->parseNumber("0"), this->parseNumber("0.1")}};
+        std::vector<ValueType> x, b, result;
+        storm::utility::vector::interleaveVectors(xVectors, x);
+        storm::utility::vector::interleaveVectors(bVectors, b);
+        
+        auto factory = storm::solver::MultiplierFactory<ValueType>();
+        auto multiplier = factory.create(this->env(), A);
+        
+        // The block multiplication has to coincide with the multiplication of the individual vectors.
+        result.resize(A.getRowCount() * 2);
+        ASSERT_NO_THROW(multiplier->multiplyBlock(this->env(), x, &b, result, 2));
+        for (uint64_t j = 0; j < 2; ++j) {
+            std::vector<ValueType> singleResult(A.getRowCount());
+            multiplier->multiply(this->env(), xVectors[j], &bVectors[j], singleResult);
+            for (uint64_t row = 0; row < A.getRowCount(); ++row) {
+                EXPECT_NEAR(result[row * 2 + j], singleResult[row], this->precision());
+            }
+        }
+        
+        for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+            result.resize(A.getRowGroupCount() * 2);
+            ASSERT_NO_THROW(multiplier->multiplyAndReduceBlock(this->env(), dir, x, &b, result, 2));
+            for (uint64_t j = 0; j < 2; ++j) {
+                std::vector<ValueType> singleResult(A.getRowGroupCount());
+                multiplier->multiplyAndReduce(this->env(), dir, xVectors[j], &bVectors[j], singleResult);
+                for (uint64_t group = 0; group < A.getRowGroupCount(); ++group) {
+                    EXPECT_NEAR(result[group * 2 + j], singleResult[group], this->precision());
+                }
+            }
+        }
+    }
+    
+}
@@ -0,0 +1,135 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm/api/builder.h"
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm/api/properties.h"
+#include "storm-parsers/api/properties.h"
+
+#include "storm/models/symbolic/Dtmc.h"
+#include "storm/models/symbolic/Mdp.h"
+#include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/modelchecker/prctl/SymbolicDtmcPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/SymbolicMdpPrctlModelChecker.h"
+#include "storm/modelchecker/results/QuantitativeCheckResult.h"
+#include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/solver/helper/SymbolicRoundingHelper.h"
+#include "storm/storage/dd/DdManager.h"
+#include "storm/logic/Formulas.h"
+#include "storm/utility/prism.h"
+
+namespace {
+
+    class CuddEnvironment {
+    public:
+        static const storm::dd::DdType ddType = storm::dd::DdType::CUDD;
+    };
+
+    class SylvanEnvironment {
+    public:
+        static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;
+    };
+
+    template<typename TestType>
+    class SymbolicRoundingTest : public ::testing::Test {
+    public:
+        static const storm::dd::DdType ddType = TestType::ddType;
+
+        storm::Environment createEnvironment(bool rounding) const {
+            storm::Environment env;
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Power);
+            env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            env.solver().native().setRelativeTerminationCriterion(false);
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            env.solver().minMax().setRelativeTerminationCriterion(false);
+            if (rounding) {
+                env.solver().setDdRoundingPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-3));
+                env.solver().setDdRoundingInterval(2);
+            }
+            return env;
+        }
+
+        template<typename ModelType>
+        std::pair<std::shared_ptr<ModelType>, std::vector<std::shared_ptr<storm::logic::Formula const>>> buildModelFormulas(std::string const& pathToPrismFile, std::string const& formulasAsString) const {
+            storm::prism::Program program = storm::utility::prism::preprocess(storm::api::parseProgram(pathToPrismFile), "");
+            auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+            auto model = storm::api::buildSymbolicModel<ddType, double>(program, formulas)->template as<ModelType>();
+            return std::make_pair(model, formulas);
+        }
+
+        template<typename ModelType>
+        double getQuantitativeResultAtInitialState(std::shared_ptr<ModelType> const& model, std::unique_ptr<storm::modelchecker::CheckResult>& result) const {
+            storm::modelchecker::SymbolicQualitativeCheckResult<ddType> filter(model->getReachableStates(), model->getInitialStates());
+            result->filter(filter);
+            return result->asQuantitativeCheckResult<double>().getMin();
+        }
+    };
+
+    typedef ::testing::Types<
+            CuddEnvironment,
+            SylvanEnvironment
+    > TestingTypes;
+
+    TYPED_TEST_SUITE(SymbolicRoundingTest, TestingTypes,);
+
+    TYPED_TEST(SymbolicRoundingTest, Precision) {
+        static const storm::dd::DdType ddType = TypeParam::ddType;
+        std::shared_ptr<storm::dd::DdManager<ddType>> manager = std::make_shared<storm::dd::DdManager<ddType>>();
+        storm::dd::Add<ddType, double> values = manager->template getConstant<double>(1.0 / 3.0);
+
+        // The precision is lowered such that several roundings fit into the error bound.
+        storm::solver::helper::SymbolicRoundingHelper<ddType, double> absoluteHelper(this->createEnvironment(true), 1e-6, false);
+        EXPECT_TRUE(absoluteHelper.isEnabled());
+        EXPECT_LE(absoluteHelper.getPrecision(), 1e-6 / 8);
+        absoluteHelper.process(2, values);
+        EXPECT_EQ(1ull, absoluteHelper.getNumberOfRoundings());
+        EXPECT_LE(absoluteHelper.getAccumulatedError(), absoluteHelper.getPrecision() / 2);
+        EXPECT_NEAR(1.0 / 3.0, values.getMax(), absoluteHelper.getPrecision() / 2);
+
+        // Rounding does not respect relative errors.
+        storm::solver::helper::SymbolicRoundingHelper<ddType, double> relativeHelper(this->createEnvironment(true), 1e-6, true);
+        EXPECT_FALSE(relativeHelper.isEnabled());
+
+        storm::solver::helper::SymbolicRoundingHelper<ddType, double> disabledHelper(this->createEnvironment(false), 1e-6, false);
+        EXPECT_FALSE(disabledHelper.isEnabled());
+    }
+
+    TYPED_TEST(SymbolicRoundingTest, Dtmc) {
+        typedef storm::models::symbolic::Dtmc<TypeParam::ddType, double> ModelType;
+        std::string formulasString = "P=? [F \"one\"]; R=? [F \"done\"]";
+        auto modelFormulas = this->template buildModelFormulas<ModelType>(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm", formulasString);
+        auto model = modelFormulas.first;
+        storm::modelchecker::SymbolicDtmcPrctlModelChecker<ModelType> checker(*model);
+        std::vector<std::string> expectedResults = {"1/6", "11/3"};
+
+        for (bool rounding : {false, true}) {
+            storm::Environment env = this->createEnvironment(rounding);
+            for (uint64_t index = 0; index < expectedResults.size(); ++index) {
+                std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*modelFormulas.second[index], true));
+                EXPECT_NEAR(storm::utility::convertNumber<double>(expectedResults[index]), this->getQuantitativeResultAtInitialState(model, result), 1e-6) << "rounding: " << rounding;
+            }
+        }
+    }
+
+    TYPED_TEST(SymbolicRoundingTest, Mdp) {
+        typedef storm::models::symbolic::Mdp<TypeParam::ddType, double> ModelType;
+        std::string formulasString = "Pmin=? [F \"two\"]; Pmax=? [F \"three\"]; Rmin=? [F \"done\"]; Rmax=? [F \"done\"]";
+        auto modelFormulas = this->template buildModelFormulas<ModelType>(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm", formulasString);
+        auto model = modelFormulas.first;
+        storm::modelchecker::SymbolicMdpPrctlModelChecker<ModelType> checker(*model);
+        std::vector<std::string> expectedResults = {"1/36", "2/36", "22/3", "22/3"};
+
+        for (bool rounding : {false, true}) {
+            storm::Environment env = this->createEnvironment(rounding);
+            for (uint64_t index = 0; index < expectedResults.size(); ++index) {
+                std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*modelFormulas.second[index], true));
+                EXPECT_NEAR(storm::utility::convertNumber<double>(expectedResults[index]), this->getQuantitativeResultAtInitialState(model, result), 1e-6) << "rounding: " << rounding;
+            }
+        }
+    }
+}
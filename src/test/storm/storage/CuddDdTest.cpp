@@ -10,6 +10,7 @@
 #include "storm/settings/SettingsManager.h"
 
 #include "storm/storage/SparseMatrix.h"
+#include "storm/utility/dd.h"
 
 TEST(CuddDd, AddConstants) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
@@ -716,6 +717,46 @@ TEST(CuddDd, AddOddTest) {
     EXPECT_EQ(106ul, matrix.getNonzeroEntryCount());
 }
 
+TEST(CuddDd, AddParallelConversionTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> a = manager->addMetaVariable("a");
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 100);
+    
+    storm::dd::Add<storm::dd::DdType::CUDD, double> rowIdentity = manager->template getIdentity<double>(x.first);
+    storm::dd::Add<storm::dd::DdType::CUDD, double> columnIdentity = manager->template getIdentity<double>(x.second);
+    storm::dd::Add<storm::dd::DdType::CUDD, double> dd = rowIdentity.lessOrEqual(columnIdentity).template toAdd<double>() * manager->getRange(x.first).template toAdd<double>() * manager->getRange(x.second).template toAdd<double>() * (rowIdentity + columnIdentity);
+    storm::dd::Add<storm::dd::DdType::CUDD, double> groupedDd = manager->getEncoding(a.first, 0).ite(dd, dd + manager->getRange(x.first).template toAdd<double>() * manager->getRange(x.second).template toAdd<double>());
+    
+    storm::dd::Odd rowOdd = manager->getRange(x.first).template toAdd<double>().createOdd();
+    storm::dd::Odd columnOdd = manager->getRange(x.second).template toAdd<double>().createOdd();
+    
+    manager->getInternalDdManager().setNumberOfConversionThreads(1);
+    std::vector<double> vector = rowIdentity.toVector(rowOdd);
+    storm::storage::SparseMatrix<double> matrix = dd.toMatrix({x.first}, {x.second}, rowOdd, columnOdd);
+    storm::storage::SparseMatrix<double> groupedMatrix = groupedDd.toMatrix({a.first}, rowOdd, columnOdd);
+    EXPECT_EQ(5050ul, matrix.getNonzeroEntryCount());
+    
+    // The conversion with several threads must yield exactly the same results.
+    manager->getInternalDdManager().setNumberOfConversionThreads(4);
+    EXPECT_EQ(vector, rowIdentity.toVector(rowOdd));
+    EXPECT_TRUE(matrix == dd.toMatrix({x.first}, {x.second}, rowOdd, columnOdd));
+    EXPECT_TRUE(groupedMatrix == groupedDd.toMatrix({a.first}, rowOdd, columnOdd));
+}
+
+TEST(CuddDd, AddRoundToPrecisionTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
+    
+    // The values differ only after the third binary digit.
+    storm::dd::Add<storm::dd::DdType::CUDD, double> dd = manager->getRange(x.first).template toAdd<double>() + manager->template getIdentity<double>(x.first) / manager->template getConstant<double>(1024);
+    
+    double deviation = 0;
+    storm::dd::Add<storm::dd::DdType::CUDD, double> rounded = storm::utility::dd::roundToPrecision(dd, 0.125, deviation);
+    EXPECT_EQ(9.0 / 1024, deviation);
+    EXPECT_TRUE(rounded == manager->getRange(x.first).template toAdd<double>());
+    EXPECT_LT(rounded.getNodeCount(), dd.getNodeCount());
+}
+
 TEST(CuddDd, BddOddTest) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
     std::pair<storm::expressions::Variable, storm::expressions::Variable> a = manager->addMetaVariable("a");
@@ -1,6 +1,7 @@
 #include "test/storm_gtest.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/BitVector.h"
+#include "storm/utility/parallel.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/OutOfRangeException.h"
 #include "storm/exceptions/InvalidArgumentException.h"
@@ -792,3 +793,49 @@ TEST(SparseMatrix, Permute) {
     EXPECT_EQ(matrix.getRowSum(3), matrixperm.getRowSum(3));
     EXPECT_EQ(matrix.getRowSum(2), matrixperm.getRowSum(4));
 }
+
+TEST(SparseMatrix, ParallelOperations) {
+    // The matrix needs to be large enough to be processed concurrently.
+    uint64_t const rowGroupCount = 20000;
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, 0, 0, false, true);
+    uint64_t row = 0;
+    for (uint64_t group = 0; group < rowGroupCount; ++group) {
+        matrixBuilder.newRowGroup(row);
+        for (uint64_t choice = 0; choice < 1 + group % 3; ++choice, ++row) {
+            uint64_t column = (group * 7919 + choice * 13) % (rowGroupCount - 3);
+            for (uint64_t offset = 0; offset < 3; ++offset) {
+                matrixBuilder.addNextValue(row, column + offset, 0.1 * (offset + 1));
+            }
+            if (choice == 1) {
+                matrixBuilder.addNextValue(row, rowGroupCount - 1, 0.0);
+            }
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+    
+    storm::storage::BitVector constraint(rowGroupCount);
+    storm::storage::BitVector rowFilter(matrix.getRowCount());
+    for (uint64_t index = 0; index < rowGroupCount; index += 3) {
+        constraint.set(index);
+        rowFilter.set(index);
+    }
+    std::vector<uint64_t> choices(rowGroupCount);
+    for (uint64_t group = 0; group < rowGroupCount; ++group) {
+        choices[group] = group % matrix.getRowGroupSize(group);
+    }
+    
+    auto computeResults = [&] () {
+        return std::vector<storm::storage::SparseMatrix<double>>({matrix.transpose(), matrix.transpose(true), matrix.transpose(false, true), matrix.getSubmatrix(true, constraint, constraint, true), matrix.getSubmatrix(false, rowFilter, constraint), matrix.filterEntries(rowFilter), matrix.selectRowsFromRowGroups(choices, true)});
+    };
+    std::vector<storm::storage::SparseMatrix<double>> sequentialResults = computeResults();
+    storm::utility::parallel::setNumberOfMatrixThreads(4);
+    std::vector<storm::storage::SparseMatrix<double>> parallelResults = computeResults();
+    storm::utility::parallel::setNumberOfMatrixThreads(1);
+    
+    ASSERT_EQ(sequentialResults.size(), parallelResults.size());
+    for (uint64_t index = 0; index < sequentialResults.size(); ++index) {
+        EXPECT_EQ(sequentialResults[index], parallelResults[index]) << "Results of operation " << index << " differ.";
+    }
+    EXPECT_EQ(matrix.transpose().transpose(), matrix.filterEntries(storm::storage::BitVector(matrix.getRowCount(), true)).transpose().transpose());
+}
@@ -0,0 +1,122 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/FlexibleSparseMatrix.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/stateelimination.h"
+#include "storm/solver/stateelimination/ArithmeticCache.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/utility/constants.h"
+
+namespace {
+    // A star in which the center and the leaves are mutually connected and all leaves lead to a target state.
+    storm::storage::SparseMatrix<double> buildStar() {
+        storm::storage::SparseMatrixBuilder<double> builder(6, 6);
+        builder.addNextValue(0, 1, 0.25);
+        builder.addNextValue(0, 2, 0.25);
+        builder.addNextValue(0, 3, 0.25);
+        builder.addNextValue(0, 4, 0.25);
+        for (uint64_t leaf = 1; leaf <= 4; ++leaf) {
+            builder.addNextValue(leaf, 0, 0.5);
+            builder.addNextValue(leaf, 5, 0.5);
+        }
+        builder.addNextValue(5, 5, 1.0);
+        return builder.build();
+    }
+
+    void checkIsPermutation(std::vector<storm::storage::sparse::state_type> order, storm::storage::BitVector const& states) {
+        std::sort(order.begin(), order.end());
+        EXPECT_EQ(std::vector<storm::storage::sparse::state_type>(states.begin(), states.end()), order);
+    }
+}
+
+TEST(StateEliminationTest, EstimateFillIn) {
+    storm::storage::SparseMatrix<double> matrix = buildStar();
+    storm::storage::FlexibleSparseMatrix<double> flexibleMatrix(matrix);
+    storm::storage::FlexibleSparseMatrix<double> flexibleBackwardTransitions(matrix.transpose(), true);
+
+    // Eliminating the center first connects all leaves.
+    EXPECT_EQ(16ull, storm::utility::stateelimination::estimateFillIn(flexibleMatrix, flexibleBackwardTransitions, {0, 1, 2, 3, 4}));
+    EXPECT_EQ(2ull, storm::utility::stateelimination::estimateFillIn(flexibleMatrix, flexibleBackwardTransitions, {1, 2, 3, 4, 0}));
+    EXPECT_LT(3ull, storm::utility::stateelimination::estimateFillIn(flexibleMatrix, flexibleBackwardTransitions, {0, 1, 2, 3, 4}, 3));
+
+    // The minimum degree order does not eliminate the center first.
+    storm::storage::BitVector states(6, true);
+    states.set(5, false);
+    std::vector<storm::storage::sparse::state_type> order = storm::utility::stateelimination::computeMinimumDegreeOrder(flexibleMatrix, flexibleBackwardTransitions, states);
+    checkIsPermutation(order, states);
+    EXPECT_NE(0ull, order.front());
+    EXPECT_GT(16ull, storm::utility::stateelimination::estimateFillIn(flexibleMatrix, flexibleBackwardTransitions, order));
+}
+
+TEST(StateEliminationTest, StructuralOrders) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program).build();
+    ASSERT_TRUE(model->getType() == storm::models::ModelType::Dtmc);
+
+    storm::storage::SparseMatrix<double> const& matrix = model->getTransitionMatrix();
+    storm::storage::FlexibleSparseMatrix<double> flexibleMatrix(matrix);
+    storm::storage::FlexibleSparseMatrix<double> flexibleBackwardTransitions(matrix.transpose(), true);
+    storm::storage::BitVector states = ~model->getInitialStates();
+
+    std::vector<storm::storage::sparse::state_type> minimumDegreeOrder = storm::utility::stateelimination::computeMinimumDegreeOrder(flexibleMatrix, flexibleBackwardTransitions, states);
+    checkIsPermutation(minimumDegreeOrder, states);
+    std::vector<storm::storage::sparse::state_type> nestedDissectionOrder = storm::utility::stateelimination::computeNestedDissectionOrder(flexibleMatrix, flexibleBackwardTransitions, states);
+    checkIsPermutation(nestedDissectionOrder, states);
+
+    // The estimation stops once the limit is exceeded.
+    uint64_t fillIn = storm::utility::stateelimination::estimateFillIn(flexibleMatrix, flexibleBackwardTransitions, nestedDissectionOrder);
+    EXPECT_EQ(fillIn, storm::utility::stateelimination::estimateFillIn(flexibleMatrix, flexibleBackwardTransitions, nestedDissectionOrder, fillIn));
+    if (fillIn > 0) {
+        EXPECT_LT(fillIn - 1, storm::utility::stateelimination::estimateFillIn(flexibleMatrix, flexibleBackwardTransitions, nestedDissectionOrder, fillIn - 1));
+    }
+}
+
+#ifdef STORM_HAVE_CARL
+TEST(StateEliminationTest, ArithmeticCache) {
+    std::shared_ptr<storm::RawPolynomialCache> cache = std::make_shared<storm::RawPolynomialCache>();
+    carl::StringParser parser;
+    parser.setVariables({"p", "q"});
+    auto parsePolynomial = [&] (std::string const& polynomial) { return storm::Polynomial(parser.template parseMultivariatePolynomial<storm::RationalFunctionCoefficient>(polynomial), cache); };
+    storm::RationalFunction p(parsePolynomial("p"));
+    storm::RationalFunction q(parsePolynomial("q"));
+    storm::RationalFunction oneMinusP(parsePolynomial("1-p"));
+    std::vector<storm::RationalFunction> functions = {p, q, oneMinusP, storm::RationalFunction(parsePolynomial("p*q")), storm::RationalFunction(parsePolynomial("p"), parsePolynomial("1-q")), storm::utility::convertNumber<storm::RationalFunction>(0.5), storm::RationalFunction(0)};
+
+    // The cached operations yield the same results as the plain ones, also if the result was already known.
+    storm::solver::stateelimination::ArithmeticCache<storm::RationalFunction> arithmeticCache;
+    for (uint64_t round = 0; round < 2; ++round) {
+        for (auto const& first : functions) {
+            for (auto const& second : functions) {
+                EXPECT_EQ(storm::RationalFunction(first * second), arithmeticCache.multiply(first, second));
+                EXPECT_EQ(storm::RationalFunction(first + second), arithmeticCache.add(first, second));
+            }
+        }
+        if (round == 0) {
+            EXPECT_LT(0ull, arithmeticCache.getNumberOfMisses());
+        }
+    }
+    EXPECT_LT(arithmeticCache.getNumberOfMisses(), arithmeticCache.getNumberOfHits());
+
+    // Once the maximal size is exceeded, the stored results are discarded.
+    storm::solver::stateelimination::ArithmeticCache<storm::RationalFunction> smallCache(2);
+    smallCache.multiply(p, q);
+    smallCache.multiply(p, oneMinusP);
+    EXPECT_EQ(2ull, smallCache.getNumberOfMisses());
+    smallCache.multiply(q, p);
+    EXPECT_EQ(1ull, smallCache.getNumberOfHits());
+    smallCache.multiply(q, oneMinusP);
+    EXPECT_EQ(3ull, smallCache.getNumberOfMisses());
+    smallCache.multiply(p, q);
+    EXPECT_EQ(4ull, smallCache.getNumberOfMisses());
+    smallCache.multiply(q, oneMinusP);
+    EXPECT_EQ(2ull, smallCache.getNumberOfHits());
+}
+#endif